@@ -0,0 +1,29 @@
+# cmake -DSOURCE_DIR=<dir> -DOUTPUT=<header> -P SourceHash.cmake
+#
+# writes OUTPUT, a header defining SWIZZLE_SOURCE_HASH as the SHA-256 of the
+# sources under SOURCE_DIR the library is built from (tests excluded). The
+# header is left untouched while the hash is unchanged, so running this on
+# every build only recompiles its includers after a source edit.
+
+file(GLOB_RECURSE sources RELATIVE ${SOURCE_DIR} ${SOURCE_DIR}/*.hpp ${SOURCE_DIR}/*.cpp)
+list(SORT sources)
+
+set(manifest "")
+foreach(source ${sources})
+    if(NOT source MATCHES "^(tests|testing)/")
+        file(SHA256 ${SOURCE_DIR}/${source} source_hash)
+        set(manifest "${manifest}${source} ${source_hash}\n")
+    endif()
+endforeach()
+
+string(SHA256 hash "${manifest}")
+set(header "#pragma once\n\n// generated by _cmake/SourceHash.cmake\n#define SWIZZLE_SOURCE_HASH \"${hash}\"\n")
+
+set(current "")
+if(EXISTS ${OUTPUT})
+    file(READ ${OUTPUT} current)
+endif()
+
+if(NOT current STREQUAL header)
+    file(WRITE ${OUTPUT} "${header}")
+endif()
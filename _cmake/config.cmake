@@ -1,5 +1,11 @@
 include_directories(${CMAKE_SOURCE_DIR})
 
+# per lexer/parser state transition, cycle and exception counters (Parser::stats(), Tokenizer::stats())
+option(SWIZZLE_STATE_STATS "Count transitions and cycles per lexer and parser state" OFF)
+if(SWIZZLE_STATE_STATS)
+    add_definitions(-DSWIZZLE_STATE_STATS)
+endif()
+
 # test and load appropriate platform configurations 
 if(WIN32)
     include(_cmake/platforms/win32.cmake)
@@ -18,6 +18,24 @@ namespace swizzle { namespace parser {
 
 namespace swizzle {
 
+    class IncomparableBenchmarkResults : public std::runtime_error
+    {
+    public:
+        IncomparableBenchmarkResults(const std::string& reason);
+    };
+
+    class InvalidBenchmarkResults : public std::runtime_error
+    {
+    public:
+        InvalidBenchmarkResults(const std::string& reason);
+    };
+
+    class InvalidBinaryAst : public std::runtime_error
+    {
+    public:
+        InvalidBinaryAst(const std::string& reason);
+    };
+
     class InvalidStreamInput : public std::runtime_error
     {
     public:
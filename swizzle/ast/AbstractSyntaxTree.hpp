@@ -1,5 +1,6 @@
 #pragma once
 #include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/NodeIndex.hpp>
 
 namespace swizzle { namespace ast {
     class VisitorInterface;
@@ -15,9 +16,15 @@ namespace swizzle { namespace ast {
         const Node::smartptr root() const;
         Node::smartptr root();
 
+        // per-kind lists of the nodes in the tree, in declaration order.
+        // Populated by the parser.
+        const NodeIndex& index() const;
+        NodeIndex& index();
+
         void accept(VisitorInterface& visitor);
 
     private:
         Node::smartptr root_;
+        NodeIndex index_;
     };
 }}
@@ -0,0 +1,295 @@
+#pragma once
+#include <swizzle/ast/AbstractSyntaxTree.hpp>
+#include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/NodeIndex.hpp>
+#include <swizzle/ast/NodeKindOf.hpp>
+
+#include <swizzle/ast/matchers/compiled/GetChildrenOf.hpp>
+#include <swizzle/ast/matchers/compiled/HasChild.hpp>
+#include <swizzle/ast/matchers/compiled/HasChildNotOf.hpp>
+#include <swizzle/ast/matchers/compiled/HasChildOf.hpp>
+#include <swizzle/ast/matchers/compiled/HasFieldNamed.hpp>
+#include <swizzle/ast/matchers/compiled/IsNotTypeOf.hpp>
+#include <swizzle/ast/matchers/compiled/IsTypeOf.hpp>
+
+#include <boost/utility/string_view.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace swizzle { namespace ast {
+
+    namespace matchers { namespace compiled {
+
+        // marks a rule whose result is exposed through CompiledMatcher::bound<N>()
+        template<class Rule>
+        class Bind : public Rule
+        {
+        public:
+            Bind(const Rule& rule)
+                : Rule(rule)
+            {
+            }
+        };
+
+        template<class Rule>
+        struct IsBound : std::false_type {};
+
+        template<class Rule>
+        struct IsBound<Bind<Rule>> : std::true_type {};
+
+        // a leading isTypeOf<T...> can be answered from a NodeIndex
+        template<class Rule>
+        struct IsIndexable : std::false_type {};
+
+        template<class T>
+        struct IsIndexable<IsTypeOf<T>> : HasNodeKind<T> {};
+
+        template<class T>
+        struct IsIndexable<Bind<IsTypeOf<T>>> : HasNodeKind<T> {};
+
+        template<class Rule>
+        struct IndexKind;
+
+        template<class T>
+        struct IndexKind<IsTypeOf<T>> : NodeKindOf<T> {};
+
+        template<class T>
+        struct IndexKind<Bind<IsTypeOf<T>>> : NodeKindOf<T> {};
+
+        template<class... Rules>
+        constexpr std::size_t boundCount()
+        {
+            std::size_t count = 0;
+            for(const bool b : { false, IsBound<Rules>::value... })
+            {
+                count += b ? 1 : 0;
+            }
+
+            return count;
+        }
+
+        // position in Rules... of the @n-th bound rule
+        template<class... Rules>
+        constexpr std::size_t boundRuleIndex(std::size_t n)
+        {
+            std::size_t index = 0;
+            for(const bool b : { IsBound<Rules>::value..., true })
+            {
+                if(b)
+                {
+                    if(n == 0)
+                    {
+                        return index;
+                    }
+
+                    --n;
+                }
+
+                ++index;
+            }
+
+            return 0;
+        }
+
+        // what bound<N>() returns when there is no N-th bound rule, so that
+        // its static_assert is the only error reported
+        struct NotBound {};
+
+        // result type of the @N-th bound rule
+        template<std::size_t N, class... Rules>
+        struct BoundResult
+        {
+            using type = typename std::tuple_element<
+                (N < boundCount<Rules...>()) ? boundRuleIndex<Rules...>(N) : sizeof...(Rules),
+                std::tuple<typename Rules::result_type..., NotBound>>::type;
+        };
+    }}
+
+    // An allocation free counterpart to Matcher. The rule chain is part of
+    // the type, each rule's result is held in a typed slot and bound slots
+    // are looked up by index at compile time:
+    //
+    //  auto m = CompiledMatcher<>().isTypeOf<nodes::Struct>().bind().hasFieldNamed("size").bind();
+    //  if(m(node))
+    //  {
+    //      nodes::Struct* s = m.bound<0>();
+    //      Node* field = m.bound<1>();
+    //  }
+    //
+    // Each fluent call returns a new matcher type, so build it once with auto
+    // (or decltype) and reuse it. Evaluation never allocates, bound results
+    // are raw pointers owned by the tree being matched.
+    template<class... Rules>
+    class CompiledMatcher
+    {
+    public:
+        CompiledMatcher() = default;
+
+        explicit CompiledMatcher(const std::tuple<Rules...>& rules)
+            : rules_(rules)
+        {
+        }
+
+        // evaluate AST
+        bool operator()(AbstractSyntaxTree& ast)
+        {
+            return evaluate(*ast.root(), std::index_sequence_for<Rules...>());
+        }
+
+        // evaluate subtree
+        bool operator()(const Node::smartptr& node)
+        {
+            return evaluate(*node, std::index_sequence_for<Rules...>());
+        }
+
+        bool operator()(Node& node)
+        {
+            return evaluate(node, std::index_sequence_for<Rules...>());
+        }
+
+        // call @callback(*this) for every node of @ast that matches, returns
+        // the number of matches. A leading isTypeOf<T> on an indexed tree only
+        // visits the indexed nodes of that kind.
+        template<class Callback>
+        std::size_t findAll(AbstractSyntaxTree& ast, Callback callback)
+        {
+            using First = typename std::tuple_element<0, std::tuple<Rules..., void>>::type;
+            return findAll(ast, callback, matchers::compiled::IsIndexable<First>());
+        }
+
+        // the result of the @N-th bound rule (counting from zero)
+        template<std::size_t N>
+        const typename matchers::compiled::BoundResult<N, Rules...>::type& bound() const
+        {
+            static_assert(N < matchers::compiled::boundCount<Rules...>(), "CompiledMatcher::bound<N>(), N is out of range");
+            return bound<N>(std::integral_constant<bool, (N < matchers::compiled::boundCount<Rules...>())>());
+        }
+
+        // bind the result of the last rule added
+        auto bind() const
+        {
+            static_assert(sizeof...(Rules) > 0, "CompiledMatcher::bind() requires a rule to bind");
+            return rebind(std::make_index_sequence<sizeof...(Rules) - 1>());
+        }
+
+        // append a user supplied rule, it must provide a result_type and
+        // bool evaluate(Node&, result_type&) const
+        template<class Rule>
+        CompiledMatcher<Rules..., Rule> append(const Rule& rule) const
+        {
+            return CompiledMatcher<Rules..., Rule>(std::tuple_cat(rules_, std::make_tuple(rule)));
+        }
+
+        template<class... T>
+        auto getChildrenOf() const { return append(matchers::compiled::GetChildrenOf<T...>()); }
+
+        auto hasChild() const { return append(matchers::compiled::HasChild()); }
+
+        template<class... T>
+        auto hasChildOf() const { return append(matchers::compiled::HasChildOf<T...>()); }
+
+        template<class... T>
+        auto hasChildNotOf() const { return append(matchers::compiled::HasChildNotOf<T...>()); }
+
+        auto hasFieldNamed(const boost::string_view& name) const { return append(matchers::compiled::HasFieldNamed(name)); }
+
+        template<class... T>
+        auto isTypeOf() const { return append(matchers::compiled::IsTypeOf<T...>()); }
+
+        template<class... T>
+        auto isNotTypeOf() const { return append(matchers::compiled::IsNotTypeOf<T...>()); }
+
+    private:
+        template<class... Other>
+        friend class CompiledMatcher;
+
+        using Results = std::tuple<typename Rules::result_type...>;
+
+        template<std::size_t... I>
+        bool evaluate(Node& node, std::index_sequence<I...>)
+        {
+            bool matched = true;
+            (void)std::initializer_list<int>{ (matched = matched && std::get<I>(rules_).evaluate(node, std::get<I>(results_)), 0)... };
+
+            return matched;
+        }
+
+        template<std::size_t N>
+        const typename matchers::compiled::BoundResult<N, Rules...>::type& bound(std::true_type) const
+        {
+            return std::get<matchers::compiled::boundRuleIndex<Rules...>(N)>(results_);
+        }
+
+        template<std::size_t N>
+        const matchers::compiled::NotBound& bound(std::false_type) const
+        {
+            static const matchers::compiled::NotBound none;
+            return none;
+        }
+
+        template<std::size_t... I>
+        auto rebind(std::index_sequence<I...>) const
+        {
+            using Last = typename std::tuple_element<sizeof...(Rules) - 1, std::tuple<Rules...>>::type;
+            using Bound = matchers::compiled::Bind<Last>;
+
+            return CompiledMatcher<typename std::tuple_element<I, std::tuple<Rules...>>::type..., Bound>(
+                std::make_tuple(std::get<I>(rules_)..., Bound(std::get<sizeof...(Rules) - 1>(rules_))));
+        }
+
+        template<class Callback>
+        std::size_t findAll(AbstractSyntaxTree& ast, Callback& callback, std::true_type)
+        {
+            using First = typename std::tuple_element<0, std::tuple<Rules...>>::type;
+            const auto& index = ast.index();
+
+            if(index.size() == 0)
+            {
+                return findAll(*ast.root(), callback);
+            }
+
+            std::size_t count = 0;
+            for(const auto& node : index.of(matchers::compiled::IndexKind<First>::value))
+            {
+                if(evaluate(*node, std::index_sequence_for<Rules...>()))
+                {
+                    callback(*this);
+                    ++count;
+                }
+            }
+
+            return count;
+        }
+
+        template<class Callback>
+        std::size_t findAll(AbstractSyntaxTree& ast, Callback& callback, std::false_type)
+        {
+            return findAll(*ast.root(), callback);
+        }
+
+        template<class Callback>
+        std::size_t findAll(Node& node, Callback& callback)
+        {
+            std::size_t count = 0;
+            if(evaluate(node, std::index_sequence_for<Rules...>()))
+            {
+                callback(*this);
+                ++count;
+            }
+
+            for(const auto& child : node.children())
+            {
+                count += findAll(*child, callback);
+            }
+
+            return count;
+        }
+
+    private:
+        std::tuple<Rules...> rules_;
+        Results results_;
+    };
+}}
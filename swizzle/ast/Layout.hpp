@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+
+namespace swizzle { namespace ast {
+    class AbstractSyntaxTree;
+}}
+
+namespace swizzle { namespace ast { namespace nodes {
+    class Struct;
+}}}
+
+namespace swizzle { namespace ast {
+
+    // wire size in bytes, MaxSize is Unbounded when nothing limits it
+    struct SizeRange
+    {
+        static constexpr std::size_t Unbounded = std::numeric_limits<std::size_t>::max();
+
+        std::size_t MinSize = 0;
+        std::size_t MaxSize = 0;
+
+        bool fixed() const { return MinSize == MaxSize; }
+    };
+
+    // where a StructField or VariableBlock sits on the wire
+    struct FieldLayout : SizeRange
+    {
+        bool FixedOffset = false;       // every member before this one has a fixed size
+        std::size_t Offset = 0;         // from the start of the struct, only meaningful with FixedOffset
+        std::size_t ElementSize = 0;    // arrays and vectors: size of one element, 0 if elements vary in size
+    };
+
+    struct StructLayout : SizeRange
+    {
+        std::size_t FixedPrefix = 0;    // bytes before the first variable length member, all of them for a fixed size struct
+    };
+
+    // lay out every struct of @ast, the results are cached on the Struct,
+    // StructField and VariableBlock nodes. Structs of imported modules are laid
+    // out on demand if they haven't been. Throws SyntaxError for a struct that
+    // contains itself other than through a vector.
+    void computeLayout(const AbstractSyntaxTree& ast);
+
+    // @return the layout of @structure, computed (and cached) if need be
+    const StructLayout& layout(nodes::Struct& structure);
+}}
@@ -1,9 +1,11 @@
 #pragma once
 #include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/NodeKind.hpp>
 #include <swizzle/ast/VariableBindingInterface.hpp>
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace swizzle { namespace ast {
 
@@ -15,6 +17,11 @@ namespace swizzle { namespace ast {
         virtual bool evaluate(VariableBindingInterface& binder, Node::smartptr node) = 0;
         virtual void bind_variable(const std::string& name) { bindName_ = name; }
 
+        // a rule that can only match nodes of specific kinds appends them
+        // to @kinds and returns true, this lets tree-wide queries start
+        // from the AbstractSyntaxTree's NodeIndex.
+        virtual bool kinds(std::vector<NodeKind>&) const { return false; }
+
     protected:
         std::string bindName_;
     };
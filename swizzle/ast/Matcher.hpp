@@ -16,6 +16,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace swizzle { namespace ast {
 
@@ -90,6 +91,39 @@ namespace swizzle { namespace ast {
             return true;
         }
 
+        // evaluate every node of @ast, returning the nodes that matched.
+        //
+        // When the first rule is isTypeOf<T...> and the tree has been indexed
+        // by the parser, only the indexed nodes of those kinds are evaluated
+        // (grouped by kind in the order given, declaration order within a kind).
+        // Otherwise the whole tree is walked depth first.
+        std::deque<Node::smartptr> findAll(AbstractSyntaxTree& ast)
+        {
+            std::deque<Node::smartptr> matches;
+
+            std::vector<NodeKind> kinds;
+            const auto& index = ast.index();
+
+            if(!rules_.empty() && (index.size() != 0) && rules_.front()->kinds(kinds))
+            {
+                for(const auto kind : kinds)
+                {
+                    for(const auto& node : index.of(kind))
+                    {
+                        if(MatcherImpl::operator()(node))
+                        {
+                            matches.push_back(node);
+                        }
+                    }
+                }
+
+                return matches;
+            }
+
+            findAll(ast.root(), matches);
+            return matches;
+        }
+
         // append a match rule
         template<class MatchRule, class... Args>
         void append(Args&&... args)
@@ -130,6 +164,20 @@ namespace swizzle { namespace ast {
             return iter->second;
         }
 
+    private:
+        void findAll(const Node::smartptr& node, std::deque<Node::smartptr>& matches)
+        {
+            if(MatcherImpl::operator()(node))
+            {
+                matches.push_back(node);
+            }
+
+            for(const auto& child : node->children())
+            {
+                findAll(child, matches);
+            }
+        }
+
     private:
         std::deque<std::shared_ptr<MatchRule>> rules_;
         std::unordered_map<std::string, ast::Node::smartptr> variables_;
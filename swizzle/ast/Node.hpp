@@ -2,6 +2,8 @@
 #include <UsingIntrusivePtrIn/UsingIntrusivePtrIn.hpp>
 #include <UsingIntrusivePtrIn/details/SingleThreadedReferenceCountBase.hpp>
 
+#include <swizzle/ast/NodeKind.hpp>
+
 #include <boost/intrusive_ptr.hpp>
 #include <deque>
 
@@ -16,15 +18,22 @@ namespace swizzle { namespace ast {
     public:
         using smartptr = boost::intrusive_ptr<Node>;
 
+        Node();
         virtual ~Node(){}
         virtual void accept(VisitorInterface& visitor);
 
+        NodeKind kind() const { return kind_; }
+
         const std::deque<Node::smartptr>& children() const;
         void append(Node::smartptr node);
 
         bool empty() const;
 
+    protected:
+        explicit Node(const NodeKind kind);
+
     private:
         std::deque<Node::smartptr> children_;
+        const NodeKind kind_;
     };
 }}
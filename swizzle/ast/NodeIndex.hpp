@@ -0,0 +1,36 @@
+#pragma once
+#include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/NodeKind.hpp>
+#include <swizzle/ast/NodeKindOf.hpp>
+
+#include <array>
+#include <cstddef>
+#include <deque>
+
+namespace swizzle { namespace ast {
+
+    // nodes of an AbstractSyntaxTree grouped by NodeKind, each
+    // group is kept in declaration order. Maintained by the parser
+    // so "give me every Struct" doesn't require a walk of the tree.
+    class NodeIndex
+    {
+    public:
+        using NodeList = std::deque<Node::smartptr>;
+
+        void insert(Node::smartptr node);
+        void clear();
+
+        const NodeList& of(const NodeKind kind) const;
+
+        template<class NodeType>
+        const NodeList& of() const
+        {
+            return of(NodeKindOf<NodeType>::value);
+        }
+
+        std::size_t size() const;
+
+    private:
+        std::array<NodeList, NodeKindCount> nodes_;
+    };
+}}
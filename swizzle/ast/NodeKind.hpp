@@ -0,0 +1,40 @@
+#pragma once 
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+namespace swizzle { namespace ast {
+
+    // tag identifying the concrete type of an ast::Node, set by each
+    // node's constructor so we can dispatch without dynamic_cast.
+    enum class NodeKind : std::uint8_t {
+        Node,
+        Attribute,
+        AttributeBlock,
+        Bitfield,
+        BitfieldField,
+        CharLiteral,
+        Comment,
+        DefaultStringValue,
+        DefaultValue,
+        Enum,
+        EnumField,
+        Extern,
+        FieldLabel,
+        HexLiteral,
+        Import,
+        MultilineComment,
+        Namespace,
+        NumericLiteral,
+        StringLiteral,
+        Struct,
+        StructField,
+        TypeAlias,
+        VariableBlock,
+        VariableBlockCase,
+    };
+
+    static constexpr std::size_t NodeKindCount = static_cast<std::size_t>(NodeKind::VariableBlockCase) + 1;
+
+    std::ostream& operator<<(std::ostream& os, const NodeKind kind);
+}}
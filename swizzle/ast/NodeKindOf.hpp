@@ -0,0 +1,72 @@
+#pragma once
+#include <swizzle/ast/NodeKind.hpp>
+
+#include <type_traits>
+
+namespace swizzle { namespace ast {
+    class Node;
+}}
+
+namespace swizzle { namespace ast { namespace nodes {
+    class Attribute;
+    class AttributeBlock;
+    class Bitfield;
+    class BitfieldField;
+    class CharLiteral;
+    class Comment;
+    class DefaultStringValue;
+    class DefaultValue;
+    class Enum;
+    class EnumField;
+    class Extern;
+    class FieldLabel;
+    class HexLiteral;
+    class Import;
+    class MultilineComment;
+    class Namespace;
+    class NumericLiteral;
+    class StringLiteral;
+    class Struct;
+    class StructField;
+    class TypeAlias;
+    class VariableBlock;
+    class VariableBlockCase;
+}}}
+
+namespace swizzle { namespace ast {
+
+    // maps a node type to its NodeKind at compile time. Only the concrete
+    // node types have a specialization, HasNodeKind<T> can be used to test for one.
+    template<class T>
+    struct NodeKindOf;
+
+    template<class T, class = void>
+    struct HasNodeKind : std::false_type {};
+
+    template<class T>
+    struct HasNodeKind<T, decltype(void(NodeKindOf<T>::value))> : std::true_type {};
+
+    template<> struct NodeKindOf<nodes::Attribute> : std::integral_constant<NodeKind, NodeKind::Attribute> {};
+    template<> struct NodeKindOf<nodes::AttributeBlock> : std::integral_constant<NodeKind, NodeKind::AttributeBlock> {};
+    template<> struct NodeKindOf<nodes::Bitfield> : std::integral_constant<NodeKind, NodeKind::Bitfield> {};
+    template<> struct NodeKindOf<nodes::BitfieldField> : std::integral_constant<NodeKind, NodeKind::BitfieldField> {};
+    template<> struct NodeKindOf<nodes::CharLiteral> : std::integral_constant<NodeKind, NodeKind::CharLiteral> {};
+    template<> struct NodeKindOf<nodes::Comment> : std::integral_constant<NodeKind, NodeKind::Comment> {};
+    template<> struct NodeKindOf<nodes::DefaultStringValue> : std::integral_constant<NodeKind, NodeKind::DefaultStringValue> {};
+    template<> struct NodeKindOf<nodes::DefaultValue> : std::integral_constant<NodeKind, NodeKind::DefaultValue> {};
+    template<> struct NodeKindOf<nodes::Enum> : std::integral_constant<NodeKind, NodeKind::Enum> {};
+    template<> struct NodeKindOf<nodes::EnumField> : std::integral_constant<NodeKind, NodeKind::EnumField> {};
+    template<> struct NodeKindOf<nodes::Extern> : std::integral_constant<NodeKind, NodeKind::Extern> {};
+    template<> struct NodeKindOf<nodes::FieldLabel> : std::integral_constant<NodeKind, NodeKind::FieldLabel> {};
+    template<> struct NodeKindOf<nodes::HexLiteral> : std::integral_constant<NodeKind, NodeKind::HexLiteral> {};
+    template<> struct NodeKindOf<nodes::Import> : std::integral_constant<NodeKind, NodeKind::Import> {};
+    template<> struct NodeKindOf<nodes::MultilineComment> : std::integral_constant<NodeKind, NodeKind::MultilineComment> {};
+    template<> struct NodeKindOf<nodes::Namespace> : std::integral_constant<NodeKind, NodeKind::Namespace> {};
+    template<> struct NodeKindOf<nodes::NumericLiteral> : std::integral_constant<NodeKind, NodeKind::NumericLiteral> {};
+    template<> struct NodeKindOf<nodes::StringLiteral> : std::integral_constant<NodeKind, NodeKind::StringLiteral> {};
+    template<> struct NodeKindOf<nodes::Struct> : std::integral_constant<NodeKind, NodeKind::Struct> {};
+    template<> struct NodeKindOf<nodes::StructField> : std::integral_constant<NodeKind, NodeKind::StructField> {};
+    template<> struct NodeKindOf<nodes::TypeAlias> : std::integral_constant<NodeKind, NodeKind::TypeAlias> {};
+    template<> struct NodeKindOf<nodes::VariableBlock> : std::integral_constant<NodeKind, NodeKind::VariableBlock> {};
+    template<> struct NodeKindOf<nodes::VariableBlockCase> : std::integral_constant<NodeKind, NodeKind::VariableBlockCase> {};
+}}
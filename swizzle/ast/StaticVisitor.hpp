@@ -0,0 +1,120 @@
+#pragma once
+#include <swizzle/ast/AbstractSyntaxTree.hpp>
+#include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/NodeKind.hpp>
+
+#include <swizzle/ast/nodes/Attribute.hpp>
+#include <swizzle/ast/nodes/AttributeBlock.hpp>
+#include <swizzle/ast/nodes/Bitfield.hpp>
+#include <swizzle/ast/nodes/BitfieldField.hpp>
+#include <swizzle/ast/nodes/CharLiteral.hpp>
+#include <swizzle/ast/nodes/Comment.hpp>
+#include <swizzle/ast/nodes/DefaultStringValue.hpp>
+#include <swizzle/ast/nodes/DefaultValue.hpp>
+#include <swizzle/ast/nodes/Enum.hpp>
+#include <swizzle/ast/nodes/EnumField.hpp>
+#include <swizzle/ast/nodes/Extern.hpp>
+#include <swizzle/ast/nodes/FieldLabel.hpp>
+#include <swizzle/ast/nodes/HexLiteral.hpp>
+#include <swizzle/ast/nodes/Import.hpp>
+#include <swizzle/ast/nodes/MultilineComment.hpp>
+#include <swizzle/ast/nodes/Namespace.hpp>
+#include <swizzle/ast/nodes/NumericLiteral.hpp>
+#include <swizzle/ast/nodes/StringLiteral.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/TypeAlias.hpp>
+#include <swizzle/ast/nodes/VariableBlock.hpp>
+#include <swizzle/ast/nodes/VariableBlockCase.hpp>
+
+#include <utility>
+
+namespace swizzle { namespace ast {
+
+    // a compile time alternative to VisitorInterface. Derive with CRTP and
+    // declare operator() only for the node types you care about:
+    //
+    //  class StructCounter : public StaticVisitor<StructCounter>
+    //  {
+    //  public:
+    //      void operator()(nodes::Struct&) { ++count; }
+    //      std::size_t count = 0;
+    //  };
+    //
+    //  StructCounter().visit(ast);
+    //
+    // Dispatch switches on Node::kind(), node kinds without a matching
+    // operator() compile to an empty case. Normal overload resolution applies,
+    // so declaring operator()(Node&) will catch every node kind.
+    template<class Derived>
+    class StaticVisitor
+    {
+    public:
+        // depth first, pre-order walk of the tree (same order as Node::accept)
+        void visit(AbstractSyntaxTree& ast)
+        {
+            visit(*ast.root());
+        }
+
+        void visit(Node& node)
+        {
+            dispatch(node);
+
+            for(auto& child : node.children())
+            {
+                visit(*child);
+            }
+        }
+
+        // invoke the visitor on @node only, do not descend into its children
+        void dispatch(Node& node)
+        {
+            switch(node.kind())
+            {
+            case NodeKind::Node: return invoke(node, 0);
+            case NodeKind::Attribute: return invoke(static_cast<nodes::Attribute&>(node), 0);
+            case NodeKind::AttributeBlock: return invoke(static_cast<nodes::AttributeBlock&>(node), 0);
+            case NodeKind::Bitfield: return invoke(static_cast<nodes::Bitfield&>(node), 0);
+            case NodeKind::BitfieldField: return invoke(static_cast<nodes::BitfieldField&>(node), 0);
+            case NodeKind::CharLiteral: return invoke(static_cast<nodes::CharLiteral&>(node), 0);
+            case NodeKind::Comment: return invoke(static_cast<nodes::Comment&>(node), 0);
+            case NodeKind::DefaultStringValue: return invoke(static_cast<nodes::DefaultStringValue&>(node), 0);
+            case NodeKind::DefaultValue: return invoke(static_cast<nodes::DefaultValue&>(node), 0);
+            case NodeKind::Enum: return invoke(static_cast<nodes::Enum&>(node), 0);
+            case NodeKind::EnumField: return invoke(static_cast<nodes::EnumField&>(node), 0);
+            case NodeKind::Extern: return invoke(static_cast<nodes::Extern&>(node), 0);
+            case NodeKind::FieldLabel: return invoke(static_cast<nodes::FieldLabel&>(node), 0);
+            case NodeKind::HexLiteral: return invoke(static_cast<nodes::HexLiteral&>(node), 0);
+            case NodeKind::Import: return invoke(static_cast<nodes::Import&>(node), 0);
+            case NodeKind::MultilineComment: return invoke(static_cast<nodes::MultilineComment&>(node), 0);
+            case NodeKind::Namespace: return invoke(static_cast<nodes::Namespace&>(node), 0);
+            case NodeKind::NumericLiteral: return invoke(static_cast<nodes::NumericLiteral&>(node), 0);
+            case NodeKind::StringLiteral: return invoke(static_cast<nodes::StringLiteral&>(node), 0);
+            case NodeKind::Struct: return invoke(static_cast<nodes::Struct&>(node), 0);
+            case NodeKind::StructField: return invoke(static_cast<nodes::StructField&>(node), 0);
+            case NodeKind::TypeAlias: return invoke(static_cast<nodes::TypeAlias&>(node), 0);
+            case NodeKind::VariableBlock: return invoke(static_cast<nodes::VariableBlock&>(node), 0);
+            case NodeKind::VariableBlockCase: return invoke(static_cast<nodes::VariableBlockCase&>(node), 0);
+
+            default:
+                break;
+            };
+        }
+
+    private:
+        Derived& derived() { return static_cast<Derived&>(*this); }
+
+        // selected when Derived has a callable operator() for NodeType
+        template<class NodeType>
+        auto invoke(NodeType& node, int) -> decltype(std::declval<Derived&>()(node), void())
+        {
+            derived()(node);
+        }
+
+        // no handler, nothing to do
+        template<class NodeType>
+        void invoke(NodeType&, long)
+        {
+        }
+    };
+}}
@@ -0,0 +1,73 @@
+#pragma once
+#include <boost/utility/string_view.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+namespace swizzle { namespace ast {
+
+    // the interned string behind a Symbol, see Symbol.cpp
+    struct SymbolEntry
+    {
+        SymbolEntry(const boost::string_view& value, std::size_t hash)
+            : value(value.data(), value.size())
+            , hash(hash)
+            , references(1)
+        {
+        }
+
+        const std::string value;
+        const std::size_t hash;
+        std::atomic<std::size_t> references;
+    };
+
+    // a handle to an interned string. Interning the same characters twice
+    // yields the same handle, so comparing and hashing symbols never touches
+    // the characters. An interned string is reference counted and freed with
+    // the last symbol referring to it, so the pool only holds the names of
+    // live ASTs.
+    class Symbol
+    {
+    public:
+        // the empty symbol
+        Symbol();
+
+        Symbol(const Symbol& other);
+        Symbol& operator=(const Symbol& other);
+        ~Symbol();
+
+        static Symbol intern(const boost::string_view& value);
+
+        // number of strings currently interned
+        static std::size_t poolSize();
+
+        boost::string_view view() const { return boost::string_view(entry_->value); }
+        const std::string& str() const { return entry_->value; }
+
+        bool empty() const { return entry_->value.empty(); }
+        std::size_t hash() const { return std::hash<const SymbolEntry*>()(entry_); }
+
+        bool operator==(const Symbol& other) const { return entry_ == other.entry_; }
+        bool operator!=(const Symbol& other) const { return entry_ != other.entry_; }
+
+    private:
+        // takes over the reference @entry was acquired with
+        explicit Symbol(SymbolEntry* entry);
+
+        SymbolEntry* entry_;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const Symbol& symbol);
+}}
+
+namespace std {
+
+    template<>
+    struct hash<swizzle::ast::Symbol>
+    {
+        std::size_t operator()(const swizzle::ast::Symbol& symbol) const { return symbol.hash(); }
+    };
+}
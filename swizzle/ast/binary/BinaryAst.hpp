@@ -0,0 +1,40 @@
+#pragma once
+#include <swizzle/ast/binary/BinaryNode.hpp>
+#include <swizzle/ast/binary/Format.hpp>
+
+#include <boost/utility/string_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace swizzle { namespace ast { namespace binary {
+
+    // a serialized AbstractSyntaxTree read in place. Does not own @data,
+    // which must be aligned for NodeRecord (malloc'd and mmap'd memory is)
+    // and outlive the BinaryAst. The buffer is validated up front, throws
+    // InvalidBinaryAst if it is truncated, foreign or inconsistent.
+    class BinaryAst
+    {
+    public:
+        BinaryAst(const char* data, const std::size_t size);
+
+        BinaryNode root() const { return node(0); }
+        BinaryNode node(const std::uint32_t index) const { return BinaryNode(*this, index); }
+
+        std::size_t size() const { return header_->nodeCount; }
+        boost::string_view filename() const { return string(header_->filename); }
+
+        boost::string_view string(const std::uint32_t index) const;
+        const NodeRecord& record(const std::uint32_t index) const { return nodes_[index]; }
+
+    private:
+        void validate(const std::size_t size) const;
+
+    private:
+        const char* data_;
+        const Header* header_;
+        const NodeRecord* nodes_;
+        const StringRecord* strings_;
+        const char* stringData_;
+    };
+}}}
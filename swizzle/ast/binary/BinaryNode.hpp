@@ -0,0 +1,47 @@
+#pragma once
+#include <swizzle/ast/NodeKind.hpp>
+#include <swizzle/ast/binary/Format.hpp>
+
+#include <boost/utility/string_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace swizzle { namespace ast { namespace binary {
+
+    class BinaryAst;
+
+    // a read only view of one node of a BinaryAst. Cheap to copy, valid for
+    // as long as the buffer underneath the BinaryAst. See binary/Format.hpp
+    // for what text(), type(), aux(), value() and value2() hold per kind.
+    class BinaryNode
+    {
+    public:
+        BinaryNode(const BinaryAst& ast, const std::uint32_t index);
+
+        std::uint32_t index() const { return index_; }
+        NodeKind kind() const { return static_cast<NodeKind>(record_->kind); }
+
+        boost::string_view text() const;
+        boost::string_view type() const;
+        boost::string_view aux() const;
+
+        std::size_t line() const { return record_->line; }
+        std::size_t column() const { return record_->column; }
+
+        std::int64_t value() const { return record_->value; }
+        std::int64_t value2() const { return record_->value2; }
+
+        bool isConst() const { return (record_->flags & NodeFlags::IsConst) != 0; }
+        bool isArray() const { return (record_->flags & NodeFlags::IsArray) != 0; }
+        bool isVector() const { return (record_->flags & NodeFlags::IsVector) != 0; }
+
+        std::size_t childCount() const { return record_->childCount; }
+        BinaryNode child(const std::size_t n) const;
+
+    private:
+        const BinaryAst* ast_;
+        const NodeRecord* record_;
+        std::uint32_t index_;
+    };
+}}}
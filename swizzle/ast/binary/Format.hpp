@@ -0,0 +1,96 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace swizzle { namespace ast { namespace binary {
+
+    // On disk layout of a serialized AbstractSyntaxTree. Every offset is
+    // relative to the start of the buffer and every reference is an index,
+    // so a buffer can be memory mapped anywhere and read in place.
+    //
+    //  Header
+    //  NodeRecord[nodeCount]       breadth first, node 0 is the root
+    //  StringRecord[stringCount]   string 0 is always the empty string
+    //  char[]                      string data, not null terminated
+    //
+    // Nodes are laid out breadth first so the children of a node are
+    // contiguous: [firstChild, firstChild + childCount).
+    //
+    // Meaning of the per node fields (unlisted fields are empty/zero):
+    //
+    //  kind                text                type            aux                 value       value2
+    //  Struct              qualified name
+    //  Enum, Bitfield      qualified name      underlying type
+    //  StructField         name                type            vector size member  array size
+    //  EnumField           name                underlying type                     value
+    //  BitfieldField       name                underlying type                     begin bit   end bit
+    //  DefaultValue        value               underlying type
+    //  DefaultStringValue  value               underlying type                     length
+    //  TypeAlias           aliased type        existing type
+    //  VariableBlock       variable on field
+    //  VariableBlockCase   case value          case type
+    //  Import              import path
+    //  Extern              extern type
+    //  everything else     token text
+    //
+    // line and column are the start of the token stored in text (the name
+    // token for Struct, Enum and Bitfield). Values are stored in host byte
+    // order, Header::byteOrder lets a reader reject a foreign buffer.
+
+    static constexpr char Magic[4] = { 'S', 'W', 'Z', 'A' };
+    static constexpr std::uint32_t Version = 1;
+    static constexpr std::uint32_t ByteOrderMark = 0x01020304;
+
+    enum NodeFlags : std::uint8_t
+    {
+        IsConst = 1 << 0,
+        IsArray = 1 << 1,
+        IsVector = 1 << 2,
+    };
+
+    struct Header
+    {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint32_t size;             // total size of the buffer in bytes
+
+        std::uint32_t filename;         // string index of the source file name
+        std::uint32_t nodeCount;
+        std::uint32_t nodesOffset;
+        std::uint32_t stringCount;
+        std::uint32_t stringsOffset;
+        std::uint32_t stringDataOffset;
+    };
+
+    struct NodeRecord
+    {
+        std::uint8_t kind;              // NodeKind
+        std::uint8_t flags;             // NodeFlags
+        std::uint16_t reserved;
+
+        std::uint32_t line;
+        std::uint32_t column;
+
+        std::uint32_t text;             // string indexes
+        std::uint32_t type;
+        std::uint32_t aux;
+
+        std::int64_t value;
+        std::int64_t value2;
+
+        std::uint32_t firstChild;
+        std::uint32_t childCount;
+    };
+
+    struct StringRecord
+    {
+        std::uint32_t offset;           // relative to Header::stringDataOffset
+        std::uint32_t length;
+    };
+
+    static_assert(std::is_standard_layout<Header>::value && (sizeof(Header) == 40), "binary::Header layout changed, bump binary::Version");
+    static_assert(std::is_standard_layout<NodeRecord>::value && (sizeof(NodeRecord) == 48), "binary::NodeRecord layout changed, bump binary::Version");
+    static_assert(std::is_standard_layout<StringRecord>::value && (sizeof(StringRecord) == 8), "binary::StringRecord layout changed, bump binary::Version");
+}}}
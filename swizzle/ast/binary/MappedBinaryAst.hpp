@@ -0,0 +1,27 @@
+#pragma once
+#include <swizzle/ast/binary/BinaryAst.hpp>
+
+#include <boost/filesystem/path.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace swizzle { namespace ast { namespace binary {
+
+    // memory maps a file written by binary::serialize() read only, the
+    // nodes are read straight out of the mapping.
+    class MappedBinaryAst
+    {
+    public:
+        explicit MappedBinaryAst(const boost::filesystem::path& path);
+
+        MappedBinaryAst(const MappedBinaryAst&) = delete;
+        MappedBinaryAst& operator=(const MappedBinaryAst&) = delete;
+
+        const BinaryAst& ast() const { return ast_; }
+
+    private:
+        boost::interprocess::file_mapping file_;
+        boost::interprocess::mapped_region region_;
+        BinaryAst ast_;
+    };
+}}}
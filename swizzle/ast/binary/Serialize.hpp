@@ -0,0 +1,12 @@
+#pragma once
+#include <swizzle/ast/AbstractSyntaxTree.hpp>
+
+#include <ostream>
+#include <vector>
+
+namespace swizzle { namespace ast { namespace binary {
+
+    // serialize @ast into the format described in binary/Format.hpp
+    std::vector<char> serialize(const AbstractSyntaxTree& ast);
+    void serialize(const AbstractSyntaxTree& ast, std::ostream& os);
+}}}
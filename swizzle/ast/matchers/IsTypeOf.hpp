@@ -1,8 +1,10 @@
 #pragma once
 #include <swizzle/ast/MatchRule.hpp>
+#include <swizzle/ast/NodeKindOf.hpp>
 
 #include <cstddef>
 #include <numeric>
+#include <vector>
 
 namespace swizzle { namespace ast { namespace matchers {
 
@@ -26,6 +28,29 @@ namespace swizzle { namespace ast { namespace matchers {
 
             return false;
         }
+
+        bool kinds(std::vector<NodeKind>& kinds) const override
+        {
+            static constexpr bool indexable[] = { HasNodeKind<T>::value... };
+            for(const auto i : indexable)
+            {
+                if(!i)
+                {
+                    return false;
+                }
+            }
+
+            kinds.insert(kinds.end(), { kindOf<T>(HasNodeKind<T>())... });
+            return true;
+        }
+
+    private:
+        template<class U>
+        static NodeKind kindOf(std::true_type) { return NodeKindOf<U>::value; }
+
+        // never used, kinds() returns early if any T has no NodeKind
+        template<class U>
+        static NodeKind kindOf(std::false_type) { return NodeKind::Node; }
     };
 }}}
 
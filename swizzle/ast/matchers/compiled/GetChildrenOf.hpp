@@ -0,0 +1,97 @@
+#pragma once
+#include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/matchers/compiled/MatchesType.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+
+namespace swizzle { namespace ast { namespace matchers { namespace compiled {
+
+    // a non-owning view over the children of a node that are one of T...
+    template<class... T>
+    class ChildrenOf
+    {
+    public:
+        using Children = std::deque<Node::smartptr>;
+
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename BoundPointer<T...>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = value_type*;
+            using reference = value_type;
+
+            iterator(Children::const_iterator current, Children::const_iterator end)
+                : current_(current)
+                , end_(end)
+            {
+                skip();
+            }
+
+            value_type operator*() const { return static_cast<value_type>(current_->get()); }
+
+            iterator& operator++()
+            {
+                ++current_;
+                skip();
+
+                return *this;
+            }
+
+            bool operator==(const iterator& other) const { return current_ == other.current_; }
+            bool operator!=(const iterator& other) const { return current_ != other.current_; }
+
+        private:
+            void skip()
+            {
+                while((current_ != end_) && !matchesType<T...>(**current_))
+                {
+                    ++current_;
+                }
+            }
+
+            Children::const_iterator current_;
+            Children::const_iterator end_;
+        };
+
+        ChildrenOf()
+            : children_(nullptr)
+        {
+        }
+
+        explicit ChildrenOf(const Children& children)
+            : children_(&children)
+        {
+        }
+
+        iterator begin() const { return children_ ? iterator(children_->cbegin(), children_->cend()) : iterator(empty_.cbegin(), empty_.cend()); }
+        iterator end() const { return children_ ? iterator(children_->cend(), children_->cend()) : iterator(empty_.cend(), empty_.cend()); }
+
+        bool empty() const { return begin() == end(); }
+        std::size_t size() const { return std::distance(begin(), end()); }
+
+    private:
+        const Children* children_;
+        static const Children empty_;
+    };
+
+    template<class... T>
+    const typename ChildrenOf<T...>::Children ChildrenOf<T...>::empty_;
+
+    // on match binds a ChildrenOf<T...> view of the matching children
+    template<class... T>
+    class GetChildrenOf
+    {
+    public:
+        using result_type = ChildrenOf<T...>;
+
+        bool evaluate(Node& node, result_type& result) const
+        {
+            result = result_type(node.children());
+            return !result.empty();
+        }
+    };
+}}}}
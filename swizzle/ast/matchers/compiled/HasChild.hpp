@@ -0,0 +1,23 @@
+#pragma once
+#include <swizzle/ast/Node.hpp>
+
+namespace swizzle { namespace ast { namespace matchers { namespace compiled {
+
+    // on match binds the parent node
+    class HasChild
+    {
+    public:
+        using result_type = Node*;
+
+        bool evaluate(Node& node, result_type& result) const
+        {
+            if(!node.empty())
+            {
+                result = &node;
+                return true;
+            }
+
+            return false;
+        }
+    };
+}}}}
@@ -0,0 +1,28 @@
+#pragma once
+#include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/matchers/compiled/MatchesType.hpp>
+
+namespace swizzle { namespace ast { namespace matchers { namespace compiled {
+
+    // on match binds the parent node
+    template<class... T>
+    class HasChildOf
+    {
+    public:
+        using result_type = Node*;
+
+        bool evaluate(Node& node, result_type& result) const
+        {
+            for(const auto& child : node.children())
+            {
+                if(matchesType<T...>(*child))
+                {
+                    result = &node;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    };
+}}}}
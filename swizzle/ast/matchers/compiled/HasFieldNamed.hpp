@@ -0,0 +1,22 @@
+#pragma once
+#include <swizzle/ast/Node.hpp>
+
+#include <boost/utility/string_view.hpp>
+
+namespace swizzle { namespace ast { namespace matchers { namespace compiled {
+
+    // on a match binds the matched StructField or BitfieldField, not the parent.
+    // @name is not copied, the viewed characters must outlive the rule.
+    class HasFieldNamed
+    {
+    public:
+        using result_type = Node*;
+
+        HasFieldNamed(const boost::string_view& name);
+
+        bool evaluate(Node& node, result_type& result) const;
+
+    private:
+        boost::string_view name_;
+    };
+}}}}
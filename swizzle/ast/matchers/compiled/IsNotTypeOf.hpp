@@ -0,0 +1,25 @@
+#pragma once
+#include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/matchers/compiled/MatchesType.hpp>
+
+namespace swizzle { namespace ast { namespace matchers { namespace compiled {
+
+    // on match binds the node
+    template<class... T>
+    class IsNotTypeOf
+    {
+    public:
+        using result_type = Node*;
+
+        bool evaluate(Node& node, result_type& result) const
+        {
+            if(!matchesType<T...>(node))
+            {
+                result = &node;
+                return true;
+            }
+
+            return false;
+        }
+    };
+}}}}
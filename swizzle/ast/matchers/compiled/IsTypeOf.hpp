@@ -0,0 +1,25 @@
+#pragma once
+#include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/matchers/compiled/MatchesType.hpp>
+
+namespace swizzle { namespace ast { namespace matchers { namespace compiled {
+
+    // on match binds the node
+    template<class... T>
+    class IsTypeOf
+    {
+    public:
+        using result_type = typename BoundPointer<T...>::type;
+
+        bool evaluate(Node& node, result_type& result) const
+        {
+            if(matchesType<T...>(node))
+            {
+                result = static_cast<result_type>(&node);
+                return true;
+            }
+
+            return false;
+        }
+    };
+}}}}
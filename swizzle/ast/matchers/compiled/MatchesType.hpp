@@ -0,0 +1,54 @@
+#pragma once
+#include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/NodeKindOf.hpp>
+
+#include <type_traits>
+
+namespace swizzle { namespace ast { namespace matchers { namespace compiled {
+
+    namespace detail {
+
+        template<class T>
+        bool matchesOne(const Node& node, std::true_type)
+        {
+            return node.kind() == NodeKindOf<T>::value;
+        }
+
+        template<class T>
+        bool matchesOne(const Node& node, std::false_type)
+        {
+            return dynamic_cast<const T*>(&node) != nullptr;
+        }
+    }
+
+    // true when @node is one of T... Concrete node types are compared by
+    // Node::kind(), anything else (e.g. ast::Node) falls back to dynamic_cast.
+    template<class... T>
+    bool matchesType(const Node& node)
+    {
+        const bool results[] = { detail::matchesOne<T>(node, HasNodeKind<T>())... };
+
+        for(const auto result : results)
+        {
+            if(result)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // the pointer type a rule binds, a single type binds as T*
+    template<class... T>
+    struct BoundPointer
+    {
+        using type = Node*;
+    };
+
+    template<class T>
+    struct BoundPointer<T>
+    {
+        using type = T*;
+    };
+}}}}
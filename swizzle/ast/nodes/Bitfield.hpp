@@ -1,7 +1,9 @@
 #pragma once 
 #include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/Symbol.hpp>
 #include <swizzle/lexer/TokenInfo.hpp>
 
+#include <boost/utility/string_view.hpp>
 #include <string>
 
 namespace swizzle { namespace ast {
@@ -19,7 +21,9 @@ namespace swizzle { namespace ast { namespace nodes {
         const lexer::TokenInfo& nameInfo() const;
         const lexer::TokenInfo& underlyingTypeInfo() const;
 
-        std::string name() const;
+        // namespace qualified name
+        boost::string_view name() const;
+        Symbol symbol() const;
 
         void underlying(const lexer::TokenInfo& value);
         const lexer::TokenInfo& underlying() const;
@@ -33,6 +37,6 @@ namespace swizzle { namespace ast { namespace nodes {
         lexer::TokenInfo underlyingInfo_;
         lexer::TokenInfo underlyingType_;
 
-        const std::string name_;
+        const Symbol name_;
     };
 }}}
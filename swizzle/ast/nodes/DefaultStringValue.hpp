@@ -1,9 +1,10 @@
 #pragma once 
 #include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/Symbol.hpp>
 #include <swizzle/lexer/TokenInfo.hpp>
 
+#include <boost/utility/string_view.hpp>
 #include <cstddef>
-#include <string>
 
 namespace swizzle { namespace ast {
     class VisitorInterface;
@@ -14,10 +15,11 @@ namespace swizzle { namespace ast { namespace nodes {
     class DefaultStringValue : public Node
     {
     public:
-        DefaultStringValue(const lexer::TokenInfo& value, const std::string& underlyingType, const std::ptrdiff_t length);
+        DefaultStringValue(const lexer::TokenInfo& value, const boost::string_view& underlyingType, const std::ptrdiff_t length);
 
         const lexer::TokenInfo& value() const;
-        const std::string& underlying() const;
+        boost::string_view underlying() const;
+        Symbol underlyingSymbol() const;
 
         std::ptrdiff_t length() const;
 
@@ -25,7 +27,7 @@ namespace swizzle { namespace ast { namespace nodes {
 
     private:
         const lexer::TokenInfo value_;
-        const std::string underlying_;
+        const Symbol underlying_;
         const std::ptrdiff_t length_;
     };
 }}}
@@ -1,8 +1,9 @@
 #pragma once 
 #include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/Symbol.hpp>
 #include <swizzle/lexer/TokenInfo.hpp>
 
-#include <string>
+#include <boost/utility/string_view.hpp>
 
 namespace swizzle { namespace ast {
     class VisitorInterface;
@@ -13,15 +14,16 @@ namespace swizzle { namespace ast { namespace nodes {
     class DefaultValue : public Node
     {
     public:
-        DefaultValue(const lexer::TokenInfo& defaultValueInfo, const std::string& underlyingType);
+        DefaultValue(const lexer::TokenInfo& defaultValueInfo, const boost::string_view& underlyingType);
 
         const lexer::TokenInfo& value() const;
-        const std::string& underlying() const;
+        boost::string_view underlying() const;
+        Symbol underlyingSymbol() const;
 
         void accept(VisitorInterface& visitor) override;
 
     private:
         const lexer::TokenInfo value_;
-        const std::string underlying_;
+        const Symbol underlying_;
     };
 }}}
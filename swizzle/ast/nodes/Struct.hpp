@@ -1,7 +1,10 @@
 #pragma once 
+#include <swizzle/ast/Layout.hpp>
 #include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/Symbol.hpp>
 #include <swizzle/lexer/TokenInfo.hpp>
 
+#include <boost/utility/string_view.hpp>
 #include <string>
 
 namespace swizzle { namespace ast {
@@ -18,7 +21,14 @@ namespace swizzle { namespace ast { namespace nodes {
         const lexer::TokenInfo& info() const;
         const lexer::TokenInfo& nameInfo() const;
 
-        std::string name() const;
+        // namespace qualified name
+        boost::string_view name() const;
+        Symbol symbol() const;
+
+        // wire layout, set by ast::computeLayout()
+        bool hasLayout() const;
+        void layout(const StructLayout& layout);
+        const StructLayout& layout() const;
 
         void accept(VisitorInterface& visitor) override;
 
@@ -26,6 +36,9 @@ namespace swizzle { namespace ast { namespace nodes {
         lexer::TokenInfo info_;
         lexer::TokenInfo nameInfo_;
 
-        const std::string name_;
+        const Symbol name_;
+
+        StructLayout layout_;
+        bool hasLayout_;
     };
 }}}
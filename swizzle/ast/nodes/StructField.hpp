@@ -1,9 +1,11 @@
 #pragma once 
+#include <swizzle/ast/Layout.hpp>
 #include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/Symbol.hpp>
 #include <swizzle/lexer/TokenInfo.hpp>
 
+#include <boost/utility/string_view.hpp>
 #include <cstddef>
-#include <string>
 
 namespace swizzle { namespace ast {
     class VisitorInterface;
@@ -19,8 +21,14 @@ namespace swizzle { namespace ast { namespace nodes {
         void name(const lexer::TokenInfo& name);
         const lexer::TokenInfo& name() const;
 
-        void type(const std::string& type);
-        std::string type() const;
+        void type(const boost::string_view& type);
+        boost::string_view type() const;
+        Symbol typeSymbol() const;
+
+        // the Struct, Enum or Bitfield declaring type(),
+        // nullptr for built in types. Not owning, the declaring tree owns it.
+        void typeDeclaration(Node* declaration);
+        Node* typeDeclaration() const;
 
         void setConst();
         bool isConst() const;
@@ -34,13 +42,19 @@ namespace swizzle { namespace ast { namespace nodes {
         bool isVector() const;
         const lexer::TokenInfo& vectorSizeMember() const;
 
+        // wire layout, set by ast::computeLayout()
+        void layout(const FieldLayout& layout);
+        const FieldLayout& layout() const;
+
         void accept(VisitorInterface& visitor) override;
 
     private:
         lexer::TokenInfo name_;
-        std::string type_;
+        Symbol type_;
+        Node* typeDeclaration_;
 
         lexer::TokenInfo vectorOnField_;
+        FieldLayout layout_;
         std::ptrdiff_t arraySize_;   // this has to be signed so we can detect and report errant negative sizes
         bool isConst_;
         bool isVector_;
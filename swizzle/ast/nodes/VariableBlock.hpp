@@ -1,4 +1,5 @@
 #pragma once 
+#include <swizzle/ast/Layout.hpp>
 #include <swizzle/ast/Node.hpp>
 #include <swizzle/lexer/TokenInfo.hpp>
 
@@ -20,10 +21,15 @@ namespace swizzle { namespace ast { namespace nodes {
         void variableOnField(const lexer::TokenInfo& variableOnField);
         const lexer::TokenInfo& variableOnField() const;
 
+        // wire layout, set by ast::computeLayout()
+        void layout(const FieldLayout& layout);
+        const FieldLayout& layout() const;
+
         void accept(VisitorInterface& visitor) override;
 
     private:
         const lexer::TokenInfo variableBlockInfo_;   // variable_block keyword
         lexer::TokenInfo variableOnFieldInfo_;       // field we're variable on
+        FieldLayout layout_;
     };
 }}}
@@ -7,14 +7,21 @@ namespace swizzle { namespace ast { namespace nodes {
     class VariableBlockCase : public Node
     {
     public:
+        VariableBlockCase();
+
         void value(const lexer::TokenInfo& value);  // set the case value
         const lexer::TokenInfo& value() const;      // @return the case value
 
         void type(const lexer::TokenInfo& type);
         lexer::TokenInfo type() const;
 
+        // the Struct declaring type(). Not owning, the declaring tree owns it.
+        void typeDeclaration(Node* declaration);
+        Node* typeDeclaration() const;
+
     private:
         lexer::TokenInfo value_;
         lexer::TokenInfo type_;
+        Node* typeDeclaration_;
     };
 }}}
@@ -0,0 +1,32 @@
+#pragma once
+#include <swizzle/bench/Results.hpp>
+#include <swizzle/bench/Statistics.hpp>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace bench {
+
+    struct Comparison
+    {
+        std::string Benchmark;
+        double Baseline = 0;        // median
+        double Current = 0;         // median
+        Interval Range;             // confidence interval of Current
+        double Change = 0;          // Current / Baseline - 1
+        bool Regressed = false;
+    };
+
+    // compare the throughput benchmarks (named *_per_second) found in both
+    // @baseline and @current. A benchmark regressed when even the top of its
+    // confidence interval is more than @threshold (0.05 is 5%) below the
+    // baseline median, so noise alone does not fail the gate. Throws
+    // IncomparableBenchmarkResults when the two were measured by different
+    // builds or on differently shaped schemas, their numbers are unrelated.
+    std::vector<Comparison> compare(const Results& baseline, const Results& current, double threshold);
+
+    bool regressed(const std::vector<Comparison>& comparisons);
+
+    void print(std::ostream& os, const std::vector<Comparison>& comparisons);
+}}
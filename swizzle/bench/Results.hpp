@@ -0,0 +1,52 @@
+#pragma once
+#include <swizzle/bench/SchemaOptions.hpp>
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace bench {
+
+    // samples of each benchmark's metric, one per iteration. Metrics are
+    // rates or sizes named after their unit, e.g. "lexer_mb_per_second".
+    class Results
+    {
+    public:
+        using Samples = std::map<std::string, std::vector<double>>;
+
+        Results() = default;
+
+        // samples measured by a binary described by @build, see
+        // buildDescription(), on schemas shaped like @schema
+        Results(const std::string& build, const SchemaOptions& schema);
+
+        void add(const std::string& benchmark, double value);
+
+        const Samples& samples() const { return samples_; }
+        const std::string& build() const { return build_; }
+        const SchemaOptions& schema() const { return schema_; }
+
+        // benchmark, median and sample count per line
+        void print(std::ostream& os) const;
+
+        // {"build": "...", "schema": {...}, "benchmarks": {"name": {"median": m, "samples": [...]}, ...}}
+        void printJson(std::ostream& os) const;
+
+    private:
+        Samples samples_;
+        std::string build_;
+        SchemaOptions schema_;
+    };
+
+    // the compiler and optimization of this binary, e.g. "gcc 9.4.0, optimized,
+    // NDEBUG". Throughput only compares between binaries built alike.
+    std::string buildDescription();
+
+    // the build, schema and benchmarks of a file written by
+    // Results::printJson(), a benchmark without samples counts its median as
+    // the only sample. A file without "build" reads as an empty build. Throws
+    // InvalidBenchmarkResults when @is does not hold such an object.
+    Results readResults(std::istream& is);
+}}
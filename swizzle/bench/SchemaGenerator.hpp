@@ -0,0 +1,38 @@
+#pragma once
+#include <swizzle/bench/SchemaOptions.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace bench {
+
+    // Makes synthetic .swizzle files for benchmarking. The output depends on
+    // nothing but the SchemaOptions (the same seed gives the same bytes on
+    // every platform). File n imports files n-1 .. n-ImportFanOut and uses
+    // their structs as field types, so the import graph is a chain with
+    // ImportFanOut wide fan-out.
+    class SchemaGenerator
+    {
+    public:
+        explicit SchemaGenerator(const SchemaOptions& options);
+
+        std::size_t files() const { return options_.Files; }
+
+        // where @file lives relative to the import root, e.g. bench/Schema3.swizzle
+        boost::filesystem::path path(const std::size_t file) const;
+
+        std::string source(const std::size_t file) const;
+
+        // write every file below @root, returns the paths written (relative to @root)
+        std::vector<boost::filesystem::path> write(const boost::filesystem::path& root) const;
+
+    private:
+        std::string ns() const;
+
+    private:
+        SchemaOptions options_;
+    };
+}}
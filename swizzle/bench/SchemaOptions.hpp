@@ -0,0 +1,45 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace swizzle { namespace bench {
+
+    // shape of the schemas made by SchemaGenerator, counts are per file
+    // unless noted otherwise
+    struct SchemaOptions
+    {
+        std::size_t Files = 1;
+        std::size_t Structs = 8;
+        std::size_t Fields = 8;                 // per struct
+        std::size_t Enums = 2;
+        std::size_t EnumValues = 8;             // per enum
+        std::size_t Bitfields = 2;
+        std::size_t BitfieldFields = 4;         // per bitfield, at most 8
+        std::size_t VariableBlocks = 1;         // structs ending in a variable_block
+        std::size_t NamespaceDepth = 1;         // components of each file's namespace
+        std::size_t Attributes = 1;             // on every struct, field, enum and bitfield
+        std::size_t ImportFanOut = 0;           // earlier files each file imports
+        std::uint64_t Seed = 1;
+    };
+
+    inline bool operator==(const SchemaOptions& lhs, const SchemaOptions& rhs)
+    {
+        return lhs.Files == rhs.Files
+            && lhs.Structs == rhs.Structs
+            && lhs.Fields == rhs.Fields
+            && lhs.Enums == rhs.Enums
+            && lhs.EnumValues == rhs.EnumValues
+            && lhs.Bitfields == rhs.Bitfields
+            && lhs.BitfieldFields == rhs.BitfieldFields
+            && lhs.VariableBlocks == rhs.VariableBlocks
+            && lhs.NamespaceDepth == rhs.NamespaceDepth
+            && lhs.Attributes == rhs.Attributes
+            && lhs.ImportFanOut == rhs.ImportFanOut
+            && lhs.Seed == rhs.Seed;
+    }
+
+    inline bool operator!=(const SchemaOptions& lhs, const SchemaOptions& rhs)
+    {
+        return !(lhs == rhs);
+    }
+}}
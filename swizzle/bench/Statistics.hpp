@@ -0,0 +1,20 @@
+#pragma once
+#include <vector>
+
+namespace swizzle { namespace bench {
+
+    struct Interval
+    {
+        double Low = 0;
+        double High = 0;
+    };
+
+    // middle value of @samples (mean of the middle two for an even count), 0 for none
+    double median(std::vector<double> samples);
+
+    // ~95% confidence interval of the median of @samples. Distribution free
+    // (the binomial order statistics, normal approximation), so a couple of
+    // outliers from a noisy machine do not move it. With fewer than nine
+    // samples this is the sample range.
+    Interval medianInterval(std::vector<double> samples);
+}}
@@ -0,0 +1,37 @@
+#pragma once
+#include <boost/filesystem/path.hpp>
+#include <string>
+
+namespace swizzle { namespace ast {
+    class AbstractSyntaxTree;
+}}
+
+namespace swizzle { namespace codegen {
+
+    // the header generated for @module (a ModuleMap key), "foo/Bar.swizzle" -> "foo/Bar.hpp"
+    std::string cppHeaderName(const boost::filesystem::path& module);
+
+    // a C++14 header for the module parsed into @ast. Per Enum an enum class with
+    // constant time to_string() and from_string(), per Bitfield a wrapper of its
+    // underlying integer with constexpr mask/shift accessors and a bulk unpack()
+    // (BMI2 when available), and per Struct:
+    //
+    //  - a value type with std::array/runtime::ArenaVector members and decode(data, end, out),
+    //    decode(data, end, out, arena) placing its vectors in a runtime::Arena (arrays
+    //    and vectors of scalars byte swapped whole, with pshufb when available)
+    //  - size(value) and encode(value, out), writing to a caller's buffer without allocating
+    //  - per variable_block with enough cases, a function mapping the discriminator to
+    //    its case through a table, a perfect hash or a sorted search (detail/Dispatch.hpp)
+    //  - a zero copy FooView reading fields in place, using the offsets of
+    //    ast::computeLayout() (which must have run) and @big_endian/@little_endian
+    //  - for a struct marked @columns, FooColumns and decodeColumns(), decoding a batch of
+    //    messages, or of packed fixed size records, into a column per field with SIMD
+    //    gathers. It pays off once a batch outgrows the cache, below that decode() is faster
+    //  - FooMetadata, constexpr tables of its fields, offsets, labels and attributes
+    //    (Enums and Bitfields get one too), found with runtime::Metadata<Foo>
+    //
+    // Imports become #includes of their generated headers, relative to the
+    // directory headers are generated into. The generated code only depends on
+    // the header only swizzle/runtime.
+    std::string generateCpp(const ast::AbstractSyntaxTree& ast);
+}}
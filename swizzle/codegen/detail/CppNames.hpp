@@ -0,0 +1,44 @@
+#pragma once
+#include <boost/utility/string_view.hpp>
+#include <string>
+
+namespace swizzle { namespace ast {
+    class Node;
+}}
+
+namespace swizzle { namespace ast { namespace nodes {
+    class Struct;
+    class StructField;
+}}}
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    // "u16" -> "std::uint16_t", empty if @type is not built in
+    std::string cppBuiltinType(const boost::string_view& type);
+
+    // "foo::Bar" -> "::foo::Bar"
+    std::string cppQualifiedName(const boost::string_view& name);
+
+    // "foo::Bar" -> "Bar"
+    std::string cppShortName(const boost::string_view& name);
+
+    // @name, with a '_' appended if it is a C++ keyword or the name of a
+    // member every generated view has
+    std::string cppIdentifier(const boost::string_view& name);
+
+    // the value type of one element of @field: built in, enum, bitfield or struct
+    std::string cppValueType(const ast::nodes::StructField& field);
+
+    // "::swizzle::runtime::ByteOrder::Big" for a field marked @big_endian, or
+    // in a struct marked @big_endian, little endian otherwise
+    std::string cppByteOrder(const ast::nodes::Struct& structure, const ast::nodes::StructField& field);
+
+    // a dotted member path ("header.count") as a chain of accessors, each
+    // component followed by @call: "header().count()" or "header.count"
+    std::string cppMemberPath(const boost::string_view& path, const std::string& call);
+
+    // @text as a C++ string literal, quotes included
+    std::string cppStringLiteral(const boost::string_view& text);
+
+    bool hasAttribute(const ast::Node& node, const boost::string_view& attribute);
+}}}
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace ast { namespace nodes {
+    class Struct;
+    class VariableBlock;
+}}}
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    // how generated code finds the case a variable_block's discriminator selects,
+    // chosen from the case literals alone
+    struct Dispatch
+    {
+        enum class Strategy
+        {
+            Switch,             // a switch over the literals, few cases or literals not evaluated
+            Table,              // the values fill most of a small range: an array indexed by value - min
+            PerfectHash,        // sparse values: a collision free multiplicative hash into a table
+            SortedSearch,       // neither: a binary search over the sorted values
+        };
+
+        Strategy Kind = Strategy::Switch;
+        std::string Function;                   // returns 1 + the selected case's index, 0 for none
+        std::string KeyType;                    // its parameter, unsigned and as wide as the discriminator
+        std::vector<std::string> Literals;      // the case values as written, for Switch
+
+        std::vector<std::uint64_t> Keys;        // PerfectHash: the value in each slot, SortedSearch: the sorted values
+        std::vector<std::size_t> Cases;         // 1 + case index per table entry, 0 for none
+        std::uint64_t Min = 0;                  // Table: the smallest value
+        std::uint64_t Multiplier = 0;           // PerfectHash: slot = (value * Multiplier) >> Shift
+        unsigned Shift = 0;
+    };
+
+    // a multiplier and shift sending each of the distinct @keys to its own slot
+    // of a table of 2^(64 - shift) entries, slot = (key * multiplier) >> shift.
+    // False if no table small enough was found.
+    bool findPerfectHash(const std::vector<std::uint64_t>& keys, std::uint64_t& multiplier, unsigned& shift);
+
+    // @block is a variable_block of @node named @name (Member::Name). Throws
+    // SyntaxError for a case value repeating, or equal to, an earlier case's
+    // value.
+    Dispatch analyzeDispatch(const ast::nodes::Struct& node, const ast::nodes::VariableBlock& block, const std::string& name);
+
+    // the case function, nothing for Strategy::Switch
+    void emitDispatch(std::ostream& os, const Dispatch& dispatch);
+
+    // "switch(<the case of @discriminator>)" and the label of the @i th case
+    std::string dispatchSwitch(const Dispatch& dispatch, const std::string& discriminator);
+    std::string dispatchLabel(const Dispatch& dispatch, std::size_t i);
+}}}
@@ -0,0 +1,18 @@
+#pragma once
+#include <ostream>
+
+namespace swizzle { namespace ast { namespace nodes {
+    class Struct;
+}}}
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    // FooColumns, Foo as a struct of arrays, and decodeColumns() appending a
+    // batch of messages to it: fields at constant offsets are gathered a
+    // column at a time (runtime/Columns.hpp), the rest of each message is
+    // read in order. Must follow emitView(), it validates through FooView.
+    // Only emitted for structs marked @columns (hasColumns()).
+    bool hasColumns(const ast::nodes::Struct& node);
+
+    void emitColumns(std::ostream& os, const ast::nodes::Struct& node);
+}}}
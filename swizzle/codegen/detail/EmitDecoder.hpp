@@ -0,0 +1,12 @@
+#pragma once
+#include <ostream>
+
+namespace swizzle { namespace ast { namespace nodes {
+    class Struct;
+}}}
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    // decode(data, end, out) filling the value type emitValueType() wrote for @node
+    void emitDecoder(std::ostream& os, const ast::nodes::Struct& node);
+}}}
@@ -0,0 +1,15 @@
+#pragma once
+#include <ostream>
+
+namespace swizzle { namespace ast { namespace nodes {
+    class Struct;
+}}}
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    // size(value), the bytes encode() writes, and encode(value, out) writing
+    // the value type emitValueType() wrote for @node to a caller's buffer.
+    // Like decode() it returns nullptr when it fails, for vector sizes its
+    // size members can't hold
+    void emitEncoder(std::ostream& os, const ast::nodes::Struct& node);
+}}}
@@ -0,0 +1,14 @@
+#pragma once
+#include <ostream>
+
+namespace swizzle { namespace ast { namespace nodes {
+    class Enum;
+}}}
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    // to_string(value), indexing an array of names when the values are dense
+    // and hashing them otherwise, and from_string(name, size, out) looking the
+    // name up in a perfect hash of runtime::hashName(). Must follow emitEnum().
+    void emitEnumNames(std::ostream& os, const ast::nodes::Enum& node);
+}}}
@@ -0,0 +1,20 @@
+#pragma once
+#include <ostream>
+
+namespace swizzle { namespace ast { namespace nodes {
+    class Bitfield;
+    class Enum;
+    class Struct;
+}}}
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    // FooMetadata, constexpr tables describing Foo as the schema declares it
+    // (names, types, wire offsets and sizes, labels, attributes), and the
+    // metadata(const Foo&) declaration runtime::Metadata<Foo> finds it by
+    void emitMetadata(std::ostream& os, const ast::nodes::Enum& node);
+    void emitMetadata(std::ostream& os, const ast::nodes::Bitfield& node);
+
+    // must follow the value type, members() points into it
+    void emitMetadata(std::ostream& os, const ast::nodes::Struct& node);
+}}}
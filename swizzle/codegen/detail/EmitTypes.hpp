@@ -0,0 +1,23 @@
+#pragma once
+#include <ostream>
+
+namespace swizzle { namespace ast { namespace nodes {
+    class Bitfield;
+    class Enum;
+    class Struct;
+}}}
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    // enum class with the enum's underlying type and values
+    void emitEnum(std::ostream& os, const ast::nodes::Enum& node);
+
+    // wrapper of the bitfield's underlying integer, the same size on the wire and in
+    // memory, with constexpr mask/shift accessors per field and, when the fields fit
+    // in 64 bits of equal lanes, a Fields struct filled by fields() or unpack()
+    void emitBitfield(std::ostream& os, const ast::nodes::Bitfield& node);
+
+    // plain struct a message is fully decoded into: std::array for arrays,
+    // std::vector for vectors and a member per variable_block case type
+    void emitValueType(std::ostream& os, const ast::nodes::Struct& node);
+}}}
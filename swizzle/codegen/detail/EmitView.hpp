@@ -0,0 +1,13 @@
+#pragma once
+#include <ostream>
+
+namespace swizzle { namespace ast { namespace nodes {
+    class Struct;
+}}}
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    // FooView over an encoded Foo: accessors read each field in place at its
+    // offset, constant where the layout pass found one, nothing is copied
+    void emitView(std::ostream& os, const ast::nodes::Struct& node);
+}}}
@@ -0,0 +1,56 @@
+#pragma once
+#include <swizzle/ast/Layout.hpp>
+
+#include <boost/utility/string_view.hpp>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace ast { namespace nodes {
+    class Struct;
+    class StructField;
+    class VariableBlock;
+}}}
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    // a StructField or a VariableBlock of a Struct, what generated code
+    // reads and writes in declaration order
+    struct Member
+    {
+        const ast::nodes::StructField* Field = nullptr;     // exactly one of Field and Block is set
+        const ast::nodes::VariableBlock* Block = nullptr;
+        const ast::FieldLayout* Layout = nullptr;
+        std::string Name;                                   // C++ identifier, "variableBlock" for a block
+    };
+
+    std::vector<Member> members(const ast::nodes::Struct& structure);
+
+    // a field whose size is a constant, read and written without looking at the message
+    bool constantSize(const Member& member);
+
+    // an array or vector of scalars read and written whole, by loadRun() and
+    // storeRun(), rather than an element at a time: vectors, and arrays of
+    // at least one SSE register
+    bool scalarRun(const ast::nodes::StructField& field);
+
+    // a variable_block case: the literal selecting it, as written, and the struct it holds
+    struct Case
+    {
+        std::string Value;
+        const ast::nodes::Struct* Type = nullptr;
+    };
+
+    std::vector<Case> cases(const ast::nodes::VariableBlock& block);
+
+    // value type member holding a variable_block case of @type, "smallCase" for foo::Small
+    std::string caseMemberName(const ast::nodes::Struct& type);
+
+    // the (possibly nested, "header.count") field @path names, starting from @structure
+    const ast::nodes::StructField* resolveMember(const ast::nodes::Struct& structure, const boost::string_view& path);
+
+    // @field's type is a struct, nullptr if it isn't
+    const ast::nodes::Struct* structType(const ast::nodes::StructField& field);
+
+    // @field's type is an enum: the C++ type of its underlying integer, empty otherwise
+    std::string enumUnderlyingType(const ast::nodes::StructField& field);
+}}}
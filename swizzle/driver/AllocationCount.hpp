@@ -0,0 +1,18 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace swizzle { namespace driver {
+
+    // Per thread allocation counters. The library does not replace the
+    // global operator new, an executable that wants allocation counts does
+    // so and calls countAllocation() (the swizzle CLI does). Without that
+    // every count stays zero.
+    void countAllocation(std::size_t bytes) noexcept;
+
+    std::uint64_t threadAllocations() noexcept;
+    std::uint64_t threadAllocatedBytes() noexcept;
+
+    // true once any thread has counted an allocation
+    bool allocationsCounted() noexcept;
+}}
@@ -0,0 +1,72 @@
+#pragma once
+#include <swizzle/ast/NodeKind.hpp>
+#include <swizzle/driver/Module.hpp>
+#include <swizzle/driver/Phase.hpp>
+#include <swizzle/lexer/TokenizerStatesPack.hpp>
+#include <swizzle/parser/ParserStatesPack.hpp>
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+
+namespace swizzle { namespace driver {
+
+    // Where the time and memory of a build went: per Phase wall/CPU time and
+    // allocations summed over all modules (phases of different modules run
+    // in parallel, so the sums can exceed the elapsed time), throughput,
+    // peak RSS and AST nodes per ast::nodes kind. Builds with
+    // SWIZZLE_STATE_STATS can also report the lexer and parser states the
+    // time went to.
+    class BuildReport
+    {
+    public:
+        struct Sections
+        {
+            bool Time = true;
+            bool Memory = true;
+            bool States = false;
+        };
+
+        // add the phases, size and AST of @module
+        void add(const Module& module);
+
+        PhaseStats& phase(const Phase p) { return phases_[p]; }
+        const PhaseStats& phase(const Phase p) const { return phases_[p]; }
+
+        void elapsed(double seconds) { elapsedSeconds_ = seconds; }
+        double elapsed() const { return elapsedSeconds_; }
+
+        // human readable tables
+        void print(std::ostream& os, const Sections& sections) const;
+
+        // the same as a JSON object
+        void printJson(std::ostream& os, const Sections& sections) const;
+
+        std::uint64_t files() const { return files_; }
+        std::uint64_t tokens() const { return tokens_; }
+        std::uint64_t nodes() const { return nodes_; }
+        std::uint64_t nodes(const ast::NodeKind kind) const { return nodesByKind_[static_cast<std::size_t>(kind)]; }
+        std::uint64_t nodeBytes() const { return nodeBytes_; }     // sizeof() of every node, not what they point to
+        std::uint64_t bytes() const { return bytes_; }
+
+        const lexer::TokenizerStateStats& tokenizerStats() const { return tokenizerStats_; }
+        const parser::ParserStateStats& parserStats() const { return parserStats_; }
+
+    private:
+        PhaseTimes phases_;
+        double elapsedSeconds_ = 0;
+
+        std::uint64_t files_ = 0;
+        std::uint64_t bytes_ = 0;
+        std::uint64_t tokens_ = 0;
+        std::uint64_t nodes_ = 0;
+        std::uint64_t nodeBytes_ = 0;
+        std::array<std::uint64_t, ast::NodeKindCount> nodesByKind_ {};
+
+        lexer::TokenizerStateStats tokenizerStats_;
+        parser::ParserStateStats parserStats_;
+    };
+
+    // peak resident set size of this process in bytes, 0 where that is not available
+    std::uint64_t peakResidentSetSize();
+}}
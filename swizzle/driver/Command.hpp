@@ -0,0 +1,28 @@
+#pragma once
+#include <swizzle/driver/BuildReport.hpp>
+#include <swizzle/driver/Driver.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <ostream>
+#include <vector>
+
+namespace swizzle { namespace driver {
+
+    // one invocation of the compiler: what to compile and which outputs to write
+    struct Command
+    {
+        std::vector<boost::filesystem::path> Files;
+
+        boost::filesystem::path EmitAst;        // directory for <module>.swzast binary ASTs, empty for none
+        boost::filesystem::path EmitCpp;        // directory for <module>.hpp C++ codecs (codegen::generateCpp()), empty for none
+        boost::filesystem::path Depfile;        // Makefile rules for the outputs, requires EmitAst or EmitCpp
+    };
+
+    // compile @command.Files with @driver and write the requested outputs,
+    // only outputs whose contents changed are rewritten. Errors are written
+    // to @errors, one per line. Timing and memory use go to @report if given.
+    //
+    // @return true on success
+    bool runCommand(Driver& driver, const Command& command, std::ostream& errors, BuildReport* report = nullptr);
+}}
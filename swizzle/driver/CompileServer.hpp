@@ -0,0 +1,61 @@
+#pragma once
+#include <swizzle/driver/Command.hpp>
+#include <swizzle/driver/Driver.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+
+namespace swizzle { namespace driver {
+
+    // Resident compiler. Listens on a Unix domain socket and runs every
+    // request with one long lived Driver, so parsed modules stay warm in its
+    // ModuleCache between builds and a build system invocation costs a
+    // connect instead of a process start and a parse of every import.
+    // Inputs are re-read and hashed on each request, changed modules (and
+    // importers of changed interfaces) are reparsed, the rest is reused.
+    //
+    // One request per connection. Connections are served concurrently, and a
+    // request that has not fully arrived within the request timeout is
+    // dropped, so a stalled client cannot hold up other build jobs. Builds
+    // share the Driver and its cache, so they run one at a time, each on the
+    // Driver's thread pool. Newline separated:
+    //
+    //  client  "compile", then "file <path>", "emit-ast <dir>", "emit-cpp <dir>", "depfile <path>" lines, then an empty line
+    //          or "shutdown" and an empty line
+    //  server  "error <message>" lines then "status 0" (success) or "status 1"
+    //
+    // Paths should be absolute, the server does not share the client's
+    // working directory.
+    class CompileServer
+    {
+    public:
+        // throws if another server is already listening on @socket
+        CompileServer(const DriverOptions& options, const boost::filesystem::path& socket,
+                      const std::chrono::milliseconds& requestTimeout = std::chrono::seconds(10));
+        ~CompileServer();
+
+        CompileServer(const CompileServer&) = delete;
+        CompileServer& operator=(const CompileServer&) = delete;
+
+        // serve requests until a client asks for shutdown, then wait for the
+        // connections still being served
+        void run();
+
+        const Driver& driver() const { return driver_; }
+
+    private:
+        struct Listener;
+
+        Driver driver_;
+        const boost::filesystem::path socket_;
+        std::unique_ptr<Listener> listener_;
+    };
+
+    // client side of CompileServer. Errors reported by the server are
+    // copied to @errors. @return true if the command succeeded
+    bool sendCommand(const boost::filesystem::path& socket, const Command& command, std::ostream& errors);
+    void sendShutdown(const boost::filesystem::path& socket);
+}}
@@ -0,0 +1,51 @@
+#pragma once
+#include <boost/filesystem/path.hpp>
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace swizzle { namespace driver {
+
+    // what the previous build learned about one module
+    struct DependencyRecord
+    {
+        std::uint64_t ContentHash = 0;                  // Hash of the file bytes
+        std::uint64_t InterfaceHash = 0;                // Module::interfaceHash(), covering its imports
+        std::vector<boost::filesystem::path> Imports;   // relative to the import root
+    };
+
+    // Persistent module -> DependencyRecord map used for incremental builds.
+    // Stored as a small line oriented text file:
+    //
+    //  swizzle-deps 1
+    //  module foo/Bar.swizzle
+    //  content 0123456789abcdef
+    //  interface 0123456789abcdef
+    //  import foo/Base.swizzle
+    //  end
+    //
+    // The database is only read during a build and updated once it is done.
+    class DependencyDatabase
+    {
+    public:
+        // a missing, unreadable or out of date file yields an empty database,
+        // which just means everything is rebuilt
+        void load(const boost::filesystem::path& file);
+
+        // written with writeIfChanged(), an interrupted build never leaves a
+        // truncated database behind
+        void save(const boost::filesystem::path& file) const;
+
+        // nullptr if @module was not part of a previous build
+        const DependencyRecord* find(const boost::filesystem::path& module) const;
+
+        void update(const boost::filesystem::path& module, const DependencyRecord& record);
+        void erase(const boost::filesystem::path& module);
+
+        std::size_t size() const { return records_.size(); }
+
+    private:
+        std::map<boost::filesystem::path, DependencyRecord> records_;
+    };
+}}
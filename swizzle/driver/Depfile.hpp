@@ -0,0 +1,26 @@
+#pragma once
+#include <swizzle/driver/Driver.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace driver {
+
+    // module -> the modules it imports directly, keys as in ModuleMap
+    using ImportGraph = std::map<boost::filesystem::path, std::vector<boost::filesystem::path>>;
+
+    ImportGraph importGraph(const ModuleMap& modules);
+
+    // @module and every module it imports, directly or not, as keys of @graph
+    std::vector<boost::filesystem::path> transitiveImports(const ImportGraph& graph, const boost::filesystem::path& module);
+
+    // @module and every module it imports, directly or not, as keys of @modules
+    std::vector<boost::filesystem::path> transitiveImports(const ModuleMap& modules, const boost::filesystem::path& module);
+
+    // one Makefile rule "targets: dependencies", the format Ninja reads with
+    // deps = gcc. Spaces, '#' and '$' in paths are escaped.
+    std::string makeRule(const std::vector<boost::filesystem::path>& targets, const std::vector<boost::filesystem::path>& dependencies);
+}}
@@ -0,0 +1,52 @@
+#pragma once
+#include <swizzle/driver/DriverOptions.hpp>
+#include <swizzle/driver/Module.hpp>
+#include <swizzle/driver/ModuleCache.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace swizzle { namespace driver {
+
+    // @key is the module path relative to the import root
+    using ModuleMap = std::map<boost::filesystem::path, std::shared_ptr<Module>>;
+
+    // Compiles a set of files and everything they import. Files are loaded
+    // and tokenized concurrently as the import graph is discovered, each
+    // file is parsed on the thread pool as soon as all of its imports have
+    // been parsed. A module only reads the (finished) ASTs of its imports,
+    // so type information is shared without locking.
+    //
+    // With DriverOptions::DependencyDatabase set, modules whose content and
+    // imported interfaces are unchanged since the previous build are left
+    // alone (Module::changed() is false), and are only parsed when a changed
+    // module that imports them needs their declarations.
+    //
+    // With DriverOptions::CacheSize set, a module parsed by an earlier
+    // compile() is reused as long as its file content is the same and the
+    // interfaces of its imports match what it was parsed against.
+    class Driver
+    {
+    public:
+        explicit Driver(const DriverOptions& options);
+
+        // returns once every module has been parsed, found up to date or has failed, failures
+        // (including import cycles) are reported through Module::error()
+        ModuleMap compile(const std::vector<boost::filesystem::path>& files);
+
+        // the ModuleMap key of @file (a path as given on the command line)
+        boost::filesystem::path key(const boost::filesystem::path& file) const;
+
+        const DriverOptions& options() const { return options_; }
+        const boost::filesystem::path& importRoot() const { return importRoot_; }
+        const ModuleCache& cache() const { return cache_; }
+
+    private:
+        DriverOptions options_;
+        boost::filesystem::path importRoot_;    // absolute
+        ModuleCache cache_;
+    };
+}}
@@ -0,0 +1,27 @@
+#pragma once
+#include <boost/filesystem/path.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace swizzle { namespace driver {
+
+    struct DriverOptions
+    {
+        boost::filesystem::path ImportRoot;     // import statements resolve relative to this, empty is the working directory
+        std::size_t Threads = 0;                // worker threads, 0 is one per hardware thread
+
+        // incremental builds: where to keep the DependencyDatabase between
+        // runs. Empty disables incremental builds, every module is parsed.
+        boost::filesystem::path DependencyDatabase;
+
+        // parsed modules kept in memory between Driver::compile() calls, 0
+        // keeps none. Only worth setting for a long running driver.
+        std::size_t CacheSize = 0;
+
+        // runCommand(): directory of an OutputCache shared between builds,
+        // empty for none, and the bound on its size
+        boost::filesystem::path OutputCache;
+        std::uint64_t OutputCacheSize = 1024ULL * 1024 * 1024;
+    };
+}}
@@ -0,0 +1,50 @@
+#pragma once
+#include <boost/filesystem/path.hpp>
+
+#include <chrono>
+#include <map>
+#include <ostream>
+#include <vector>
+
+namespace swizzle { namespace driver {
+
+    // Reports changes to .swizzle files below a directory, using inotify.
+    // Subdirectories are watched as well, including ones created later.
+    // Only available on Linux, the constructor throws elsewhere.
+    // A subdirectory that can't be watched is reported to @log and skipped.
+    class FileWatcher
+    {
+    public:
+        FileWatcher(const boost::filesystem::path& directory, std::ostream& log);
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        // Block up to @timeout for a .swizzle file to be written, created,
+        // moved or removed, then keep collecting until nothing has changed
+        // for @settle so a burst of editor saves is reported once. Each
+        // changed file is listed once. Empty if @timeout expired. When events
+        // were lost (the inotify queue overflowed, or a watched directory was
+        // removed) the tree is rescanned and every .swizzle file is listed.
+        std::vector<boost::filesystem::path> wait(std::chrono::milliseconds timeout, std::chrono::milliseconds settle);
+
+    private:
+        void add(const boost::filesystem::path& directory);
+
+        // add() a subdirectory and list its .swizzle files in @changed, logging a failure
+        void addBelow(const boost::filesystem::path& directory, std::vector<boost::filesystem::path>* changed);
+
+        // watch any directory not watched yet and list every .swizzle file in @changed
+        void rescan(std::vector<boost::filesystem::path>& changed);
+
+        // drain pending events into @changed, false if nothing arrived within @timeout
+        bool read(std::chrono::milliseconds timeout, std::vector<boost::filesystem::path>& changed);
+
+    private:
+        int fd_;
+        std::ostream& log_;
+        const boost::filesystem::path root_;
+        std::map<int, boost::filesystem::path> directories_;    // watch descriptor -> directory
+    };
+}}
@@ -0,0 +1,21 @@
+#pragma once
+#include <boost/utility/string_view.hpp>
+
+#include <cstdint>
+
+namespace swizzle { namespace driver {
+
+    // 64 bit FNV-1a. Stable across runs and platforms, which std::hash is
+    // not, so values can be persisted between builds.
+    class Hash
+    {
+    public:
+        Hash& update(const boost::string_view& bytes);
+        Hash& update(std::uint64_t value);
+
+        std::uint64_t value() const { return value_; }
+
+    private:
+        std::uint64_t value_ = 14695981039346656037ULL;
+    };
+}}
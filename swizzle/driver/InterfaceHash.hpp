@@ -0,0 +1,14 @@
+#pragma once
+#include <swizzle/ast/AbstractSyntaxTree.hpp>
+
+#include <cstdint>
+
+namespace swizzle { namespace driver {
+
+    // hash of the declarations @ast exports to importers (Struct, Enum,
+    // Bitfield and TypeAlias, including their fields, attributes and
+    // default values). Comments and source positions are not part of the
+    // interface, so reformatting a file or editing its comments does not
+    // change the hash.
+    std::uint64_t interfaceHash(const ast::AbstractSyntaxTree& ast);
+}}
@@ -0,0 +1,114 @@
+#pragma once
+#include <swizzle/ast/AbstractSyntaxTree.hpp>
+#include <swizzle/driver/DependencyDatabase.hpp>
+#include <swizzle/driver/Phase.hpp>
+#include <swizzle/lexer/TokenInfo.hpp>
+#include <swizzle/lexer/TokenizerStatesPack.hpp>
+#include <swizzle/parser/Parser.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace driver {
+
+    // one .swizzle file and everything the driver knows about it. A module
+    // is loaded (read, tokenized, imports scanned) then parsed once the
+    // modules it imports have been parsed. In an incremental build a module
+    // whose content matches the previous build is not tokenized, its imports
+    // come from the previous DependencyRecord, and it is only parsed if a
+    // changed module importing it needs its AST.
+    class Module
+    {
+    public:
+        // @path is relative to @importRoot, which is how imports refer to it
+        Module(const boost::filesystem::path& path, const boost::filesystem::path& importRoot);
+
+        Module(const Module&) = delete;
+        Module& operator=(const Module&) = delete;
+
+        // read and tokenize the file, collect its imports. @previous is this
+        // module's record from the previous build (or nullptr).
+        void load(const DependencyRecord* previous = nullptr);
+
+        // parse the tokens, the types declared in @imports are visible to the
+        // parser. The AST refers into @imports, they are kept alive with it.
+        void parse(const std::vector<std::shared_ptr<const Module>>& imports);
+
+        // record an error, the module is not parsed
+        void fail(const std::string& error);
+
+        const boost::filesystem::path& path() const { return path_; }
+        const std::vector<boost::filesystem::path>& imports() const { return imports_; }
+
+        const ast::AbstractSyntaxTree& ast() const { return parser_.ast(); }
+        bool parsed() const { return parsed_; }
+
+        // file bytes differ from the previous build
+        bool contentChanged() const;
+
+        // exported declarations differ from the previous build, importers must be reparsed
+        bool interfaceChanged() const;
+
+        // outputs of this module are out of date: its content or the interface
+        // of something it imports changed. Decided by the driver.
+        bool changed() const { return changed_; }
+        void changed(bool value) { changed_ = value; }
+
+        std::uint64_t contentHash() const { return contentHash_; }
+        // driver::interfaceHash() of the AST combined with interfaceHash() of each
+        // import, so it changes with anything the module transitively imports
+        std::uint64_t interfaceHash() const { return interfaceHash_; }
+
+        // interfaceHash() of each import when this module was parsed
+        const std::vector<std::uint64_t>& importedInterfaces() const { return importedInterfaces_; }
+
+        // what to remember about this module for the next build
+        DependencyRecord record() const;
+
+        // cost of the work done on this module (a module reused from a
+        // ModuleCache reports the work done when it was parsed)
+        const PhaseTimes& phases() const { return phases_; }
+        std::size_t sourceSize() const { return source_.size(); }
+        std::size_t tokenCount() const { return tokenCount_; }
+
+        // per state counters of the lexer and parser, empty unless built with SWIZZLE_STATE_STATS
+        const lexer::TokenizerStateStats& tokenizerStats() const { return tokenizerStats_; }
+        const parser::ParserStateStats& parserStats() const { return parser_.stats(); }
+
+        bool failed() const { return !error_.empty(); }
+        const std::string& error() const { return error_; }
+
+    private:
+        void tokenize();
+
+    private:
+        const boost::filesystem::path path_;
+        const boost::filesystem::path importRoot_;
+
+        std::string source_;                        // tokens and the AST view into this
+        std::deque<lexer::TokenInfo> tokens_;
+        std::vector<boost::filesystem::path> imports_;
+        bool tokenized_ = false;
+        std::size_t tokenCount_ = 0;
+        PhaseTimes phases_;
+        lexer::TokenizerStateStats tokenizerStats_;
+
+        DependencyRecord previous_;
+        bool hasPrevious_ = false;
+        std::uint64_t contentHash_ = 0;
+        std::uint64_t interfaceHash_ = 0;
+        bool parsed_ = false;
+        bool changed_ = true;
+
+        std::vector<std::shared_ptr<const Module>> imported_;
+        std::vector<std::uint64_t> importedInterfaces_;
+
+        parser::Parser parser_;
+        std::string error_;
+    };
+}}
@@ -0,0 +1,42 @@
+#pragma once
+#include <swizzle/driver/Module.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <memory>
+
+namespace swizzle { namespace driver {
+
+    // Least recently used cache of parsed modules, lets a long running
+    // Driver reuse ASTs between compiles. Bounded by number of modules; a
+    // cached module keeps the modules it imports alive, so an evicted module
+    // is only freed once nothing cached imports it.
+    //
+    // find() may be called concurrently, insert() and erase() may not.
+    class ModuleCache
+    {
+    public:
+        // @capacity == 0 disables the cache
+        explicit ModuleCache(std::size_t capacity);
+
+        // nullptr if @path is not cached, does not change the LRU order
+        std::shared_ptr<Module> find(const boost::filesystem::path& path) const;
+
+        // insert or replace @path and make it the most recently used
+        void insert(const boost::filesystem::path& path, const std::shared_ptr<Module>& module);
+        void erase(const boost::filesystem::path& path);
+
+        std::size_t size() const { return entries_.size(); }
+        std::size_t capacity() const { return capacity_; }
+
+    private:
+        using Entry = std::pair<boost::filesystem::path, std::shared_ptr<Module>>;
+
+        const std::size_t capacity_;
+        std::list<Entry> entries_;    // most recently used first
+        std::map<boost::filesystem::path, std::list<Entry>::iterator> index_;
+    };
+}}
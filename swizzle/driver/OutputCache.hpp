@@ -0,0 +1,58 @@
+#pragma once
+#include <swizzle/driver/DependencyDatabase.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace swizzle { namespace driver {
+
+    // A ccache like store of compiler outputs in a directory that any number
+    // of builds (and parallel build jobs) share. Two kinds of entries, each
+    // a file named after its 64 bit key:
+    //
+    //  manifest    what a module with given content imports and its interface
+    //              hash, so a build can find the import graph without lexing
+    //  artifacts   the outputs generated for a module
+    //
+    // Entries are written to a temporary file and renamed into place, so a
+    // reader sees a whole entry or none. A hit refreshes the entry's
+    // modification time, trim() drops the least recently used entries once
+    // the directory outgrows its size. Unreadable or corrupt entries are
+    // misses.
+    class OutputCache
+    {
+    public:
+        // output path relative to the output directory, bytes
+        using Artifacts = std::vector<std::pair<std::string, std::string>>;
+
+        // @maxBytes bounds the size of the entries in @directory
+        OutputCache(const boost::filesystem::path& directory, std::uint64_t maxBytes);
+
+        bool find(std::uint64_t key, DependencyRecord& manifest) const;
+        void insert(std::uint64_t key, const DependencyRecord& manifest);
+
+        bool find(std::uint64_t key, Artifacts& artifacts) const;
+        void insert(std::uint64_t key, const Artifacts& artifacts);
+
+        // bytes of the entries on disk
+        std::uint64_t size() const;
+
+        // remove least recently used entries until size() is at most 90% of
+        // the bound, cheap when nothing has been inserted since the last trim
+        void trim();
+
+        const boost::filesystem::path& directory() const { return directory_; }
+
+    private:
+        boost::filesystem::path entry(std::uint64_t key, const char* kind) const;
+
+    private:
+        boost::filesystem::path directory_;
+        std::uint64_t maxBytes_;
+        std::uint64_t inserted_ = 0;
+    };
+}}
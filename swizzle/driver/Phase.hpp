@@ -0,0 +1,45 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+namespace swizzle { namespace driver {
+
+    // the stages a module goes through, Validate is Parser::finalize()
+    // (most semantic checks run while parsing), Codegen is writing outputs
+    enum class Phase : std::uint8_t {
+        Load,
+        Lex,
+        Parse,
+        Validate,
+        Codegen,
+    };
+
+    static constexpr std::size_t PhaseCount = static_cast<std::size_t>(Phase::Codegen) + 1;
+
+    std::ostream& operator<<(std::ostream& os, const Phase phase);
+
+    struct PhaseStats
+    {
+        double WallSeconds = 0;
+        double CpuSeconds = 0;              // CPU time of the thread running the phase
+        std::uint64_t Allocations = 0;      // see AllocationCount.hpp
+        std::uint64_t AllocatedBytes = 0;
+
+        PhaseStats& operator+=(const PhaseStats& other);
+    };
+
+    // PhaseStats for every Phase
+    class PhaseTimes
+    {
+    public:
+        PhaseStats& operator[](const Phase phase) { return phases_[static_cast<std::size_t>(phase)]; }
+        const PhaseStats& operator[](const Phase phase) const { return phases_[static_cast<std::size_t>(phase)]; }
+
+        PhaseTimes& operator+=(const PhaseTimes& other);
+
+    private:
+        std::array<PhaseStats, PhaseCount> phases_;
+    };
+}}
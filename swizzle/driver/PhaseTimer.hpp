@@ -0,0 +1,31 @@
+#pragma once
+#include <swizzle/driver/Phase.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+namespace swizzle { namespace driver {
+
+    // adds the wall time, thread CPU time and allocations between
+    // construction and destruction to @stats
+    class PhaseTimer
+    {
+    public:
+        explicit PhaseTimer(PhaseStats& stats);
+        ~PhaseTimer();
+
+        PhaseTimer(const PhaseTimer&) = delete;
+        PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+    private:
+        PhaseStats& stats_;
+
+        std::chrono::steady_clock::time_point wall_;
+        double cpu_;
+        std::uint64_t allocations_;
+        std::uint64_t allocatedBytes_;
+    };
+
+    // CPU time consumed by the calling thread, 0 where that is not available
+    double threadCpuSeconds();
+}}
@@ -0,0 +1,14 @@
+#pragma once
+#include <swizzle/lexer/TokenInfo.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <deque>
+#include <vector>
+
+namespace swizzle { namespace driver {
+
+    // the files named by the import statements in @tokens, relative to the
+    // import root. Lets the import graph be built without parsing.
+    std::vector<boost::filesystem::path> scanImports(const std::deque<lexer::TokenInfo>& tokens);
+}}
@@ -0,0 +1,41 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace swizzle { namespace driver {
+
+    // fixed size pool of worker threads running posted tasks in FIFO order.
+    // The destructor finishes the queued tasks before joining.
+    class ThreadPool
+    {
+    public:
+        using Task = std::function<void()>;
+
+        // @threads == 0 uses std::thread::hardware_concurrency()
+        explicit ThreadPool(std::size_t threads);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        void post(Task task);
+
+        std::size_t size() const { return threads_.size(); }
+
+    private:
+        void run();
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable ready_;
+        std::deque<Task> tasks_;
+        bool stopping_;
+
+        std::vector<std::thread> threads_;
+    };
+}}
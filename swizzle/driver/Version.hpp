@@ -0,0 +1,9 @@
+#pragma once
+
+namespace swizzle { namespace driver {
+
+    // identifies this build of the compiler in OutputCache keys: the hash of
+    // the library's sources the CMake build regenerates on every build
+    // (_cmake/SourceHash.cmake), otherwise the time the driver was compiled
+    const char* compilerVersion();
+}}
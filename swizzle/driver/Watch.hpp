@@ -0,0 +1,28 @@
+#pragma once
+#include <swizzle/driver/Command.hpp>
+#include <swizzle/driver/Driver.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <chrono>
+#include <functional>
+#include <ostream>
+
+namespace swizzle { namespace driver {
+
+    struct WatchOptions
+    {
+        std::chrono::milliseconds Settle = std::chrono::milliseconds(30);   // quiet period that ends a burst of saves
+        std::chrono::milliseconds Poll = std::chrono::milliseconds(250);    // how often @stop is checked
+    };
+
+    // Run @command, then run it again every time a .swizzle file below
+    // @directory changes, until @stop returns true. With no files in
+    // @command every .swizzle file below @directory is compiled (found
+    // again each round, so new files are picked up). @driver should have a
+    // ModuleCache: unchanged modules are then reused and only changed files
+    // and importers of changed interfaces are re-lexed and reparsed.
+    //
+    // The outcome of every round is written to @log.
+    void watch(Driver& driver, const Command& command, const boost::filesystem::path& directory, std::ostream& log, const std::function<bool()>& stop, const WatchOptions& options = WatchOptions());
+}}
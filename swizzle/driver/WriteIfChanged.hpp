@@ -0,0 +1,15 @@
+#pragma once
+#include <boost/filesystem/path.hpp>
+#include <boost/utility/string_view.hpp>
+
+namespace swizzle { namespace driver {
+
+    // Replace @file with @contents unless it already holds exactly those
+    // bytes, so unchanged outputs keep their timestamps and do not trigger
+    // downstream rebuilds. New contents are written to a temporary file in
+    // the same directory and renamed into place, readers never see a
+    // partial file. Missing parent directories are created.
+    //
+    // @return true if the file was written
+    bool writeIfChanged(const boost::filesystem::path& file, const boost::string_view& contents);
+}}
@@ -35,6 +35,12 @@ namespace swizzle { namespace lexer {
             fileInfo_ = this->produceToken(token_, fileInfo_);
         }
 
+        // per state counters, empty unless built with SWIZZLE_STATE_STATS
+        const TokenizerStateStats& stats() const
+        {
+            return states_.stats();
+        }
+
     private:
         std::string filename_;
         TokenizerStatesPack<CreateTokenCallback> states_;
@@ -1,4 +1,5 @@
 #pragma once 
+#include <cstddef>
 #include <cstdint>
 #include <ostream>
 
@@ -23,5 +24,7 @@ namespace swizzle { namespace lexer {
         AttributeBlock,
     };
 
+    static constexpr std::size_t TokenizerStateCount = static_cast<std::size_t>(TokenizerState::AttributeBlock) + 1;
+
     std::ostream& operator<<(std::ostream& os, const TokenizerState state);
 }}
@@ -20,13 +20,16 @@
 #include <swizzle/lexer/FileInfo.hpp>
 #include <swizzle/lexer/Token.hpp>
 #include <swizzle/lexer/TokenizerState.hpp>
-
+#include <swizzle/profile/CycleCounter.hpp>
+#include <swizzle/profile/StateStats.hpp>
 
 #include <boost/utility/string_view.hpp>
 #include <cstddef>
 
 namespace swizzle { namespace lexer {
 
+    using TokenizerStateStats = profile::StateStats<TokenizerState, TokenizerStateCount>;
+
     template<class CreateTokenCallback>
     class TokenizerStatesPack
     {
@@ -53,6 +56,40 @@ namespace swizzle { namespace lexer {
 
         TokenizerState consume(const TokenizerState state, const boost::string_view& source, const std::size_t position, FileInfo& fileInfo, Token& token)
         {
+#if defined(SWIZZLE_STATE_STATS)
+            const auto start = profile::cycles();
+
+            try
+            {
+                const auto next = dispatch(state, source, position, fileInfo, token);
+                stats_.transition(state, profile::cycles() - start);
+
+                return next;
+            }
+            catch(...)
+            {
+                stats_.exception(state, profile::cycles() - start);
+                throw;
+            }
+#else
+            return dispatch(state, source, position, fileInfo, token);
+#endif
+        }
+
+        // empty unless built with SWIZZLE_STATE_STATS
+        const TokenizerStateStats& stats() const
+        {
+#if defined(SWIZZLE_STATE_STATS)
+            return stats_;
+#else
+            static const TokenizerStateStats empty;
+            return empty;
+#endif
+        }
+
+    private:
+        TokenizerState dispatch(const TokenizerState state, const boost::string_view& source, const std::size_t position, FileInfo& fileInfo, Token& token)
+        {
             switch(state)
             {
             case TokenizerState::Init:                          return init_.consume(source, position, fileInfo, token);
@@ -79,6 +116,10 @@ namespace swizzle { namespace lexer {
         }
 
     private:
+#if defined(SWIZZLE_STATE_STATS)
+        TokenizerStateStats stats_;
+#endif
+
         states::InitState<CreateTokenCallback> init_;
         states::FirstSlashState<CreateTokenCallback> firstSlash_;
         states::CommentState<CreateTokenCallback> comment_;
@@ -7,6 +7,8 @@
 #include <swizzle/parser/ParserStatesPack.hpp>
 #include <swizzle/parser/TokenStack.hpp>
 
+#include <boost/filesystem/path.hpp>
+
 namespace swizzle { namespace lexer {
     class TokenInfo;
 }}
@@ -18,6 +20,17 @@ namespace swizzle { namespace parser {
     public:
         Parser();
 
+        // resolve import statements relative to @importRoot rather than the working directory
+        explicit Parser(const boost::filesystem::path& importRoot);
+
+        // context_ refers into ast_, copies would share state
+        Parser(const Parser&) = delete;
+        Parser& operator=(const Parser&) = delete;
+
+        // make the types declared in @module visible to this parser, call before
+        // consume(). @module is not copied and must outlive this parser.
+        void import(const ast::AbstractSyntaxTree& module);
+
         // parse token
         void consume(const lexer::TokenInfo& token);
 
@@ -27,6 +40,9 @@ namespace swizzle { namespace parser {
         // return the AST
         const ast::AbstractSyntaxTree& ast() const;
 
+        // per state counters, empty unless built with SWIZZLE_STATE_STATS
+        const ParserStateStats& stats() const;
+
     private:
         ParserStatesPack states_;
         ParserState state_;
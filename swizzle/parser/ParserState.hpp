@@ -1,4 +1,5 @@
 #pragma once 
+#include <cstddef>
 #include <cstdint>
 #include <ostream>
 
@@ -69,5 +70,7 @@ namespace swizzle { namespace parser {
         StructVariableBlockNamespaceSecondColonRead,
     };
 
+    static constexpr std::size_t ParserStateCount = static_cast<std::size_t>(ParserState::StructVariableBlockNamespaceSecondColonRead) + 1;
+
     std::ostream& operator<<(std::ostream& os, const ParserState state);
 }}
@@ -3,12 +3,18 @@
 #include <swizzle/types/EnumValue.hpp>
 #include <swizzle/types/EnumValueType.hpp>
 
+#include <boost/filesystem/path.hpp>
+
 #include <cstddef>
 #include <string>
 #include <limits>
 #include <unordered_map>
 #include <unordered_set>
 
+namespace swizzle { namespace ast {
+    class NodeIndex;
+}}
+
 namespace swizzle { namespace lexer {
     class TokenInfo;
 }}
@@ -17,9 +23,15 @@ namespace swizzle { namespace parser {
 
     struct ParserStateContext
     {
-        std::unordered_map<std::string, ast::Node::smartptr> TypeCache; // @key is type name with namespace prefix
-        ast::Node::smartptr CurrentVariableOnFieldType = nullptr;       // the pointer to the field we're variable on, so we can query the type
+        std::unordered_map<std::string, ast::Node*> TypeCache;          // @key is type name with namespace prefix, not owning. Entries
+                                                                        // belong to the AST being parsed or to an imported module, raw
+                                                                        // pointers keep lookups free of (non-atomic) ref count traffic.
+        ast::Node* CurrentVariableOnFieldType = nullptr;                // the field we're variable on, so we can query the type (not owning)
+
+        ast::NodeIndex* Index = nullptr;                                // when set, every node the parser creates is recorded here
+        void IndexNode(const ast::Node::smartptr& node);
 
+        boost::filesystem::path ImportRoot;                             // imports are resolved relative to this, empty is the working directory
         std::string CurrentNamespace;
         std::intmax_t CurrentBitfieldBit = std::numeric_limits<std::intmax_t>::lowest();
 
@@ -1,6 +1,7 @@
 #pragma once 
 
 #include <swizzle/lexer/TokenInfo.hpp>
+#include <swizzle/profile/StateStats.hpp>
 #include <swizzle/parser/ParserState.hpp>
 #include <swizzle/parser/NodeStack.hpp>
 #include <swizzle/parser/ParserStateContext.hpp>
@@ -71,12 +72,23 @@
 
 namespace swizzle { namespace parser {
 
+    using ParserStateStats = profile::StateStats<ParserState, ParserStateCount>;
+
     class ParserStatesPack
     {
     public:
         ParserState consume(const ParserState state, const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack& attributeStack, TokenStack& tokenStack, ParserStateContext& context);
 
+        // empty unless built with SWIZZLE_STATE_STATS
+        const ParserStateStats& stats() const;
+
+    private:
+        ParserState dispatch(const ParserState state, const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack& attributeStack, TokenStack& tokenStack, ParserStateContext& context);
+
     private:
+#if defined(SWIZZLE_STATE_STATS)
+        ParserStateStats stats_;
+#endif
 
         states::InitState initState_;
         states::StartNamespaceState startNamespaceState_;
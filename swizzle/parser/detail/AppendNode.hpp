@@ -1,5 +1,6 @@
 #pragma once
 #include <swizzle/parser/NodeStack.hpp>
+#include <swizzle/parser/ParserStateContext.hpp>
 #include <swizzle/ast/Node.hpp>
 
 namespace swizzle { namespace parser { namespace detail {
@@ -14,4 +15,14 @@ namespace swizzle { namespace parser { namespace detail {
 
         return node;
     }
+
+    // as above, and record the node in the parse's per-kind index
+    template<class Node, typename... Args>
+    ast::Node::smartptr appendNode(ParserStateContext& context, NodeStack& nodeStack, Args&&... args)
+    {
+        auto node = appendNode<Node>(nodeStack, std::forward<Args>(args)...);
+        context.IndexNode(node);
+
+        return node;
+    }
 }}}
@@ -16,5 +16,5 @@ namespace swizzle { namespace parser { namespace detail {
     // up the variable block size argument all exist and are of the correct
     // types.
     // @returns a pointer to the ast::nodes::StructField so the type can be queried
-    ast::Node::smartptr validateVariableBlockSizeMember(const lexer::TokenInfo& token, const NodeStack& nodeStack, const TokenStack& tokenStack, const ParserStateContext& context);
+    ast::Node* validateVariableBlockSizeMember(const lexer::TokenInfo& token, const NodeStack& nodeStack, const TokenStack& tokenStack, const ParserStateContext& context);
 }}}
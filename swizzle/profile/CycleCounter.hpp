@@ -0,0 +1,24 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace swizzle { namespace profile {
+
+    // cheap monotonic tick count for timing very short sections: the time
+    // stamp counter on x86, steady_clock ticks elsewhere. Only differences
+    // between two readings on the same thread are meaningful.
+    inline std::uint64_t cycles()
+    {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+}}
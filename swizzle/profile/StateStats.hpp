@@ -0,0 +1,142 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+namespace swizzle { namespace profile {
+
+    // Per state counters for a state machine whose states are the enum
+    // @State with @Count values: how often each state consumed input, how
+    // many cycles (profile::cycles()) it spent doing so and how often it
+    // threw. Filled in by the lexer and parser state packs when built with
+    // SWIZZLE_STATE_STATS, otherwise always empty.
+    template<class State, std::size_t Count>
+    class StateStats
+    {
+    public:
+        struct Counters
+        {
+            std::uint64_t Transitions = 0;
+            std::uint64_t Cycles = 0;
+            std::uint64_t Exceptions = 0;
+        };
+
+#if defined(SWIZZLE_STATE_STATS)
+        static constexpr bool Enabled = true;
+#else
+        static constexpr bool Enabled = false;
+#endif
+
+        void transition(const State state, const std::uint64_t cycles)
+        {
+            auto& counters = counters_[index(state)];
+            ++counters.Transitions;
+            counters.Cycles += cycles;
+        }
+
+        void exception(const State state, const std::uint64_t cycles)
+        {
+            auto& counters = counters_[index(state)];
+            ++counters.Transitions;
+            ++counters.Exceptions;
+            counters.Cycles += cycles;
+        }
+
+        const Counters& operator[](const State state) const { return counters_[index(state)]; }
+
+        std::uint64_t transitions() const
+        {
+            std::uint64_t total = 0;
+            for(const auto& counters : counters_)
+            {
+                total += counters.Transitions;
+            }
+
+            return total;
+        }
+
+        StateStats& operator+=(const StateStats& other)
+        {
+            for(std::size_t i = 0; i < Count; ++i)
+            {
+                counters_[i].Transitions += other.counters_[i].Transitions;
+                counters_[i].Cycles += other.counters_[i].Cycles;
+                counters_[i].Exceptions += other.counters_[i].Exceptions;
+            }
+
+            return *this;
+        }
+
+        void clear()
+        {
+            counters_.fill(Counters());
+        }
+
+        // states that consumed anything, most cycles first
+        void print(std::ostream& os) const
+        {
+            std::array<std::size_t, Count> order;
+            for(std::size_t i = 0; i < Count; ++i)
+            {
+                order[i] = i;
+            }
+
+            std::sort(order.begin(), order.end(), [this](std::size_t lhs, std::size_t rhs){ return counters_[lhs].Cycles > counters_[rhs].Cycles; });
+
+            os << "  " << std::left << std::setw(48) << "state" << std::right
+                << std::setw(14) << "transitions" << std::setw(16) << "cycles" << std::setw(12) << "cycles/tr" << std::setw(12) << "exceptions" << "\n";
+
+            for(const auto i : order)
+            {
+                const auto& counters = counters_[i];
+                if(counters.Transitions == 0)
+                {
+                    continue;
+                }
+
+                std::ostringstream name;
+                name << static_cast<State>(i);
+
+                os << "  " << std::left << std::setw(48) << name.str() << std::right
+                    << std::setw(14) << counters.Transitions
+                    << std::setw(16) << counters.Cycles
+                    << std::setw(12) << (counters.Cycles / counters.Transitions)
+                    << std::setw(12) << counters.Exceptions << "\n";
+            }
+        }
+
+        // {"state": {"transitions": n, "cycles": n, "exceptions": n}, ...} for states that consumed anything
+        void printJson(std::ostream& os) const
+        {
+            os << "{";
+
+            bool first = true;
+            for(std::size_t i = 0; i < Count; ++i)
+            {
+                const auto& counters = counters_[i];
+                if(counters.Transitions == 0)
+                {
+                    continue;
+                }
+
+                os << (first ? " " : ", ") << "\"" << static_cast<State>(i) << "\": { \"transitions\": " << counters.Transitions
+                    << ", \"cycles\": " << counters.Cycles << ", \"exceptions\": " << counters.Exceptions << " }";
+                first = false;
+            }
+
+            os << " }";
+        }
+
+    private:
+        static std::size_t index(const State state) { return static_cast<std::size_t>(state); }
+
+        std::array<Counters, Count> counters_ {};
+    };
+
+    template<class State, std::size_t Count>
+    constexpr bool StateStats<State, Count>::Enabled;
+}}
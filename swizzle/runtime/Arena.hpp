@@ -0,0 +1,253 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Memory for the vectors of decoded values. An Arena hands out memory by
+// bumping a pointer through a caller's buffer, then through blocks it takes
+// from the heap once that runs out. Nothing is freed until reset(), which
+// keeps the blocks, so a replay that resets the arena per batch stops
+// allocating once it has seen its largest batch:
+//
+//   arena.reset();
+//   for(auto& message : batch) data = decode(data, end, message, &arena);
+//
+// The generated value types hold ArenaVectors, std::vectors on the heap
+// unless decode() was given an arena. They stay valid until the next reset().
+// decode() empties the variable_block cases it does not select, so nothing
+// in a value decoded after a reset() refers to memory from before it.
+namespace swizzle { namespace runtime {
+
+    class Arena
+    {
+    public:
+        // heap blocks of @blockSize bytes, and larger ones as needed
+        explicit Arena(const std::size_t blockSize = 64 * 1024)
+            : blockSize_(blockSize)
+        {
+        }
+
+        // @buffer first, then heap blocks as large as it
+        Arena(void* buffer, const std::size_t size)
+            : blockSize_(size)
+        {
+            blocks_.push_back({ static_cast<char*>(buffer), size, false });
+            reset();
+        }
+
+        ~Arena()
+        {
+            for(const auto& block : blocks_)
+            {
+                if(block.Owned)
+                {
+                    ::operator delete(block.Data);
+                }
+            }
+        }
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        // the blocks stay where they are, what was allocated stays valid
+        Arena(Arena&& other) noexcept
+            : blocks_(std::move(other.blocks_))
+            , block_(other.block_)
+            , blockSize_(other.blockSize_)
+            , current_(other.current_)
+            , end_(other.end_)
+        {
+            other.blocks_.clear();
+            other.reset();
+        }
+
+        Arena& operator=(Arena&& other) noexcept
+        {
+            std::swap(blocks_, other.blocks_);
+            std::swap(block_, other.block_);
+            std::swap(blockSize_, other.blockSize_);
+            std::swap(current_, other.current_);
+            std::swap(end_, other.end_);
+
+            return *this;
+        }
+
+        void* allocate(const std::size_t size, const std::size_t alignment)
+        {
+            auto at = align(current_, alignment);
+            if(!at || (static_cast<std::size_t>(end_ - at) < size))
+            {
+                at = next(size, alignment);
+            }
+
+            current_ = at + size;
+            return at;
+        }
+
+        // everything allocated is free again, the blocks are kept
+        void reset()
+        {
+            block_ = 0;
+            current_ = blocks_.empty() ? nullptr : blocks_[0].Data;
+            end_ = blocks_.empty() ? nullptr : blocks_[0].Data + blocks_[0].Size;
+        }
+
+        // bytes of the caller's buffer and heap blocks together
+        std::size_t capacity() const
+        {
+            std::size_t result = 0;
+            for(const auto& block : blocks_)
+            {
+                result += block.Size;
+            }
+
+            return result;
+        }
+
+    private:
+        struct Block
+        {
+            char* Data;
+            std::size_t Size;
+            bool Owned;
+        };
+
+        static char* align(char* at, const std::size_t alignment)
+        {
+            if(!at)
+            {
+                return nullptr;
+            }
+
+            const auto address = reinterpret_cast<std::uintptr_t>(at);
+            return at + ((alignment - address % alignment) % alignment);
+        }
+
+        // the first of the following blocks @size bytes fit in, or a new one
+        char* next(const std::size_t size, const std::size_t alignment)
+        {
+            while(++block_ < blocks_.size())
+            {
+                const auto& block = blocks_[block_];
+                const auto at = align(block.Data, alignment);
+
+                if(static_cast<std::size_t>(block.Data + block.Size - at) >= size)
+                {
+                    end_ = block.Data + block.Size;
+                    return at;
+                }
+            }
+
+            const auto grown = blocks_.empty() ? blockSize_ : blocks_.back().Size * 2;
+            const auto blockSize = (grown > size + alignment) ? grown : size + alignment;
+
+            blocks_.push_back({ static_cast<char*>(::operator new(blockSize)), blockSize, true });
+            block_ = blocks_.size() - 1;
+            end_ = blocks_.back().Data + blockSize;
+
+            return align(blocks_.back().Data, alignment);
+        }
+
+        std::vector<Block> blocks_;
+        std::size_t block_ = 0;
+        std::size_t blockSize_;
+        char* current_ = nullptr;
+        char* end_ = nullptr;
+    };
+
+    // allocates from an Arena, or from the heap when it has none. Elements
+    // in an arena are not destroyed, the arena is reset instead, so they must
+    // own no heap memory; decode() only ever puts arena vectors in them.
+    template<class T>
+    class ArenaAllocator
+    {
+    public:
+        using value_type = T;
+
+        // a vector follows the vector it is moved or swapped from, copies are on the heap
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        ArenaAllocator() noexcept = default;
+
+        explicit ArenaAllocator(Arena* arena) noexcept
+            : arena_(arena)
+        {
+        }
+
+        template<class U>
+        ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+            : arena_(other.arena())
+        {
+        }
+
+        T* allocate(const std::size_t count)
+        {
+            if(arena_)
+            {
+                return static_cast<T*>(arena_->allocate(count * sizeof(T), alignof(T)));
+            }
+
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+
+        void deallocate(T* pointer, const std::size_t)
+        {
+            if(!arena_)
+            {
+                ::operator delete(pointer);
+            }
+        }
+
+        template<class U>
+        void destroy(U* pointer)
+        {
+            if(!arena_)
+            {
+                pointer->~U();
+            }
+        }
+
+        ArenaAllocator select_on_container_copy_construction() const
+        {
+            return ArenaAllocator();
+        }
+
+        Arena* arena() const { return arena_; }
+
+    private:
+        Arena* arena_ = nullptr;
+    };
+
+    template<class T, class U>
+    bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) { return lhs.arena() == rhs.arena(); }
+
+    template<class T, class U>
+    bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) { return lhs.arena() != rhs.arena(); }
+
+    template<class T>
+    using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+    // @vector as @count value initialized elements in @arena, or on the heap
+    // without one. A vector is never resized in place in an arena, what it
+    // holds may have been handed out again since the last reset().
+    template<class T>
+    void resize(ArenaVector<T>& vector, const std::size_t count, Arena* arena)
+    {
+        if(!arena && !vector.get_allocator().arena())
+        {
+            vector.resize(count);
+            return;
+        }
+
+        const ArenaAllocator<T> allocator(arena);
+
+        ArenaVector<T> result(allocator);
+        result.resize(count);
+
+        vector = std::move(result);
+    }
+}}
@@ -0,0 +1,30 @@
+#pragma once
+#include <swizzle/runtime/Cpu.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// BMI2 kernels for the bulk bitfield extraction of the generated code,
+// selected at runtime with hasBmi2()
+namespace swizzle { namespace runtime {
+
+#if defined(SWIZZLE_X86_SIMD)
+    // every field of @count bitfields at once: the bits under @fields are
+    // gathered (pext) then spread into the lanes of Fields (pdep, @lanes
+    // holding each field's width at the start of its lane). Fields is
+    // sizeof(Fields) bytes of equally sized unsigned lanes, little endian
+    // as x86 is. Only call when hasBmi2().
+    template<class Bitfield, class Fields>
+    SWIZZLE_TARGET("bmi2") void spreadBitsBmi2(const Bitfield* values, const std::size_t count, const std::uint64_t fields, const std::uint64_t lanes, Fields* out)
+    {
+        static_assert(sizeof(Fields) <= sizeof(std::uint64_t), "the fields of a bitfield are spread into one 64 bit word");
+
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            const auto spread = _pdep_u64(_pext_u64(static_cast<std::uint64_t>(values[i].value), fields), lanes);
+            std::memcpy(&out[i], &spread, sizeof(Fields));
+        }
+    }
+#endif
+}}
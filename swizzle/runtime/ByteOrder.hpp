@@ -0,0 +1,98 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
+
+// Support for the C++ generated by codegen::generateCpp(). Header only,
+// generated code includes it and nothing else from swizzle.
+namespace swizzle { namespace runtime {
+
+    // byte order of a field on the wire, @big_endian or @little_endian
+    enum class ByteOrder { Little, Big };
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    static constexpr ByteOrder HostByteOrder = ByteOrder::Big;
+#else
+    static constexpr ByteOrder HostByteOrder = ByteOrder::Little;
+#endif
+
+    namespace detail {
+
+        template<std::size_t Size> struct Unsigned;
+        template<> struct Unsigned<1> { using type = std::uint8_t; };
+        template<> struct Unsigned<2> { using type = std::uint16_t; };
+        template<> struct Unsigned<4> { using type = std::uint32_t; };
+        template<> struct Unsigned<8> { using type = std::uint64_t; };
+
+        inline std::uint8_t byteswap(const std::uint8_t value) { return value; }
+
+#if defined(_MSC_VER)
+        inline std::uint16_t byteswap(const std::uint16_t value) { return _byteswap_ushort(value); }
+        inline std::uint32_t byteswap(const std::uint32_t value) { return _byteswap_ulong(value); }
+        inline std::uint64_t byteswap(const std::uint64_t value) { return _byteswap_uint64(value); }
+#else
+        inline std::uint16_t byteswap(const std::uint16_t value) { return __builtin_bswap16(value); }
+        inline std::uint32_t byteswap(const std::uint32_t value) { return __builtin_bswap32(value); }
+        inline std::uint64_t byteswap(const std::uint64_t value) { return __builtin_bswap64(value); }
+#endif
+    }
+
+    // read a @T stored in @Order at @data, which need not be aligned. @T is
+    // any trivially copyable 1, 2, 4 or 8 byte type: integers, floats, enums
+    // and the generated bitfield wrappers.
+    template<class T, ByteOrder Order>
+    inline T load(const char* data)
+    {
+        using U = typename detail::Unsigned<sizeof(T)>::type;
+
+        U raw;
+        std::memcpy(&raw, data, sizeof(raw));
+
+        if(Order != HostByteOrder)
+        {
+            raw = detail::byteswap(raw);
+        }
+
+        T value;
+        std::memcpy(&value, &raw, sizeof(value));
+
+        return value;
+    }
+
+    // write @value in @Order to @out, the inverse of load()
+    template<class T, ByteOrder Order>
+    inline void store(char* out, const T& value)
+    {
+        using U = typename detail::Unsigned<sizeof(T)>::type;
+
+        U raw;
+        std::memcpy(&raw, &value, sizeof(raw));
+
+        if(Order != HostByteOrder)
+        {
+            raw = detail::byteswap(raw);
+        }
+
+        std::memcpy(out, &raw, sizeof(raw));
+    }
+
+    // whether a vector of @size elements can have its size stored in a @T
+    template<class T>
+    constexpr bool fits(const std::size_t size)
+    {
+        return static_cast<std::uint64_t>(size) <= static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+    }
+
+    // element codec for a Range of scalars
+    template<class T, ByteOrder Order>
+    struct Scalar
+    {
+        static constexpr std::size_t Size = sizeof(T);
+        static T read(const char* data) { return load<T, Order>(data); }
+    };
+}}
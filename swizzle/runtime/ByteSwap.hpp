@@ -0,0 +1,131 @@
+#pragma once
+#include <swizzle/runtime/ByteOrder.hpp>
+#include <swizzle/runtime/Cpu.hpp>
+
+#include <cstddef>
+#include <cstring>
+
+// Byte order conversion of runs of equally sized elements, the arrays and
+// vectors of scalars of the generated code. pshufb reverses every element
+// of 32 (AVX2) or 16 (SSSE3) bytes at a time, the tail, and CPUs with
+// neither, take load()/store() an element at a time.
+namespace swizzle { namespace runtime {
+
+    namespace detail {
+
+#if defined(SWIZZLE_X86_SIMD)
+        // pshufb control reversing each @Size byte element of 16 bytes
+        template<std::size_t Size>
+        SWIZZLE_TARGET("ssse3") __m128i byteReverse128()
+        {
+            return Size == 2 ? _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+                 : Size == 4 ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+                 : Size == 8 ? _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8)
+                 : _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        }
+
+        template<std::size_t Size>
+        SWIZZLE_TARGET("avx2") __m256i byteReverse256()
+        {
+            return _mm256_broadcastsi128_si256(byteReverse128<Size>());
+        }
+
+        // @return the bytes done, a multiple of 16
+        template<std::size_t Size>
+        SWIZZLE_TARGET("ssse3") std::size_t reverseSsse3(const char* in, const std::size_t bytes, char* out)
+        {
+            const auto control = byteReverse128<Size>();
+            std::size_t i = 0;
+
+            for(; i + 16 <= bytes; i += 16)
+            {
+                const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_shuffle_epi8(v, control));
+            }
+
+            return i;
+        }
+
+        // @return the bytes done, a multiple of 32
+        template<std::size_t Size>
+        SWIZZLE_TARGET("avx2") std::size_t reverseAvx2(const char* in, const std::size_t bytes, char* out)
+        {
+            const auto control = byteReverse256<Size>();
+            std::size_t i = 0;
+
+            for(; i + 32 <= bytes; i += 32)
+            {
+                const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_shuffle_epi8(v, control));
+            }
+
+            return i;
+        }
+#endif
+
+        // reverse the bytes of as many of the @count @Size byte elements at @in
+        // as the CPU's vectors take. @return the elements done, the caller
+        // finishing the rest
+        template<std::size_t Size>
+        std::size_t reverseElements(const char* in, const std::size_t count, char* out)
+        {
+#if defined(SWIZZLE_X86_SIMD)
+            if(hasAvx2())
+            {
+                return reverseAvx2<Size>(in, count * Size, out) / Size;
+            }
+
+            if(hasSsse3())
+            {
+                return reverseSsse3<Size>(in, count * Size, out) / Size;
+            }
+#else
+            static_cast<void>(in);
+            static_cast<void>(count);
+            static_cast<void>(out);
+#endif
+            return 0;
+        }
+    }
+
+    // out[i] = load<T, Order>(data + i * sizeof(T)) for @count elements
+    template<class T, ByteOrder Order>
+    void loadRun(const char* data, const std::size_t count, T* out)
+    {
+        if((Order == HostByteOrder) || (sizeof(T) == 1))
+        {
+            if(count)
+            {
+                std::memcpy(out, data, count * sizeof(T));
+            }
+
+            return;
+        }
+
+        for(auto i = detail::reverseElements<sizeof(T)>(data, count, reinterpret_cast<char*>(out)); i < count; ++i)
+        {
+            out[i] = load<T, Order>(data + i * sizeof(T));
+        }
+    }
+
+    // store<T, Order>(out + i * sizeof(T), values[i]) for @count elements,
+    // the inverse of loadRun()
+    template<class T, ByteOrder Order>
+    void storeRun(char* out, const T* values, const std::size_t count)
+    {
+        if((Order == HostByteOrder) || (sizeof(T) == 1))
+        {
+            if(count)
+            {
+                std::memcpy(out, values, count * sizeof(T));
+            }
+
+            return;
+        }
+
+        for(auto i = detail::reverseElements<sizeof(T)>(reinterpret_cast<const char*>(values), count, out); i < count; ++i)
+        {
+            store<T, Order>(out + i * sizeof(T), values[i]);
+        }
+    }
+}}
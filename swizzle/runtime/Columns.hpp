@@ -0,0 +1,135 @@
+#pragma once
+#include <swizzle/runtime/ByteOrder.hpp>
+#include <swizzle/runtime/ByteSwap.hpp>
+#include <swizzle/runtime/Cpu.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+// Column kernels of the generated batch decoders: one field of many records
+// into a contiguous array. 4 and 8 byte fields are gathered with AVX2 when
+// the CPU has it (hasAvx2()), byte swapped in register; other sizes, and
+// CPUs without AVX2, take a loop of load()s.
+namespace swizzle { namespace runtime {
+
+    // records a generated decodeColumns() takes per pass over its columns, few
+    // enough for their bytes to stay in L1 from one column to the next
+    constexpr std::size_t ColumnBlock = 256;
+
+    namespace detail {
+
+#if defined(SWIZZLE_X86_SIMD)
+        // @return the first element not written
+        template<class T, ByteOrder Order>
+        SWIZZLE_TARGET("avx2") std::size_t gatherStridedAvx2(const char* data, const std::size_t stride, const std::size_t count, T* out)
+        {
+            const auto swap = byteReverse256<sizeof(T)>();
+            std::size_t i = 0;
+
+            if(sizeof(T) == 4)
+            {
+                const auto index = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(stride)));
+
+                for(; i + 8 <= count; i += 8)
+                {
+                    auto v = _mm256_i32gather_epi32(reinterpret_cast<const int*>(data + i * stride), index, 1);
+                    v = (Order != HostByteOrder) ? _mm256_shuffle_epi8(v, swap) : v;
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+                }
+            }
+            else
+            {
+                const auto index = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(static_cast<int>(stride)));
+
+                for(; i + 4 <= count; i += 4)
+                {
+                    auto v = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(data + i * stride), index, 1);
+                    v = (Order != HostByteOrder) ? _mm256_shuffle_epi8(v, swap) : v;
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+                }
+            }
+
+            return i;
+        }
+
+        // the record addresses are the gather's indices, from a null base
+        template<class T, ByteOrder Order>
+        SWIZZLE_TARGET("avx2") std::size_t gatherIndirectAvx2(const char* const* records, const std::size_t offset, const std::size_t count, T* out)
+        {
+            const auto swap = byteReverse256<sizeof(T)>();
+            const auto add = _mm256_set1_epi64x(static_cast<long long>(offset));
+            std::size_t i = 0;
+
+            for(; i + 4 <= count; i += 4)
+            {
+                const auto addresses = _mm256_add_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(records + i)), add);
+
+                if(sizeof(T) == 4)
+                {
+                    auto v = _mm256_i64gather_epi32(static_cast<const int*>(nullptr), addresses, 1);
+                    v = (Order != HostByteOrder) ? _mm_shuffle_epi8(v, _mm256_castsi256_si128(swap)) : v;
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), v);
+                }
+                else
+                {
+                    auto v = _mm256_i64gather_epi64(static_cast<const long long*>(nullptr), addresses, 1);
+                    v = (Order != HostByteOrder) ? _mm256_shuffle_epi8(v, swap) : v;
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+                }
+            }
+
+            return i;
+        }
+#endif
+
+        template<class T>
+        bool gathers()
+        {
+#if defined(SWIZZLE_X86_SIMD)
+            return ((sizeof(T) == 4) || (sizeof(T) == 8)) && hasAvx2();
+#else
+            return false;
+#endif
+        }
+    }
+
+    // out[i] = load<T, Order>(data + i * stride) for @count records of
+    // @stride bytes, @data pointing at the field in the first one
+    template<class T, ByteOrder Order>
+    void gatherStrided(const char* data, const std::size_t stride, const std::size_t count, T* out)
+    {
+        std::size_t i = 0;
+
+#if defined(SWIZZLE_X86_SIMD)
+        // 32 bit gather indices
+        if(detail::gathers<T>() && (stride <= 0x7fffffff / 8))
+        {
+            i = detail::gatherStridedAvx2<T, Order>(data, stride, count, out);
+        }
+#endif
+
+        for(; i < count; ++i)
+        {
+            out[i] = load<T, Order>(data + i * stride);
+        }
+    }
+
+    // out[i] = load<T, Order>(records[i] + offset) for @count records
+    template<class T, ByteOrder Order>
+    void gatherIndirect(const char* const* records, const std::size_t offset, const std::size_t count, T* out)
+    {
+        std::size_t i = 0;
+
+#if defined(SWIZZLE_X86_SIMD)
+        if(detail::gathers<T>())
+        {
+            i = detail::gatherIndirectAvx2<T, Order>(records, offset, count, out);
+        }
+#endif
+
+        for(; i < count; ++i)
+        {
+            out[i] = load<T, Order>(records[i] + offset);
+        }
+    }
+}}
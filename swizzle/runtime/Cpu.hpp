@@ -0,0 +1,81 @@
+#pragma once
+
+#if !defined(SWIZZLE_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+#define SWIZZLE_X86_SIMD
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// target attributes let one translation unit hold kernels for several
+// instruction sets, picked at runtime; MSVC needs none for its intrinsics
+#if defined(SWIZZLE_X86_SIMD) && !defined(_MSC_VER)
+#define SWIZZLE_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SWIZZLE_TARGET(isa)
+#endif
+
+// CPU features the runtime's kernels are chosen by, each checked once.
+// Define SWIZZLE_NO_SIMD to take the portable paths everywhere.
+namespace swizzle { namespace runtime {
+
+    namespace detail {
+
+#if defined(SWIZZLE_X86_SIMD) && defined(_MSC_VER)
+        // cpuid leaf 7 EBX @bit, and for AVX the OS saving the ymm registers
+        inline bool cpuHas(const int bit, const bool avx)
+        {
+            int info[4] = {};
+            __cpuid(info, 1);
+
+            const bool osAvx = ((info[2] & (1 << 27)) != 0) && ((_xgetbv(0) & 6) == 6);
+
+            __cpuidex(info, 7, 0);
+            return ((info[1] & (1 << bit)) != 0) && (!avx || osAvx);
+        }
+#endif
+    }
+
+    // pext/pdep. They are microcoded and slow on AMD before Zen 3, which still reports them.
+    inline bool hasBmi2()
+    {
+#if defined(SWIZZLE_X86_SIMD) && defined(_MSC_VER)
+        static const bool result = detail::cpuHas(8, false);
+        return result;
+#elif defined(SWIZZLE_X86_SIMD)
+        static const bool result = (__builtin_cpu_init(), __builtin_cpu_supports("bmi2") != 0);
+        return result;
+#else
+        return false;
+#endif
+    }
+
+    // pshufb on 128 bit vectors
+    inline bool hasSsse3()
+    {
+#if defined(SWIZZLE_X86_SIMD) && defined(_MSC_VER)
+        static const bool result = [] { int info[4] = {}; __cpuid(info, 1); return (info[2] & (1 << 9)) != 0; }();
+        return result;
+#elif defined(SWIZZLE_X86_SIMD)
+        static const bool result = (__builtin_cpu_init(), __builtin_cpu_supports("ssse3") != 0);
+        return result;
+#else
+        return false;
+#endif
+    }
+
+    // 256 bit integer vectors, gathers included
+    inline bool hasAvx2()
+    {
+#if defined(SWIZZLE_X86_SIMD) && defined(_MSC_VER)
+        static const bool result = detail::cpuHas(5, true);
+        return result;
+#elif defined(SWIZZLE_X86_SIMD)
+        static const bool result = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+        return result;
+#else
+        return false;
+#endif
+    }
+}}
@@ -0,0 +1,137 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+
+namespace swizzle { namespace runtime {
+
+    // @count elements of Codec::Size bytes each starting at @data, element i
+    // is Codec::read(data + i * Codec::Size). Codec is a Scalar or a fixed
+    // size generated view. Elements are read on access, nothing is copied.
+    template<class Codec>
+    class FixedRange
+    {
+    public:
+        using value_type = decltype(Codec::read(nullptr));
+
+        class iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = FixedRange::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = value_type;
+
+            explicit iterator(const char* data) : data_(data) {}
+
+            value_type operator*() const { return Codec::read(data_); }
+            iterator& operator++() { data_ += Codec::Size; return *this; }
+            iterator operator++(int) { auto result = *this; ++(*this); return result; }
+
+            bool operator==(const iterator& other) const { return data_ == other.data_; }
+            bool operator!=(const iterator& other) const { return data_ != other.data_; }
+
+        private:
+            const char* data_;
+        };
+
+        FixedRange(const char* data, const std::size_t count)
+            : data_(data)
+            , count_(count)
+        {
+        }
+
+        value_type operator[](const std::size_t i) const { return Codec::read(data_ + i * Codec::Size); }
+
+        iterator begin() const { return iterator(data_); }
+        iterator end() const { return iterator(data_ + count_ * Codec::Size); }
+
+        std::size_t size() const { return count_; }
+        bool empty() const { return count_ == 0; }
+
+        // bytes the elements take on the wire
+        std::size_t wireSize() const { return count_ * Codec::Size; }
+
+    private:
+        const char* data_;
+        std::size_t count_;
+    };
+
+    // @count generated views of differing sizes laid end to end, walked
+    // front to back since element i starts where element i - 1 ends
+    template<class View>
+    class VariableRange
+    {
+    public:
+        using value_type = View;
+
+        class iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = View;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = View;
+
+            iterator(const char* data, const std::size_t length, const std::size_t index)
+                : data_(data)
+                , length_(length)
+                , index_(index)
+            {
+            }
+
+            View operator*() const { return View(data_, length_); }
+
+            iterator& operator++()
+            {
+                const auto size = View(data_, length_).wireSize();
+                data_ += size;
+                length_ -= size;
+                ++index_;
+
+                return *this;
+            }
+
+            iterator operator++(int) { auto result = *this; ++(*this); return result; }
+
+            bool operator==(const iterator& other) const { return index_ == other.index_; }
+            bool operator!=(const iterator& other) const { return index_ != other.index_; }
+
+        private:
+            const char* data_;
+            std::size_t length_;
+            std::size_t index_;
+        };
+
+        VariableRange(const char* data, const std::size_t length, const std::size_t count)
+            : data_(data)
+            , length_(length)
+            , count_(count)
+        {
+        }
+
+        iterator begin() const { return iterator(data_, length_, 0); }
+        iterator end() const { return iterator(nullptr, 0, count_); }
+
+        std::size_t size() const { return count_; }
+        bool empty() const { return count_ == 0; }
+
+        // bytes the elements take on the wire, a walk over all of them
+        std::size_t wireSize() const
+        {
+            std::size_t offset = 0;
+            for(std::size_t i = 0; i < count_; ++i)
+            {
+                offset += View(data_ + offset, length_ - offset).wireSize();
+            }
+
+            return offset;
+        }
+
+    private:
+        const char* data_;
+        std::size_t length_;
+        std::size_t count_;
+    };
+}}
@@ -0,0 +1,185 @@
+#pragma once
+#include <swizzle/runtime/ByteOrder.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <utility>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+// Compile time metadata of the generated types. Every Struct, Enum and
+// Bitfield Foo gets a FooMetadata of constexpr tables, found from the type
+// with Metadata<Foo>:
+//
+//   static_assert(Metadata<Header>::field(2).Offset == 3, "");
+//
+// Names are Name constants, std::string_view ones from C++17 on.
+namespace swizzle { namespace runtime {
+
+    // a string literal, or characters outliving it, usable in constant expressions
+    class Name
+    {
+    public:
+        constexpr Name()
+            : data_("")
+            , size_(0)
+        {
+        }
+
+        template<std::size_t N>
+        constexpr Name(const char (&literal)[N])
+            : data_(literal)
+            , size_(N - 1)
+        {
+        }
+
+        constexpr Name(const char* data, const std::size_t size)
+            : data_(data)
+            , size_(size)
+        {
+        }
+
+        constexpr const char* data() const { return data_; }
+        constexpr std::size_t size() const { return size_; }
+        constexpr bool empty() const { return size_ == 0; }
+        constexpr char operator[](const std::size_t i) const { return data_[i]; }
+
+        std::string str() const { return std::string(data_, size_); }
+
+#if __cplusplus >= 201703L
+        constexpr operator std::string_view() const { return std::string_view(data_, size_); }
+#endif
+
+    private:
+        const char* data_;
+        std::size_t size_;
+    };
+
+    constexpr bool operator==(const Name& lhs, const Name& rhs)
+    {
+        if(lhs.size() != rhs.size())
+        {
+            return false;
+        }
+
+        for(std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            if(lhs[i] != rhs[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    constexpr bool operator!=(const Name& lhs, const Name& rhs) { return !(lhs == rhs); }
+
+    // lexicographic by unsigned characters, as std::string orders them
+    constexpr bool operator<(const Name& lhs, const Name& rhs)
+    {
+        for(std::size_t i = 0; (i < lhs.size()) && (i < rhs.size()); ++i)
+        {
+            if(lhs[i] != rhs[i])
+            {
+                return static_cast<unsigned char>(lhs[i]) < static_cast<unsigned char>(rhs[i]);
+            }
+        }
+
+        return lhs.size() < rhs.size();
+    }
+
+    inline std::ostream& operator<<(std::ostream& os, const Name& name)
+    {
+        return os.write(name.data(), static_cast<std::streamsize>(name.size()));
+    }
+
+    // FNV-1a of the @size bytes at @name, what the generated from_string()
+    // looks enumerator names up by
+    constexpr std::uint64_t hashName(const char* name, const std::size_t size)
+    {
+        std::uint64_t hash = 0xcbf29ce484222325ULL;
+        for(std::size_t i = 0; i < size; ++i)
+        {
+            hash = (hash ^ static_cast<unsigned char>(name[i])) * 0x100000001b3ULL;
+        }
+
+        return hash;
+    }
+
+    // FieldInfo::SizeField of a field that is not a vector
+    constexpr std::size_t NoField = std::numeric_limits<std::size_t>::max();
+
+    // MaxSize of a struct or field whose size nothing limits
+    constexpr std::size_t Unbounded = std::numeric_limits<std::size_t>::max();
+
+    // "@big_endian", or "@doc" and the block of "@doc{...}"
+    struct AttributeInfo
+    {
+        Name Attribute;
+        Name Block;
+    };
+
+    enum class TypeKind { Builtin, Enum, Bitfield, Struct };
+
+    // a field of a struct. Generated tables list the members in this order.
+    struct FieldInfo
+    {
+        Name FieldName;
+        Name Type;                          // "u16", or the qualified name of a user type
+        TypeKind Kind;
+        ByteOrder Order;
+        bool FixedOffset;                   // every field before it has a fixed size
+        std::size_t Offset;                 // from the start of the struct, with FixedOffset
+        std::size_t MinSize;                // of the whole field on the wire
+        std::size_t MaxSize;
+        std::size_t ElementSize;            // of one element of an array or vector, 0 if they vary
+        std::size_t ArraySize;              // 0 unless an array
+        std::size_t SizeField;              // a vector's size field ("header" of "header.count"), else NoField
+        Name SizePath;                      // "header.count"
+        bool Labeled;                       // "1: u8 field;"
+        std::uint64_t Label;
+        bool Const;
+        std::size_t FirstAttribute;         // its attributes, indexes of the struct's attribute()
+        std::size_t AttributeCount;
+    };
+
+    // a variable_block: the field it switches on and its cases
+    struct VariableBlockInfo
+    {
+        Name Discriminator;                 // "header.type"
+        std::size_t After;                  // number of fields declared before the block
+        std::size_t FirstCase;              // indexes of the struct's variableBlockCase()
+        std::size_t CaseCount;
+    };
+
+    struct CaseInfo
+    {
+        Name Value;                         // the literal as written, "'A'" or "0x10"
+        Name Type;
+    };
+
+    template<class Enum>
+    struct EnumeratorInfo
+    {
+        Name ValueName;
+        Enum Value;
+    };
+
+    struct BitfieldFieldInfo
+    {
+        Name FieldName;
+        unsigned BeginBit;                  // inclusive
+        unsigned EndBit;                    // inclusive
+        std::uint64_t Mask;
+    };
+
+    // FooMetadata of the generated type Foo
+    template<class T>
+    using Metadata = decltype(metadata(std::declval<const T&>()));
+}}
@@ -52,6 +52,21 @@ namespace swizzle {
         }
     }
 
+    IncomparableBenchmarkResults::IncomparableBenchmarkResults(const std::string& reason)
+        : std::runtime_error("Incomparable benchmark results: " + reason)
+    {
+    }
+
+    InvalidBenchmarkResults::InvalidBenchmarkResults(const std::string& reason)
+        : std::runtime_error("Invalid benchmark results: " + reason)
+    {
+    }
+
+    InvalidBinaryAst::InvalidBinaryAst(const std::string& reason)
+        : std::runtime_error("Invalid binary AST: " + reason)
+    {
+    }
+
     InvalidStreamInput::InvalidStreamInput(const std::string& s)
         : std::runtime_error("Invalid character encountered in safe_istringstream: '" + s + "'")
     {
@@ -18,6 +18,16 @@ namespace swizzle { namespace ast {
         return root_;
     }
 
+    const NodeIndex& AbstractSyntaxTree::index() const
+    {
+        return index_;
+    }
+
+    NodeIndex& AbstractSyntaxTree::index()
+    {
+        return index_;
+    }
+
     void AbstractSyntaxTree::accept(VisitorInterface& visitor)
     {
         root_->accept(visitor);
@@ -0,0 +1,265 @@
+#include <swizzle/ast/Layout.hpp>
+
+#include <swizzle/Exceptions.hpp>
+#include <swizzle/ast/AbstractSyntaxTree.hpp>
+#include <swizzle/ast/nodes/Bitfield.hpp>
+#include <swizzle/ast/nodes/Enum.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/VariableBlock.hpp>
+#include <swizzle/ast/nodes/VariableBlockCase.hpp>
+#include <swizzle/types/SizeOf.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_set>
+
+namespace swizzle { namespace ast {
+
+    constexpr std::size_t SizeRange::Unbounded;
+
+    namespace {
+
+        using InProgress = std::unordered_set<const nodes::Struct*>;
+
+        const StructLayout& layout(nodes::Struct& structure, InProgress& inProgress);
+
+        // saturate at Unbounded rather than wrap
+        std::size_t add(const std::size_t a, const std::size_t b)
+        {
+            return (a > SizeRange::Unbounded - b) ? SizeRange::Unbounded : a + b;
+        }
+
+        std::size_t multiply(const std::size_t a, const std::uint64_t n)
+        {
+            if((a == 0) || (n == 0)) return 0;
+            return (a > SizeRange::Unbounded / n) ? SizeRange::Unbounded : static_cast<std::size_t>(a * n);
+        }
+
+        SizeRange range(const std::size_t minSize, const std::size_t maxSize)
+        {
+            SizeRange result;
+            result.MinSize = minSize;
+            result.MaxSize = maxSize;
+
+            return result;
+        }
+
+        // largest count the (possibly dotted, "header.count") vector size member of @field can hold
+        std::uint64_t maxCount(const nodes::Struct& structure, const nodes::StructField& field)
+        {
+            const auto path = field.vectorSizeMember().token().value();
+            const Node* current = &structure;
+
+            std::size_t begin = 0;
+            while(current && (current->kind() == NodeKind::Struct))
+            {
+                const auto end = std::min(path.find('.', begin), path.size());
+                const auto name = path.substr(begin, end - begin);
+
+                const nodes::StructField* member = nullptr;
+                for(const auto& child : current->children())
+                {
+                    if((child->kind() == NodeKind::StructField) && (static_cast<const nodes::StructField&>(*child).name().token().value() == name))
+                    {
+                        member = static_cast<const nodes::StructField*>(child.get());
+                        break;
+                    }
+                }
+
+                if(!member)
+                {
+                    break;
+                }
+
+                if(end == path.size())
+                {
+                    return types::MaxValueOf(member->type());
+                }
+
+                current = member->typeDeclaration();
+                begin = end + 1;
+            }
+
+            return std::numeric_limits<std::uint64_t>::max();
+        }
+
+        // size of one element of @field (the whole field unless it is an array or vector)
+        SizeRange elementSize(const nodes::StructField& field, InProgress& inProgress)
+        {
+            const auto declaration = field.typeDeclaration();
+            if(!declaration)
+            {
+                const auto size = types::SizeOf(field.type());
+                return range(size, size);
+            }
+
+            switch(declaration->kind())
+            {
+                case NodeKind::Enum:
+                {
+                    const auto size = types::SizeOf(static_cast<const nodes::Enum&>(*declaration).underlying().token().value());
+                    return range(size, size);
+                }
+
+                case NodeKind::Bitfield:
+                {
+                    const auto size = types::SizeOf(static_cast<const nodes::Bitfield&>(*declaration).underlying().token().value());
+                    return range(size, size);
+                }
+
+                case NodeKind::Struct:
+                {
+                    auto& structure = static_cast<nodes::Struct&>(*declaration);
+                    if(inProgress.count(&structure))
+                    {
+                        if(!field.isVector())
+                        {
+                            throw SyntaxError("Struct cannot contain itself except through a vector", field.name());
+                        }
+
+                        return range(0, SizeRange::Unbounded);
+                    }
+
+                    return layout(structure, inProgress);
+                }
+
+                default:
+                    return range(0, SizeRange::Unbounded);
+            }
+        }
+
+        FieldLayout fieldLayout(const nodes::Struct& structure, const nodes::StructField& field, InProgress& inProgress)
+        {
+            const auto element = elementSize(field, inProgress);
+
+            FieldLayout result;
+            result.ElementSize = element.fixed() ? element.MinSize : 0;
+
+            if(field.isArray())
+            {
+                const auto count = static_cast<std::uint64_t>(field.arraySize());
+                result.MinSize = multiply(element.MinSize, count);
+                result.MaxSize = multiply(element.MaxSize, count);
+            }
+            else if(field.isVector())
+            {
+                result.MinSize = 0;
+                result.MaxSize = multiply(element.MaxSize, maxCount(structure, field));
+            }
+            else
+            {
+                result.MinSize = element.MinSize;
+                result.MaxSize = element.MaxSize;
+                result.ElementSize = 0;
+            }
+
+            return result;
+        }
+
+        // exactly one of the cases is on the wire
+        FieldLayout variableBlockLayout(const nodes::VariableBlock& block, InProgress& inProgress)
+        {
+            FieldLayout result;
+            bool first = true;
+
+            for(const auto& child : block.children())
+            {
+                if(child->kind() != NodeKind::VariableBlockCase)
+                {
+                    continue;
+                }
+
+                SizeRange size = range(0, SizeRange::Unbounded);
+
+                const auto declaration = static_cast<const nodes::VariableBlockCase&>(*child).typeDeclaration();
+                if(declaration && (declaration->kind() == NodeKind::Struct) && !inProgress.count(static_cast<const nodes::Struct*>(declaration)))
+                {
+                    size = layout(static_cast<nodes::Struct&>(*declaration), inProgress);
+                }
+
+                result.MinSize = first ? size.MinSize : std::min(result.MinSize, size.MinSize);
+                result.MaxSize = first ? size.MaxSize : std::max(result.MaxSize, size.MaxSize);
+                first = false;
+            }
+
+            return result;
+        }
+
+        const StructLayout& layout(nodes::Struct& structure, InProgress& inProgress)
+        {
+            if(structure.hasLayout())
+            {
+                return structure.layout();
+            }
+
+            inProgress.insert(&structure);
+
+            StructLayout result;
+            bool fixedOffset = true;
+
+            for(const auto& child : structure.children())
+            {
+                FieldLayout member;
+
+                if(child->kind() == NodeKind::StructField)
+                {
+                    member = fieldLayout(structure, static_cast<const nodes::StructField&>(*child), inProgress);
+                }
+                else if(child->kind() == NodeKind::VariableBlock)
+                {
+                    member = variableBlockLayout(static_cast<const nodes::VariableBlock&>(*child), inProgress);
+                }
+                else
+                {
+                    continue;
+                }
+
+                member.FixedOffset = fixedOffset;
+                member.Offset = fixedOffset ? result.FixedPrefix : 0;
+
+                if(fixedOffset && member.fixed())
+                {
+                    result.FixedPrefix += member.MinSize;
+                }
+                else
+                {
+                    fixedOffset = false;
+                }
+
+                result.MinSize = add(result.MinSize, member.MinSize);
+                result.MaxSize = add(result.MaxSize, member.MaxSize);
+
+                if(child->kind() == NodeKind::StructField)
+                {
+                    static_cast<nodes::StructField&>(*child).layout(member);
+                }
+                else
+                {
+                    static_cast<nodes::VariableBlock&>(*child).layout(member);
+                }
+            }
+
+            inProgress.erase(&structure);
+            structure.layout(result);
+
+            return structure.layout();
+        }
+    }
+
+    void computeLayout(const AbstractSyntaxTree& ast)
+    {
+        InProgress inProgress;
+
+        for(const auto& node : ast.index().of<nodes::Struct>())
+        {
+            layout(static_cast<nodes::Struct&>(*node), inProgress);
+        }
+    }
+
+    const StructLayout& layout(nodes::Struct& structure)
+    {
+        InProgress inProgress;
+        return layout(structure, inProgress);
+    }
+}}
@@ -3,6 +3,16 @@
 
 namespace swizzle { namespace ast {
 
+    Node::Node()
+        : kind_(NodeKind::Node)
+    {
+    }
+
+    Node::Node(const NodeKind kind)
+        : kind_(kind)
+    {
+    }
+
     const std::deque<Node::smartptr>& Node::children() const
     {
         return children_;
@@ -0,0 +1,33 @@
+#include <swizzle/ast/NodeIndex.hpp>
+
+namespace swizzle { namespace ast {
+
+    void NodeIndex::insert(Node::smartptr node)
+    {
+        nodes_[static_cast<std::size_t>(node->kind())].push_back(node);
+    }
+
+    void NodeIndex::clear()
+    {
+        for(auto& list : nodes_)
+        {
+            list.clear();
+        }
+    }
+
+    const NodeIndex::NodeList& NodeIndex::of(const NodeKind kind) const
+    {
+        return nodes_[static_cast<std::size_t>(kind)];
+    }
+
+    std::size_t NodeIndex::size() const
+    {
+        std::size_t count = 0;
+        for(const auto& list : nodes_)
+        {
+            count += list.size();
+        }
+
+        return count;
+    }
+}}
@@ -0,0 +1,40 @@
+#include <swizzle/ast/NodeKind.hpp>
+
+namespace swizzle { namespace ast {
+
+    std::ostream& operator<<(std::ostream& os, const NodeKind kind)
+    {
+        switch(kind)
+        {
+        case NodeKind::Node: return os << "NodeKind::Node";
+        case NodeKind::Attribute: return os << "NodeKind::Attribute";
+        case NodeKind::AttributeBlock: return os << "NodeKind::AttributeBlock";
+        case NodeKind::Bitfield: return os << "NodeKind::Bitfield";
+        case NodeKind::BitfieldField: return os << "NodeKind::BitfieldField";
+        case NodeKind::CharLiteral: return os << "NodeKind::CharLiteral";
+        case NodeKind::Comment: return os << "NodeKind::Comment";
+        case NodeKind::DefaultStringValue: return os << "NodeKind::DefaultStringValue";
+        case NodeKind::DefaultValue: return os << "NodeKind::DefaultValue";
+        case NodeKind::Enum: return os << "NodeKind::Enum";
+        case NodeKind::EnumField: return os << "NodeKind::EnumField";
+        case NodeKind::Extern: return os << "NodeKind::Extern";
+        case NodeKind::FieldLabel: return os << "NodeKind::FieldLabel";
+        case NodeKind::HexLiteral: return os << "NodeKind::HexLiteral";
+        case NodeKind::Import: return os << "NodeKind::Import";
+        case NodeKind::MultilineComment: return os << "NodeKind::MultilineComment";
+        case NodeKind::Namespace: return os << "NodeKind::Namespace";
+        case NodeKind::NumericLiteral: return os << "NodeKind::NumericLiteral";
+        case NodeKind::StringLiteral: return os << "NodeKind::StringLiteral";
+        case NodeKind::Struct: return os << "NodeKind::Struct";
+        case NodeKind::StructField: return os << "NodeKind::StructField";
+        case NodeKind::TypeAlias: return os << "NodeKind::TypeAlias";
+        case NodeKind::VariableBlock: return os << "NodeKind::VariableBlock";
+        case NodeKind::VariableBlockCase: return os << "NodeKind::VariableBlockCase";
+
+        default:
+            break;
+        };
+
+        return os << "NodeKind::<unknown>";
+    }
+}}
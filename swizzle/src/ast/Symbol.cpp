@@ -0,0 +1,158 @@
+#include <swizzle/ast/Symbol.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace swizzle { namespace ast {
+
+    namespace {
+
+        // 64 bit FNV-1a, picks the shard and the bucket
+        std::size_t hashOf(const boost::string_view& value)
+        {
+            std::uint64_t hash = 14695981039346656037ULL;
+            for(const auto c : value)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 1099511628211ULL;
+            }
+
+            return static_cast<std::size_t>(hash);
+        }
+
+        struct ViewHash
+        {
+            std::size_t operator()(const boost::string_view& value) const { return hashOf(value); }
+        };
+
+        // keyed by a view of the entry's own string, so a lookup never
+        // builds a std::string
+        struct Shard
+        {
+            std::mutex mutex;
+            std::unordered_map<boost::string_view, SymbolEntry*, ViewHash> entries;
+        };
+
+        // parsers on different threads intern concurrently, sharding keeps
+        // them from all waiting on one lock
+        const std::size_t ShardCount = 64;
+
+        Shard* shards()
+        {
+            // never destroyed, symbols with static storage may outlive it
+            static Shard* const instance = new Shard[ShardCount];
+            return instance;
+        }
+
+        Shard& shard(std::size_t hash)
+        {
+            return shards()[hash % ShardCount];
+        }
+
+        SymbolEntry* acquire(const boost::string_view& value)
+        {
+            const auto hash = hashOf(value);
+            auto& s = shard(hash);
+
+            std::lock_guard<std::mutex> lock(s.mutex);
+
+            const auto found = s.entries.find(value);
+            if(found != s.entries.end())
+            {
+                found->second->references.fetch_add(1, std::memory_order_relaxed);
+                return found->second;
+            }
+
+            auto entry = new SymbolEntry(value, hash);
+            s.entries.emplace(boost::string_view(entry->value), entry);
+            return entry;
+        }
+
+        void release(SymbolEntry* entry)
+        {
+            auto references = entry->references.load(std::memory_order_relaxed);
+            while(references > 1)
+            {
+                if(entry->references.compare_exchange_weak(references, references - 1, std::memory_order_acq_rel))
+                {
+                    return;
+                }
+            }
+
+            // the count only drops to zero under the shard's lock, where
+            // acquire() can't hand out the entry while it is being erased
+            auto& s = shard(entry->hash);
+            std::lock_guard<std::mutex> lock(s.mutex);
+
+            if(entry->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                s.entries.erase(boost::string_view(entry->value));
+                delete entry;
+            }
+        }
+
+        SymbolEntry* emptyEntry()
+        {
+            // holds a reference for the lifetime of the process
+            static SymbolEntry* const entry = acquire(boost::string_view());
+            return entry;
+        }
+    }
+
+    Symbol::Symbol()
+        : entry_(emptyEntry())
+    {
+        entry_->references.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Symbol::Symbol(SymbolEntry* entry)
+        : entry_(entry)
+    {
+    }
+
+    Symbol::Symbol(const Symbol& other)
+        : entry_(other.entry_)
+    {
+        entry_->references.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Symbol& Symbol::operator=(const Symbol& other)
+    {
+        other.entry_->references.fetch_add(1, std::memory_order_relaxed);
+        release(entry_);
+
+        entry_ = other.entry_;
+        return *this;
+    }
+
+    Symbol::~Symbol()
+    {
+        release(entry_);
+    }
+
+    Symbol Symbol::intern(const boost::string_view& value)
+    {
+        return Symbol(acquire(value));
+    }
+
+    std::size_t Symbol::poolSize()
+    {
+        std::size_t size = 0;
+        for(std::size_t i = 0; i < ShardCount; ++i)
+        {
+            auto& s = shards()[i];
+
+            std::lock_guard<std::mutex> lock(s.mutex);
+            size += s.entries.size();
+        }
+
+        return size;
+    }
+
+    std::ostream& operator<<(std::ostream& os, const Symbol& symbol)
+    {
+        os << symbol.str();
+        return os;
+    }
+}}
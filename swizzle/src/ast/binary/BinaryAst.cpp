@@ -0,0 +1,121 @@
+#include <swizzle/ast/binary/BinaryAst.hpp>
+
+#include <swizzle/Exceptions.hpp>
+
+#include <cstring>
+
+namespace swizzle { namespace ast { namespace binary {
+
+    namespace {
+
+        // true if [offset, offset + count * elementSize) lies inside a buffer of @size bytes
+        bool inBounds(const std::uint64_t offset, const std::uint64_t count, const std::uint64_t elementSize, const std::uint64_t size)
+        {
+            return (offset <= size) && (count <= ((size - offset) / elementSize));
+        }
+
+        bool aligned(const void* p, const std::size_t alignment)
+        {
+            return (reinterpret_cast<std::uintptr_t>(p) % alignment) == 0;
+        }
+    }
+
+    BinaryAst::BinaryAst(const char* data, const std::size_t size)
+        : data_(data)
+        , header_(reinterpret_cast<const Header*>(data))
+        , nodes_(nullptr)
+        , strings_(nullptr)
+        , stringData_(nullptr)
+    {
+        validate(size);
+
+        nodes_ = reinterpret_cast<const NodeRecord*>(data_ + header_->nodesOffset);
+        strings_ = reinterpret_cast<const StringRecord*>(data_ + header_->stringsOffset);
+        stringData_ = data_ + header_->stringDataOffset;
+
+        for(std::uint32_t i = 0; i < header_->stringCount; ++i)
+        {
+            if(!inBounds(strings_[i].offset, strings_[i].length, 1, header_->size - header_->stringDataOffset))
+            {
+                throw InvalidBinaryAst("string out of bounds");
+            }
+        }
+
+        for(std::uint32_t i = 0; i < header_->nodeCount; ++i)
+        {
+            const auto& node = nodes_[i];
+
+            if(node.kind >= NodeKindCount)
+            {
+                throw InvalidBinaryAst("unknown node kind");
+            }
+
+            if((node.text >= header_->stringCount) || (node.type >= header_->stringCount) || (node.aux >= header_->stringCount))
+            {
+                throw InvalidBinaryAst("string index out of range");
+            }
+
+            // children always follow their parent, so a valid buffer has no cycles
+            if((node.childCount != 0) && ((node.firstChild <= i) || !inBounds(node.firstChild, node.childCount, 1, header_->nodeCount)))
+            {
+                throw InvalidBinaryAst("child index out of range");
+            }
+        }
+    }
+
+    void BinaryAst::validate(const std::size_t size) const
+    {
+        if((data_ == nullptr) || !aligned(data_, alignof(NodeRecord)))
+        {
+            throw InvalidBinaryAst("buffer is null or misaligned");
+        }
+
+        if(size < sizeof(Header))
+        {
+            throw InvalidBinaryAst("buffer too small for header");
+        }
+
+        if(std::memcmp(header_->magic, Magic, sizeof(Magic)) != 0)
+        {
+            throw InvalidBinaryAst("bad magic");
+        }
+
+        if(header_->byteOrder != ByteOrderMark)
+        {
+            throw InvalidBinaryAst("byte order does not match host");
+        }
+
+        if(header_->version != Version)
+        {
+            throw InvalidBinaryAst("unsupported version");
+        }
+
+        if(header_->size > size)
+        {
+            throw InvalidBinaryAst("buffer truncated");
+        }
+
+        if((header_->nodeCount == 0) || (header_->stringCount == 0) || (header_->filename >= header_->stringCount))
+        {
+            throw InvalidBinaryAst("header inconsistent");
+        }
+
+        if(((header_->nodesOffset % alignof(NodeRecord)) != 0) || ((header_->stringsOffset % alignof(StringRecord)) != 0))
+        {
+            throw InvalidBinaryAst("misaligned table");
+        }
+
+        if(!inBounds(header_->nodesOffset, header_->nodeCount, sizeof(NodeRecord), header_->size)
+            || !inBounds(header_->stringsOffset, header_->stringCount, sizeof(StringRecord), header_->size)
+            || !inBounds(header_->stringDataOffset, 0, 1, header_->size))
+        {
+            throw InvalidBinaryAst("table out of bounds");
+        }
+    }
+
+    boost::string_view BinaryAst::string(const std::uint32_t index) const
+    {
+        const auto& s = strings_[index];
+        return boost::string_view(stringData_ + s.offset, s.length);
+    }
+}}}
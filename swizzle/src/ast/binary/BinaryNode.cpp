@@ -0,0 +1,40 @@
+#include <swizzle/ast/binary/BinaryNode.hpp>
+
+#include <swizzle/ast/binary/BinaryAst.hpp>
+
+#include <stdexcept>
+
+namespace swizzle { namespace ast { namespace binary {
+
+    BinaryNode::BinaryNode(const BinaryAst& ast, const std::uint32_t index)
+        : ast_(&ast)
+        , record_(&ast.record(index))
+        , index_(index)
+    {
+    }
+
+    boost::string_view BinaryNode::text() const
+    {
+        return ast_->string(record_->text);
+    }
+
+    boost::string_view BinaryNode::type() const
+    {
+        return ast_->string(record_->type);
+    }
+
+    boost::string_view BinaryNode::aux() const
+    {
+        return ast_->string(record_->aux);
+    }
+
+    BinaryNode BinaryNode::child(const std::size_t n) const
+    {
+        if(n >= record_->childCount)
+        {
+            throw std::out_of_range("BinaryNode::child(), index out of range");
+        }
+
+        return ast_->node(record_->firstChild + static_cast<std::uint32_t>(n));
+    }
+}}}
@@ -0,0 +1,11 @@
+#include <swizzle/ast/binary/MappedBinaryAst.hpp>
+
+namespace swizzle { namespace ast { namespace binary {
+
+    MappedBinaryAst::MappedBinaryAst(const boost::filesystem::path& path)
+        : file_(path.string().c_str(), boost::interprocess::read_only)
+        , region_(file_, boost::interprocess::read_only)
+        , ast_(static_cast<const char*>(region_.get_address()), region_.get_size())
+    {
+    }
+}}}
@@ -0,0 +1,286 @@
+#include <swizzle/ast/binary/Serialize.hpp>
+
+#include <swizzle/Exceptions.hpp>
+#include <swizzle/ast/StaticVisitor.hpp>
+#include <swizzle/ast/binary/Format.hpp>
+
+#include <boost/utility/string_view.hpp>
+#include <boost/variant.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+namespace swizzle { namespace ast { namespace binary {
+
+    namespace {
+
+        struct EnumValueToInteger : public boost::static_visitor<std::int64_t>
+        {
+            // unsigned 64 bit values keep their bit pattern
+            template<typename T>
+            std::int64_t operator()(const T value) const { return static_cast<std::int64_t>(value); }
+        };
+
+        std::uint32_t checkedSize(const std::size_t size)
+        {
+            if(size > std::numeric_limits<std::uint32_t>::max())
+            {
+                throw InvalidBinaryAst("tree too large to serialize");
+            }
+
+            return static_cast<std::uint32_t>(size);
+        }
+
+        // de-duplicated string storage, index 0 is the empty string
+        class StringTable
+        {
+        public:
+            StringTable()
+                : records_(1, StringRecord{ 0, 0 })
+            {
+            }
+
+            std::uint32_t add(const boost::string_view& value)
+            {
+                if(value.empty())
+                {
+                    return 0;
+                }
+
+                auto key = value.to_string();
+
+                const auto iter = indexes_.find(key);
+                if(iter != indexes_.cend())
+                {
+                    return iter->second;
+                }
+
+                const auto index = checkedSize(records_.size());
+                records_.push_back(StringRecord{ checkedSize(data_.size()), checkedSize(value.size()) });
+                data_.append(value.data(), value.size());
+
+                indexes_.emplace(std::move(key), index);
+                return index;
+            }
+
+            const std::vector<StringRecord>& records() const { return records_; }
+            const std::string& data() const { return data_; }
+
+        private:
+            std::unordered_map<std::string, std::uint32_t> indexes_;
+            std::vector<StringRecord> records_;
+            std::string data_;
+        };
+
+        // fills in the kind specific fields of a NodeRecord
+        class RecordBuilder : public StaticVisitor<RecordBuilder>
+        {
+        public:
+            RecordBuilder(StringTable& strings)
+                : strings_(strings)
+                , record_(nullptr)
+                , filename_(0)
+            {
+            }
+
+            void build(Node& node, NodeRecord& record)
+            {
+                record_ = &record;
+                record_->kind = static_cast<std::uint8_t>(node.kind());
+
+                dispatch(node);
+            }
+
+            std::uint32_t filename() const { return filename_; }
+
+            void operator()(nodes::Attribute& node) { text(node.info()); }
+            void operator()(nodes::AttributeBlock& node) { text(node.info()); }
+            void operator()(nodes::CharLiteral& node) { text(node.info()); }
+            void operator()(nodes::Comment& node) { text(node.info()); }
+            void operator()(nodes::FieldLabel& node) { text(node.info()); }
+            void operator()(nodes::HexLiteral& node) { text(node.info()); }
+            void operator()(nodes::MultilineComment& node) { text(node.info()); }
+            void operator()(nodes::Namespace& node) { text(node.info()); }
+            void operator()(nodes::NumericLiteral& node) { text(node.info()); }
+            void operator()(nodes::StringLiteral& node) { text(node.info()); }
+            void operator()(nodes::Extern& node) { text(node.externType()); }
+            void operator()(nodes::VariableBlock& node) { text(node.variableOnField()); }
+
+            void operator()(nodes::Bitfield& node)
+            {
+                position(node.nameInfo());
+                record_->text = strings_.add(node.name());
+                record_->type = strings_.add(node.underlying().token().value());
+            }
+
+            void operator()(nodes::BitfieldField& node)
+            {
+                text(node.name());
+                record_->type = strings_.add(node.underlying().token().value());
+                record_->value = static_cast<std::int64_t>(node.beginBit());
+                record_->value2 = static_cast<std::int64_t>(node.endBit());
+            }
+
+            void operator()(nodes::DefaultStringValue& node)
+            {
+                text(node.value());
+                record_->type = strings_.add(node.underlying());
+                record_->value = node.length();
+            }
+
+            void operator()(nodes::DefaultValue& node)
+            {
+                text(node.value());
+                record_->type = strings_.add(node.underlying());
+            }
+
+            void operator()(nodes::Enum& node)
+            {
+                position(node.nameInfo());
+                record_->text = strings_.add(node.name());
+                record_->type = strings_.add(node.underlying().token().value());
+            }
+
+            void operator()(nodes::EnumField& node)
+            {
+                text(node.name());
+                record_->type = strings_.add(node.underlying().token().value());
+                record_->value = boost::apply_visitor(EnumValueToInteger(), node.value());
+            }
+
+            void operator()(nodes::Import& node)
+            {
+                position(node.info());
+                record_->text = strings_.add(node.path().string());
+            }
+
+            void operator()(nodes::Struct& node)
+            {
+                position(node.nameInfo());
+                record_->text = strings_.add(node.name());
+            }
+
+            void operator()(nodes::StructField& node)
+            {
+                text(node.name());
+                record_->type = strings_.add(node.type());
+                record_->value = node.arraySize();
+
+                if(node.isVector())
+                {
+                    record_->aux = strings_.add(node.vectorSizeMember().token().value());
+                }
+
+                record_->flags = static_cast<std::uint8_t>(
+                      (node.isConst() ? NodeFlags::IsConst : 0)
+                    | (node.isArray() ? NodeFlags::IsArray : 0)
+                    | (node.isVector() ? NodeFlags::IsVector : 0));
+            }
+
+            void operator()(nodes::TypeAlias& node)
+            {
+                text(node.aliasedType());
+                record_->type = strings_.add(node.existingType().token().value());
+            }
+
+            void operator()(nodes::VariableBlockCase& node)
+            {
+                text(node.value());
+                record_->type = strings_.add(node.type().token().value());
+            }
+
+        private:
+            void text(const lexer::TokenInfo& info)
+            {
+                position(info);
+                record_->text = strings_.add(info.token().value());
+            }
+
+            void position(const lexer::TokenInfo& info)
+            {
+                const auto& fileInfo = info.fileInfo();
+
+                record_->line = checkedSize(fileInfo.start().line());
+                record_->column = checkedSize(fileInfo.start().column());
+
+                if(filename_ == 0)
+                {
+                    filename_ = strings_.add(fileInfo.filename());
+                }
+            }
+
+        private:
+            StringTable& strings_;
+            NodeRecord* record_;
+            std::uint32_t filename_;
+        };
+
+        template<class T>
+        void write(std::vector<char>& buffer, const std::size_t offset, const T* data, const std::size_t count)
+        {
+            if(count != 0)
+            {
+                std::memcpy(buffer.data() + offset, data, sizeof(T) * count);
+            }
+        }
+    }
+
+    std::vector<char> serialize(const AbstractSyntaxTree& ast)
+    {
+        StringTable strings;
+        RecordBuilder builder(strings);
+
+        // breadth first, so the children of each node end up contiguous
+        std::vector<Node*> order(1, ast.root().get());
+        std::vector<NodeRecord> records;
+
+        for(std::size_t i = 0; i < order.size(); ++i)
+        {
+            auto& node = *order[i];
+
+            NodeRecord record = NodeRecord();
+            builder.build(node, record);
+
+            record.firstChild = checkedSize(order.size());
+            record.childCount = checkedSize(node.children().size());
+
+            for(const auto& child : node.children())
+            {
+                order.push_back(child.get());
+            }
+
+            records.push_back(record);
+        }
+
+        Header header = Header();
+        std::memcpy(header.magic, Magic, sizeof(header.magic));
+        header.version = Version;
+        header.byteOrder = ByteOrderMark;
+        header.filename = builder.filename();
+
+        header.nodeCount = checkedSize(records.size());
+        header.nodesOffset = sizeof(Header);
+
+        header.stringCount = checkedSize(strings.records().size());
+        header.stringsOffset = checkedSize(header.nodesOffset + (sizeof(NodeRecord) * records.size()));
+        header.stringDataOffset = checkedSize(header.stringsOffset + (sizeof(StringRecord) * strings.records().size()));
+        header.size = checkedSize(header.stringDataOffset + strings.data().size());
+
+        std::vector<char> buffer(header.size);
+        write(buffer, 0, &header, 1);
+        write(buffer, header.nodesOffset, records.data(), records.size());
+        write(buffer, header.stringsOffset, strings.records().data(), strings.records().size());
+        write(buffer, header.stringDataOffset, strings.data().data(), strings.data().size());
+
+        return buffer;
+    }
+
+    void serialize(const AbstractSyntaxTree& ast, std::ostream& os)
+    {
+        const auto buffer = serialize(ast);
+        os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+}}}
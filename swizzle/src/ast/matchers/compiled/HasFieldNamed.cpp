@@ -0,0 +1,32 @@
+#include <swizzle/ast/matchers/compiled/HasFieldNamed.hpp>
+
+#include <swizzle/ast/nodes/BitfieldField.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+
+namespace swizzle { namespace ast { namespace matchers { namespace compiled {
+
+    HasFieldNamed::HasFieldNamed(const boost::string_view& name)
+        : name_(name)
+    {
+    }
+
+    bool HasFieldNamed::evaluate(Node& node, result_type& result) const
+    {
+        for(const auto& child : node.children())
+        {
+            const auto kind = child->kind();
+
+            const bool found = (kind == NodeKind::StructField)
+                ? static_cast<const nodes::StructField&>(*child).name().token().value() == name_
+                : (kind == NodeKind::BitfieldField) && (static_cast<const nodes::BitfieldField&>(*child).name().token().value() == name_);
+
+            if(found)
+            {
+                result = child.get();
+                return true;
+            }
+        }
+
+        return false;
+    }
+}}}}
@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     Attribute::Attribute(const lexer::TokenInfo& info)
-        : info_(info)
+        : Node(NodeKind::Attribute)
+        , info_(info)
     {
     }
 
@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     AttributeBlock::AttributeBlock(const lexer::TokenInfo& info)
-        : info_(info)
+        : Node(NodeKind::AttributeBlock)
+        , info_(info)
     {
     }
 
@@ -4,9 +4,10 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     Bitfield::Bitfield(const lexer::TokenInfo& bitfieldInfo, const lexer::TokenInfo& name, const std::string& containingNamespace)
-        : bitfieldInfo_(bitfieldInfo)
+        : Node(NodeKind::Bitfield)
+        , bitfieldInfo_(bitfieldInfo)
         , nameInfo_(name)
-        , name_(containingNamespace + "::" + nameInfo_.token().to_string())
+        , name_(Symbol::intern(containingNamespace + "::" + nameInfo_.token().to_string()))
     {
     }
 
@@ -20,7 +21,12 @@ namespace swizzle { namespace ast { namespace nodes {
         return nameInfo_;
     }
 
-    std::string Bitfield::name() const
+    boost::string_view Bitfield::name() const
+    {
+        return name_.view();
+    }
+
+    Symbol Bitfield::symbol() const
     {
         return name_;
     }
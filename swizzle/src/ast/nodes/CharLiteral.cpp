@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     CharLiteral::CharLiteral(const lexer::TokenInfo& info)
-        : info_(info)
+        : Node(NodeKind::CharLiteral)
+        , info_(info)
     {
     }
 
@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     Comment::Comment(const lexer::TokenInfo& info)
-        : info_(info)
+        : Node(NodeKind::Comment)
+        , info_(info)
     {
     }
 
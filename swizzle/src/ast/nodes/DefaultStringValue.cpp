@@ -4,9 +4,10 @@
 
 namespace swizzle { namespace ast { namespace nodes {
 
-    DefaultStringValue::DefaultStringValue(const lexer::TokenInfo& value, const std::string& underlyingType, const std::ptrdiff_t length)
-        : value_(value)
-        , underlying_(underlyingType)
+    DefaultStringValue::DefaultStringValue(const lexer::TokenInfo& value, const boost::string_view& underlyingType, const std::ptrdiff_t length)
+        : Node(NodeKind::DefaultStringValue)
+        , value_(value)
+        , underlying_(Symbol::intern(underlyingType))
         , length_(length)
     {
     }
@@ -16,7 +17,12 @@ namespace swizzle { namespace ast { namespace nodes {
         return value_;
     }
 
-    const std::string& DefaultStringValue::underlying() const
+    boost::string_view DefaultStringValue::underlying() const
+    {
+        return underlying_.view();
+    }
+
+    Symbol DefaultStringValue::underlyingSymbol() const
     {
         return underlying_;
     }
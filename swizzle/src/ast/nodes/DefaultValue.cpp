@@ -5,9 +5,10 @@
 
 namespace swizzle { namespace ast { namespace nodes {
 
-    DefaultValue::DefaultValue(const lexer::TokenInfo& value, const std::string& underlyingType)
-        : value_(value)
-        , underlying_(underlyingType)
+    DefaultValue::DefaultValue(const lexer::TokenInfo& value, const boost::string_view& underlyingType)
+        : Node(NodeKind::DefaultValue)
+        , value_(value)
+        , underlying_(Symbol::intern(underlyingType))
     {
     }
 
@@ -16,7 +17,12 @@ namespace swizzle { namespace ast { namespace nodes {
         return value_;
     }
 
-    const std::string& DefaultValue::underlying() const
+    boost::string_view DefaultValue::underlying() const
+    {
+        return underlying_.view();
+    }
+
+    Symbol DefaultValue::underlyingSymbol() const
     {
         return underlying_;
     }
@@ -4,9 +4,10 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     Enum::Enum(const lexer::TokenInfo& enumInfo, const lexer::TokenInfo& name, const std::string& containingNamespace)
-        : enumInfo_(enumInfo)
+        : Node(NodeKind::Enum)
+        , enumInfo_(enumInfo)
         , nameInfo_(name)
-        , name_(containingNamespace + "::" + nameInfo_.token().to_string())
+        , name_(Symbol::intern(containingNamespace + "::" + nameInfo_.token().to_string()))
     {
     }
 
@@ -20,7 +21,12 @@ namespace swizzle { namespace ast { namespace nodes {
         return nameInfo_;
     }
 
-    std::string Enum::name() const
+    boost::string_view Enum::name() const
+    {
+        return name_.view();
+    }
+
+    Symbol Enum::symbol() const
     {
         return name_;
     }
@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     EnumField::EnumField(const lexer::TokenInfo& name, const lexer::TokenInfo& underlyingType)
-        : name_(name)
+        : Node(NodeKind::EnumField)
+        , name_(name)
         , underlying_(underlyingType)
     {
     }
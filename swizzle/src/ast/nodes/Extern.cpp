@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     Extern::Extern(const lexer::TokenInfo& externType)
-        : externType_(externType)
+        : Node(NodeKind::Extern)
+        , externType_(externType)
     {
     }
 
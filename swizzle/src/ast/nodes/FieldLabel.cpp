@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     FieldLabel::FieldLabel(const lexer::TokenInfo& info)
-        : info_(info)
+        : Node(NodeKind::FieldLabel)
+        , info_(info)
     {
     }
 
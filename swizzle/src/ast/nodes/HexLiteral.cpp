@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     HexLiteral::HexLiteral(const lexer::TokenInfo& info)
-        : info_(info)
+        : Node(NodeKind::HexLiteral)
+        , info_(info)
     {
     }
 
@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     Import::Import(const lexer::TokenInfo& info, const boost::filesystem::path& path)
-        : info_(info)
+        : Node(NodeKind::Import)
+        , info_(info)
         , importPath_(path)
     {
     }
@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     MultilineComment::MultilineComment(const lexer::TokenInfo& info)
-        : info_(info)
+        : Node(NodeKind::MultilineComment)
+        , info_(info)
     {
     }
 
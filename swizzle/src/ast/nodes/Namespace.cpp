@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     Namespace::Namespace(const lexer::TokenInfo& info)
-        : info_(info)
+        : Node(NodeKind::Namespace)
+        , info_(info)
     {
     }
 
@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     NumericLiteral::NumericLiteral(const lexer::TokenInfo& info)
-        : info_(info)
+        : Node(NodeKind::NumericLiteral)
+        , info_(info)
     {
     }
 
@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     StringLiteral::StringLiteral(const lexer::TokenInfo& info)
-        : info_(info)
+        : Node(NodeKind::StringLiteral)
+        , info_(info)
     {
     }
 
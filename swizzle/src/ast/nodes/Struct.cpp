@@ -4,9 +4,11 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     Struct::Struct(const lexer::TokenInfo& info, const lexer::TokenInfo& name, const std::string& containingNamespace)
-        : info_(info)
+        : Node(NodeKind::Struct)
+        , info_(info)
         , nameInfo_(name)
-        , name_(containingNamespace + "::" + name.token().to_string())
+        , name_(Symbol::intern(containingNamespace + "::" + name.token().to_string()))
+        , hasLayout_(false)
     {
     }
 
@@ -20,11 +22,32 @@ namespace swizzle { namespace ast { namespace nodes {
         return nameInfo_;
     }
 
-    std::string Struct::name() const
+    boost::string_view Struct::name() const
+    {
+        return name_.view();
+    }
+
+    Symbol Struct::symbol() const
     {
         return name_;
     }
 
+    bool Struct::hasLayout() const
+    {
+        return hasLayout_;
+    }
+
+    void Struct::layout(const StructLayout& layout)
+    {
+        layout_ = layout;
+        hasLayout_ = true;
+    }
+
+    const StructLayout& Struct::layout() const
+    {
+        return layout_;
+    }
+
     void Struct::accept(VisitorInterface& visitor)
     {
         visitor(*this);
@@ -8,7 +8,9 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     StructField::StructField()
-        : arraySize_(0)
+        : Node(NodeKind::StructField)
+        , typeDeclaration_(nullptr)
+        , arraySize_(0)
         , isConst_(false)
         , isVector_(false)
     {
@@ -24,16 +26,31 @@ namespace swizzle { namespace ast { namespace nodes {
         return name_;
     }
 
-    void StructField::type(const std::string& type)
+    void StructField::type(const boost::string_view& type)
     {
-        type_ = type;
+        type_ = Symbol::intern(type);
     }
 
-    std::string StructField::type() const
+    boost::string_view StructField::type() const
+    {
+        return type_.view();
+    }
+
+    Symbol StructField::typeSymbol() const
     {
         return type_;
     }
 
+    void StructField::typeDeclaration(Node* declaration)
+    {
+        typeDeclaration_ = declaration;
+    }
+
+    Node* StructField::typeDeclaration() const
+    {
+        return typeDeclaration_;
+    }
+
     void StructField::setConst()
     {
         isConst_ = true;
@@ -92,6 +109,16 @@ namespace swizzle { namespace ast { namespace nodes {
         return vectorOnField_;
     }
 
+    void StructField::layout(const FieldLayout& layout)
+    {
+        layout_ = layout;
+    }
+
+    const FieldLayout& StructField::layout() const
+    {
+        return layout_;
+    }
+
     void StructField::accept(VisitorInterface& visitor)
     {
         visitor(*this);
@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     TypeAlias::TypeAlias(const lexer::TokenInfo& info, const lexer::TokenInfo& aliasedInfo)
-        : info_(info)
+        : Node(NodeKind::TypeAlias)
+        , info_(info)
         , aliasedType_(aliasedInfo)
         , existingType_(lexer::Token(), lexer::FileInfo(info.fileInfo().filename()))
     {
@@ -4,7 +4,8 @@
 namespace swizzle { namespace ast { namespace nodes {
 
     VariableBlock::VariableBlock(const lexer::TokenInfo& variableBlockInfo)
-        : variableBlockInfo_(variableBlockInfo)
+        : Node(NodeKind::VariableBlock)
+        , variableBlockInfo_(variableBlockInfo)
     {
     }
 
@@ -23,6 +24,16 @@ namespace swizzle { namespace ast { namespace nodes {
         return variableOnFieldInfo_;
     }
 
+    void VariableBlock::layout(const FieldLayout& layout)
+    {
+        layout_ = layout;
+    }
+
+    const FieldLayout& VariableBlock::layout() const
+    {
+        return layout_;
+    }
+
     void VariableBlock::accept(VisitorInterface& visitor)
     {
         visitor(*this);
@@ -2,6 +2,12 @@
 
 namespace swizzle { namespace ast { namespace nodes {
 
+    VariableBlockCase::VariableBlockCase()
+        : Node(NodeKind::VariableBlockCase)
+        , typeDeclaration_(nullptr)
+    {
+    }
+
     void VariableBlockCase::value(const lexer::TokenInfo& value)
     {
         value_ = value;
@@ -21,4 +27,14 @@ namespace swizzle { namespace ast { namespace nodes {
     {
         return type_;
     }
+
+    void VariableBlockCase::typeDeclaration(Node* declaration)
+    {
+        typeDeclaration_ = declaration;
+    }
+
+    Node* VariableBlockCase::typeDeclaration() const
+    {
+        return typeDeclaration_;
+    }
 }}}
@@ -0,0 +1,79 @@
+#include <swizzle/bench/Compare.hpp>
+
+#include <swizzle/Exceptions.hpp>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace swizzle { namespace bench {
+
+    std::vector<Comparison> compare(const Results& baseline, const Results& current, double threshold)
+    {
+        if(baseline.build() != current.build())
+        {
+            throw IncomparableBenchmarkResults("baseline build \"" + baseline.build() + "\" differs from \"" + current.build() + "\"");
+        }
+
+        if(baseline.schema() != current.schema())
+        {
+            throw IncomparableBenchmarkResults("baseline schema differs from the current one, record both with the same schema arguments");
+        }
+
+        std::vector<Comparison> comparisons;
+
+        for(const auto& benchmark : current.samples())
+        {
+            const auto base = baseline.samples().find(benchmark.first);
+            if(base == baseline.samples().end() || !boost::algorithm::ends_with(benchmark.first, "_per_second"))
+            {
+                continue;
+            }
+
+            Comparison comparison;
+            comparison.Benchmark = benchmark.first;
+            comparison.Baseline = median(base->second);
+            comparison.Current = median(benchmark.second);
+            comparison.Range = medianInterval(benchmark.second);
+            comparison.Change = comparison.Baseline > 0 ? comparison.Current / comparison.Baseline - 1 : 0;
+            comparison.Regressed = comparison.Range.High < comparison.Baseline * (1 - threshold);
+
+            comparisons.push_back(comparison);
+        }
+
+        return comparisons;
+    }
+
+    bool regressed(const std::vector<Comparison>& comparisons)
+    {
+        return std::any_of(comparisons.begin(), comparisons.end(), [](const Comparison& c){ return c.Regressed; });
+    }
+
+    void print(std::ostream& os, const std::vector<Comparison>& comparisons)
+    {
+        const auto flags = os.flags();
+        const auto precision = os.precision();
+
+        os << std::fixed << std::setprecision(2);
+        os << "  " << std::left << std::setw(28) << "benchmark" << std::right
+            << std::setw(16) << "baseline" << std::setw(16) << "current" << std::setw(34) << "95% interval" << std::setw(10) << "change" << "\n";
+
+        for(const auto& c : comparisons)
+        {
+            std::ostringstream interval;
+            interval << std::fixed << std::setprecision(2) << "[" << c.Range.Low << ", " << c.Range.High << "]";
+
+            os << "  " << std::left << std::setw(28) << c.Benchmark << std::right
+                << std::setw(16) << c.Baseline
+                << std::setw(16) << c.Current
+                << std::setw(34) << interval.str()
+                << std::setw(9) << (c.Change * 100) << "%"
+                << (c.Regressed ? "  REGRESSED" : "") << "\n";
+        }
+
+        os.precision(precision);
+        os.flags(flags);
+    }
+}}
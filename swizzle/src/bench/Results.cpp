@@ -0,0 +1,387 @@
+#include <swizzle/bench/Results.hpp>
+
+#include <swizzle/bench/Statistics.hpp>
+#include <swizzle/Exceptions.hpp>
+
+#include <cctype>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+
+namespace swizzle { namespace bench {
+
+    namespace {
+
+        // just enough JSON for printJson() output: objects, arrays, strings
+        // without escapes other than \" and \\, numbers and literals
+        class JsonReader
+        {
+        public:
+            explicit JsonReader(const std::string& text)
+                : text_(text)
+            {
+            }
+
+            // calls @member(key) with the reader positioned on each value, which @member must consume
+            void object(const std::function<void(const std::string&)>& member)
+            {
+                expect('{');
+                if(peek() == '}')
+                {
+                    ++position_;
+                    return;
+                }
+
+                do
+                {
+                    const auto key = string();
+                    expect(':');
+                    member(key);
+                }
+                while(next(',', '}'));
+            }
+
+            void array(const std::function<void()>& element)
+            {
+                expect('[');
+                if(peek() == ']')
+                {
+                    ++position_;
+                    return;
+                }
+
+                do
+                {
+                    element();
+                }
+                while(next(',', ']'));
+            }
+
+            std::string string()
+            {
+                expect('"');
+
+                std::string value;
+                while(position_ < text_.size() && text_[position_] != '"')
+                {
+                    if(text_[position_] == '\\' && (position_ + 1) < text_.size())
+                    {
+                        ++position_;
+                    }
+
+                    value += text_[position_++];
+                }
+
+                expect('"');
+                return value;
+            }
+
+            double number()
+            {
+                peek();
+
+                const char* begin = text_.c_str() + position_;
+                char* end = nullptr;
+                const double value = std::strtod(begin, &end);
+
+                if(end == begin)
+                {
+                    fail("expected a number");
+                }
+
+                position_ += static_cast<std::size_t>(end - begin);
+                return value;
+            }
+
+            void skip()
+            {
+                switch(peek())
+                {
+                case '{': object([this](const std::string&){ skip(); }); break;
+                case '[': array([this]{ skip(); }); break;
+                case '"': string(); break;
+                case 't': literal("true"); break;
+                case 'f': literal("false"); break;
+                case 'n': literal("null"); break;
+                default: number(); break;
+                }
+            }
+
+            void end()
+            {
+                if(peek() != '\0')
+                {
+                    fail("trailing characters");
+                }
+            }
+
+        private:
+            char peek()
+            {
+                while(position_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[position_])))
+                {
+                    ++position_;
+                }
+
+                return position_ < text_.size() ? text_[position_] : '\0';
+            }
+
+            void expect(const char c)
+            {
+                if(peek() != c)
+                {
+                    fail(std::string("expected '") + c + "'");
+                }
+
+                ++position_;
+            }
+
+            // true after @separator, false after @close
+            bool next(const char separator, const char close)
+            {
+                const auto c = peek();
+                if(c != separator && c != close)
+                {
+                    fail(std::string("expected '") + separator + "' or '" + close + "'");
+                }
+
+                ++position_;
+                return c == separator;
+            }
+
+            void literal(const std::string& word)
+            {
+                if(text_.compare(position_, word.size(), word) != 0)
+                {
+                    fail("expected " + word);
+                }
+
+                position_ += word.size();
+            }
+
+            [[noreturn]] void fail(const std::string& what) const
+            {
+                throw InvalidBenchmarkResults(what + " at offset " + std::to_string(position_));
+            }
+
+        private:
+            const std::string& text_;
+            std::size_t position_ = 0;
+        };
+
+        SchemaOptions readSchema(JsonReader& reader)
+        {
+            SchemaOptions schema;
+
+            const std::map<std::string, std::size_t SchemaOptions::*> counts = {
+                { "files", &SchemaOptions::Files },
+                { "structs", &SchemaOptions::Structs },
+                { "fields", &SchemaOptions::Fields },
+                { "enums", &SchemaOptions::Enums },
+                { "enum_values", &SchemaOptions::EnumValues },
+                { "bitfields", &SchemaOptions::Bitfields },
+                { "bitfield_fields", &SchemaOptions::BitfieldFields },
+                { "variable_blocks", &SchemaOptions::VariableBlocks },
+                { "namespace_depth", &SchemaOptions::NamespaceDepth },
+                { "attributes", &SchemaOptions::Attributes },
+                { "import_fan_out", &SchemaOptions::ImportFanOut },
+            };
+
+            reader.object([&](const std::string& key)
+            {
+                const auto count = counts.find(key);
+                if(count != counts.end())
+                {
+                    schema.*(count->second) = static_cast<std::size_t>(reader.number());
+                }
+                else if(key == "seed")
+                {
+                    schema.Seed = static_cast<std::uint64_t>(reader.number());
+                }
+                else
+                {
+                    reader.skip();
+                }
+            });
+
+            return schema;
+        }
+    }
+
+    Results::Results(const std::string& build, const SchemaOptions& schema)
+        : build_(build)
+        , schema_(schema)
+    {
+    }
+
+    void Results::add(const std::string& benchmark, double value)
+    {
+        samples_[benchmark].push_back(value);
+    }
+
+    void Results::print(std::ostream& os) const
+    {
+        const auto flags = os.flags();
+        const auto precision = os.precision();
+
+        os << std::fixed << std::setprecision(2);
+        os << "  " << std::left << std::setw(28) << "benchmark" << std::right << std::setw(16) << "median" << std::setw(10) << "samples" << "\n";
+
+        for(const auto& benchmark : samples_)
+        {
+            os << "  " << std::left << std::setw(28) << benchmark.first << std::right
+                << std::setw(16) << median(benchmark.second)
+                << std::setw(10) << benchmark.second.size() << "\n";
+        }
+
+        os.precision(precision);
+        os.flags(flags);
+    }
+
+    std::string buildDescription()
+    {
+        std::string description;
+
+#if defined(__clang__)
+        description = "clang " __clang_version__;
+#elif defined(__GNUC__)
+        description = "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+        description = "msvc " + std::to_string(_MSC_VER);
+#else
+        description = "unknown compiler";
+#endif
+
+#if defined(__OPTIMIZE__) || (defined(_MSC_VER) && defined(NDEBUG))
+        description += ", optimized";
+#else
+        description += ", unoptimized";
+#endif
+
+#if defined(NDEBUG)
+        description += ", NDEBUG";
+#endif
+
+        return description;
+    }
+
+    void Results::printJson(std::ostream& os) const
+    {
+        const auto precision = os.precision();
+        os << std::setprecision(9);
+
+        os << "{\n";
+        os << "  \"build\": \"" << build_ << "\",\n";
+        os << "  \"schema\": { \"files\": " << schema_.Files
+            << ", \"structs\": " << schema_.Structs
+            << ", \"fields\": " << schema_.Fields
+            << ", \"enums\": " << schema_.Enums
+            << ", \"enum_values\": " << schema_.EnumValues
+            << ", \"bitfields\": " << schema_.Bitfields
+            << ", \"bitfield_fields\": " << schema_.BitfieldFields
+            << ", \"variable_blocks\": " << schema_.VariableBlocks
+            << ", \"namespace_depth\": " << schema_.NamespaceDepth
+            << ", \"attributes\": " << schema_.Attributes
+            << ", \"import_fan_out\": " << schema_.ImportFanOut
+            << ", \"seed\": " << schema_.Seed << " },\n";
+
+        os << "  \"benchmarks\": {";
+
+        bool first = true;
+        for(const auto& benchmark : samples_)
+        {
+            os << (first ? "\n" : ",\n") << "    \"" << benchmark.first << "\": { \"median\": " << median(benchmark.second) << ", \"samples\": [";
+            for(std::size_t i = 0; i < benchmark.second.size(); ++i)
+            {
+                os << (i == 0 ? " " : ", ") << benchmark.second[i];
+            }
+
+            os << " ] }";
+            first = false;
+        }
+
+        os << "\n  }\n}\n";
+        os.precision(precision);
+    }
+
+    Results readResults(std::istream& is)
+    {
+        const std::string text((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+
+        std::string build;
+        SchemaOptions schema;
+        Results::Samples samples;
+        bool found = false;
+
+        JsonReader reader(text);
+        reader.object([&](const std::string& key)
+        {
+            if(key == "build")
+            {
+                build = reader.string();
+                return;
+            }
+
+            if(key == "schema")
+            {
+                schema = readSchema(reader);
+                return;
+            }
+
+            if(key != "benchmarks")
+            {
+                reader.skip();
+                return;
+            }
+
+            found = true;
+            reader.object([&](const std::string& benchmark)
+            {
+                auto& measured = samples[benchmark];
+                double median = 0;
+                bool hasMedian = false;
+
+                reader.object([&](const std::string& field)
+                {
+                    if(field == "samples")
+                    {
+                        reader.array([&]{ measured.push_back(reader.number()); });
+                    }
+                    else if(field == "median")
+                    {
+                        median = reader.number();
+                        hasMedian = true;
+                    }
+                    else
+                    {
+                        reader.skip();
+                    }
+                });
+
+                if(measured.empty() && hasMedian)
+                {
+                    measured.push_back(median);
+                }
+            });
+        });
+
+        reader.end();
+
+        if(!found)
+        {
+            throw InvalidBenchmarkResults("no \"benchmarks\" object");
+        }
+
+        Results results(build, schema);
+        for(const auto& benchmark : samples)
+        {
+            for(const auto sample : benchmark.second)
+            {
+                results.add(benchmark.first, sample);
+            }
+        }
+
+        return results;
+    }
+}}
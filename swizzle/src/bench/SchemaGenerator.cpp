@@ -0,0 +1,274 @@
+#include <swizzle/bench/SchemaGenerator.hpp>
+
+#include <swizzle/driver/WriteIfChanged.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+
+namespace swizzle { namespace bench {
+
+    namespace {
+
+        // splitmix64, std:: distributions differ between standard libraries
+        class Random
+        {
+        public:
+            explicit Random(std::uint64_t seed)
+                : state_(seed)
+            {
+            }
+
+            std::uint64_t next()
+            {
+                auto z = (state_ += 0x9E3779B97F4A7C15ULL);
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                return z ^ (z >> 31);
+            }
+
+            // [0, n)
+            std::size_t below(std::size_t n)
+            {
+                return n == 0 ? 0 : static_cast<std::size_t>(next() % n);
+            }
+
+        private:
+            std::uint64_t state_;
+        };
+
+        const char* const Scalars[] = { "u8", "i8", "u16", "i16", "u32", "i32", "u64", "i64", "f32", "f64" };
+        const char* const Integers[] = { "u8", "u16", "u32" };
+
+        const std::size_t MaxBitfieldFields = 16;
+
+        std::string name(const char* prefix, std::size_t file, std::size_t index)
+        {
+            std::ostringstream os;
+            os << prefix << file << "_" << index;
+            return os.str();
+        }
+
+        void attributes(std::ostream& os, Random& random, std::size_t count, const char* indent)
+        {
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                os << indent << "@attribute" << i;
+
+                switch(random.below(4))
+                {
+                case 0: break;
+                case 1: os << "=" << random.below(1000); break;
+                case 2: os << "=\"value" << random.below(1000) << "\""; break;
+                default: os << "{field" << random.below(1000) << " != 0}"; break;
+                }
+
+                os << "\n";
+            }
+        }
+    }
+
+    SchemaGenerator::SchemaGenerator(const SchemaOptions& options)
+        : options_(options)
+    {
+    }
+
+    std::string SchemaGenerator::ns() const
+    {
+        std::string ns = "bench";
+        for(std::size_t level = 1; level < options_.NamespaceDepth; ++level)
+        {
+            ns += "::level" + std::to_string(level);
+        }
+
+        return ns;
+    }
+
+    boost::filesystem::path SchemaGenerator::path(const std::size_t file) const
+    {
+        boost::filesystem::path path = "bench";
+        for(std::size_t level = 1; level < options_.NamespaceDepth; ++level)
+        {
+            path /= "level" + std::to_string(level);
+        }
+
+        return path / ("Schema" + std::to_string(file) + ".swizzle");
+    }
+
+    std::string SchemaGenerator::source(const std::size_t file) const
+    {
+        // each file has its own stream so files can be made in any order
+        Random random(options_.Seed ^ (0x51A5C0DEULL * (file + 1)));
+        std::ostringstream os;
+
+        const auto ns = this->ns();
+        const auto fanOut = std::min(options_.ImportFanOut, file);
+
+        os << "// generated by swizzle::bench::SchemaGenerator, seed " << options_.Seed << "\n";
+        for(std::size_t i = 1; i <= fanOut; ++i)
+        {
+            os << "import " << ns << "::Schema" << (file - i) << ";\n";
+        }
+
+        os << "namespace " << ns << ";\n\n";
+
+        for(std::size_t e = 0; e < options_.Enums; ++e)
+        {
+            const bool wide = options_.EnumValues > 256;
+
+            attributes(os, random, options_.Attributes, "");
+            os << "enum " << name("Enum", file, e) << " : " << (wide ? "u16" : "u8") << " {\n";
+
+            for(std::size_t v = 0; v < options_.EnumValues; ++v)
+            {
+                os << "\tValue" << v;
+
+                switch(random.below(3))
+                {
+                case 0: break;
+                case 1: os << " = " << v; break;
+                default: os << " = 0x" << std::hex << std::setfill('0') << std::setw(wide ? 4 : 2) << v << std::dec << std::setfill(' '); break;    // the lexer wants whole bytes
+                }
+
+                os << ",\n";
+            }
+
+            os << "}\n\n";
+        }
+
+        for(std::size_t b = 0; b < options_.Bitfields; ++b)
+        {
+            const auto fields = std::min(options_.BitfieldFields, MaxBitfieldFields);
+
+            std::ostringstream body;
+            std::size_t bit = 0;
+            for(std::size_t f = 0; f < fields; ++f)
+            {
+                if(random.below(2) == 0)
+                {
+                    body << "\tflag" << f << " : " << bit << ",\n";
+                    bit += 1;
+                }
+                else
+                {
+                    body << "\trange" << f << " : " << bit << ".." << (bit + 1) << ",\n";
+                    bit += 2;
+                }
+            }
+
+            attributes(os, random, options_.Attributes, "");
+            os << "bitfield " << name("Flags", file, b) << " : " << (bit <= 8 ? "u8" : bit <= 16 ? "u16" : "u32") << " {\n"
+                << body.str() << "}\n\n";
+        }
+
+        const auto variableBlocks = std::min(options_.VariableBlocks, options_.Structs);
+        for(std::size_t s = 0; s < options_.Structs; ++s)
+        {
+            // the last structs end in a variable_block over structs declared before them
+            const bool variableBlock = (s > 0) && (s >= options_.Structs - variableBlocks);
+
+            attributes(os, random, options_.Attributes, "");
+            os << "struct " << name("Message", file, s) << " {\n";
+
+            std::vector<std::string> sizes;     // integer fields a vector can be sized by
+            if(variableBlock)
+            {
+                os << "\tu8 kind;\n";
+            }
+
+            for(std::size_t f = 0; f < options_.Fields; ++f)
+            {
+                attributes(os, random, options_.Attributes, "\t");
+                os << "\t";
+
+                const auto field = "field" + std::to_string(f);
+                switch(random.below(10))
+                {
+                case 4:
+                    if(options_.Enums != 0)
+                    {
+                        os << name("Enum", file, random.below(options_.Enums));
+                        break;
+                    }
+                    // fall through
+                case 5:
+                    if(options_.Bitfields != 0)
+                    {
+                        os << name("Flags", file, random.below(options_.Bitfields));
+                        break;
+                    }
+                    // fall through
+                case 6:
+                    if(s != 0)
+                    {
+                        os << name("Message", file, random.below(s));
+                        break;
+                    }
+                    // fall through
+                case 7:
+                    if(fanOut != 0)
+                    {
+                        os << ns << "::" << name("Message", file - 1 - random.below(fanOut), 0);
+                        break;
+                    }
+                    // fall through
+                case 8:
+                    os << "u8[" << (1 + random.below(32)) << "]";
+                    break;
+
+                case 9:
+                    if(!sizes.empty())
+                    {
+                        os << Scalars[random.below(10)] << "[" << sizes[random.below(sizes.size())] << "]";
+                        break;
+                    }
+                    // fall through
+                default:
+                    {
+                        const auto type = random.below(4);
+                        if(type < 3)
+                        {
+                            os << Integers[type];
+                            sizes.push_back(field);
+                        }
+                        else
+                        {
+                            os << Scalars[random.below(10)];
+                        }
+                    }
+                    break;
+                }
+
+                os << " " << field << ";\n";
+            }
+
+            if(variableBlock)
+            {
+                os << "\n\tvariable_block : kind {\n";
+                for(std::size_t c = 0, cases = std::min<std::size_t>(s, 4); c < cases; ++c)
+                {
+                    os << "\t\tcase " << c << " : " << name("Message", file, s - 1 - c) << ",\n";
+                }
+
+                os << "\t}\n";
+            }
+
+            os << "}\n\n";
+        }
+
+        return os.str();
+    }
+
+    std::vector<boost::filesystem::path> SchemaGenerator::write(const boost::filesystem::path& root) const
+    {
+        std::vector<boost::filesystem::path> paths;
+        for(std::size_t file = 0; file < files(); ++file)
+        {
+            paths.push_back(path(file));
+            driver::writeIfChanged(root / paths.back(), source(file));
+        }
+
+        return paths;
+    }
+}}
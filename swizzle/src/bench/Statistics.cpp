@@ -0,0 +1,43 @@
+#include <swizzle/bench/Statistics.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace swizzle { namespace bench {
+
+    double median(std::vector<double> samples)
+    {
+        if(samples.empty())
+        {
+            return 0;
+        }
+
+        std::sort(samples.begin(), samples.end());
+
+        const auto middle = samples.size() / 2;
+        return (samples.size() % 2) ? samples[middle] : (samples[middle - 1] + samples[middle]) / 2;
+    }
+
+    Interval medianInterval(std::vector<double> samples)
+    {
+        Interval interval;
+        if(samples.empty())
+        {
+            return interval;
+        }
+
+        std::sort(samples.begin(), samples.end());
+
+        // ranks n/2 -+ 1.96 * sqrt(n)/2, 1 based
+        const double n = static_cast<double>(samples.size());
+        const double spread = 1.96 * std::sqrt(n) / 2;
+
+        const auto low = static_cast<std::size_t>(std::max(1.0, std::round(n / 2 - spread)));
+        const auto high = static_cast<std::size_t>(std::min(n, std::round(n / 2 + 1 + spread)));
+
+        interval.Low = samples[low - 1];
+        interval.High = samples[high - 1];
+
+        return interval;
+    }
+}}
@@ -0,0 +1,145 @@
+#include <swizzle/codegen/Cpp.hpp>
+
+#include <swizzle/ast/AbstractSyntaxTree.hpp>
+#include <swizzle/ast/nodes/Bitfield.hpp>
+#include <swizzle/ast/nodes/Enum.hpp>
+#include <swizzle/ast/nodes/Import.hpp>
+#include <swizzle/ast/nodes/Namespace.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/codegen/detail/Dispatch.hpp>
+#include <swizzle/codegen/detail/EmitColumns.hpp>
+#include <swizzle/codegen/detail/EmitDecoder.hpp>
+#include <swizzle/codegen/detail/EmitEncoder.hpp>
+#include <swizzle/codegen/detail/EmitEnumNames.hpp>
+#include <swizzle/codegen/detail/EmitMetadata.hpp>
+#include <swizzle/codegen/detail/EmitTypes.hpp>
+#include <swizzle/codegen/detail/EmitView.hpp>
+#include <swizzle/codegen/detail/Members.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+namespace swizzle { namespace codegen {
+
+    namespace {
+
+        // "foo::bar" -> "namespace foo { namespace bar {"
+        void openNamespace(std::ostream& os, const boost::string_view& name, std::size_t& depth)
+        {
+            std::size_t begin = 0;
+            while(begin < name.size())
+            {
+                const auto end = std::min(name.find("::", begin), name.size());
+
+                os << (depth ? " " : "") << "namespace " << name.substr(begin, end - begin) << " {";
+                ++depth;
+
+                begin = end + 2;
+            }
+
+            os << "\n\n";
+        }
+    }
+
+    std::string cppHeaderName(const boost::filesystem::path& module)
+    {
+        auto output = module.is_absolute() ? module.filename() : module;
+        output.replace_extension(".hpp");
+
+        return output.generic_string();
+    }
+
+    std::string generateCpp(const ast::AbstractSyntaxTree& ast)
+    {
+        const auto& root = *ast.root();
+        const auto bitfields = std::any_of(root.children().begin(), root.children().end(),
+            [](const ast::Node::smartptr& child) { return child->kind() == ast::NodeKind::Bitfield; });
+        const auto columns = std::any_of(root.children().begin(), root.children().end(),
+            [](const ast::Node::smartptr& child) { return (child->kind() == ast::NodeKind::Struct) && detail::hasColumns(static_cast<const ast::nodes::Struct&>(*child)); });
+
+        std::ostringstream os;
+        os << "// generated by swizzle, do not edit\n"
+           << "#pragma once\n"
+           << "#include <swizzle/runtime/Arena.hpp>\n"
+           << (bitfields ? "#include <swizzle/runtime/Bits.hpp>\n" : "")
+           << "#include <swizzle/runtime/ByteOrder.hpp>\n"
+           << "#include <swizzle/runtime/ByteSwap.hpp>\n"
+           << (columns ? "#include <swizzle/runtime/Columns.hpp>\n" : "")
+           << "#include <swizzle/runtime/Range.hpp>\n"
+           << "#include <swizzle/runtime/Reflection.hpp>\n\n";
+
+        bool imports = false;
+        for(const auto& child : root.children())
+        {
+            if(child->kind() == ast::NodeKind::Import)
+            {
+                os << "#include <" << cppHeaderName(static_cast<const ast::nodes::Import&>(*child).path()) << ">\n";
+                imports = true;
+            }
+        }
+
+        os << (imports ? "\n" : "")
+           << "#include <algorithm>\n"
+           << "#include <array>\n"
+           << "#include <cstddef>\n"
+           << "#include <cstdint>\n"
+           << "#include <cstring>\n"
+           << "#include <string>\n"
+           << "#include <tuple>\n"
+           << "#include <vector>\n\n";
+
+        std::size_t depth = 0;
+        for(const auto& child : root.children())
+        {
+            switch(child->kind())
+            {
+                case ast::NodeKind::Namespace:
+                    openNamespace(os, static_cast<const ast::nodes::Namespace&>(*child).info().token().value(), depth);
+                    break;
+
+                case ast::NodeKind::Enum:
+                    detail::emitEnum(os, static_cast<const ast::nodes::Enum&>(*child));
+                    detail::emitEnumNames(os, static_cast<const ast::nodes::Enum&>(*child));
+                    detail::emitMetadata(os, static_cast<const ast::nodes::Enum&>(*child));
+                    break;
+
+                case ast::NodeKind::Bitfield:
+                    detail::emitBitfield(os, static_cast<const ast::nodes::Bitfield&>(*child));
+                    detail::emitMetadata(os, static_cast<const ast::nodes::Bitfield&>(*child));
+                    break;
+
+                case ast::NodeKind::Struct:
+                {
+                    const auto& node = static_cast<const ast::nodes::Struct&>(*child);
+                    detail::emitValueType(os, node);
+
+                    for(const auto& member : detail::members(node))
+                    {
+                        if(member.Block)
+                        {
+                            detail::emitDispatch(os, detail::analyzeDispatch(node, *member.Block, member.Name));
+                        }
+                    }
+
+                    detail::emitDecoder(os, node);
+                    detail::emitEncoder(os, node);
+                    detail::emitView(os, node);
+
+                    if(detail::hasColumns(node))
+                    {
+                        detail::emitColumns(os, node);
+                    }
+
+                    detail::emitMetadata(os, node);
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+
+        os << std::string(depth, '}') << (depth ? "\n" : "");
+        return os.str();
+    }
+}}
@@ -0,0 +1,143 @@
+#include <swizzle/codegen/detail/CppNames.hpp>
+
+#include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/nodes/Attribute.hpp>
+#include <swizzle/ast/nodes/Bitfield.hpp>
+#include <swizzle/ast/nodes/Enum.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    namespace {
+
+        // the C++14 keywords and alternative tokens, and the names generated views
+        // declare themselves. Sorted, for std::binary_search
+        const char* const Reserved[] = {
+            "FixedPrefix", "MinSize", "Size", "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor",
+            "bool", "break", "case", "catch", "char", "char16_t", "char32_t", "class", "compl", "const", "const_cast",
+            "constexpr", "continue", "decltype", "default", "delete", "do", "double", "dynamic_cast", "else", "enum",
+            "explicit", "export", "extern", "false", "float", "for", "friend", "goto", "if", "inline", "int", "isValid",
+            "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr", "operator", "or", "or_eq",
+            "private", "protected", "public", "read", "register", "reinterpret_cast", "return", "short", "signed",
+            "sizeof", "static", "static_assert", "static_cast", "struct", "switch", "template", "this", "thread_local",
+            "throw", "true", "try", "typedef", "typeid", "typename", "union", "unsigned", "using", "virtual", "void",
+            "volatile", "wchar_t", "while", "wireSize", "xor", "xor_eq",
+        };
+
+        bool isReserved(const std::string& name)
+        {
+            return std::binary_search(std::begin(Reserved), std::end(Reserved), name, [](const std::string& a, const std::string& b) { return a < b; });
+        }
+    }
+
+    std::string cppBuiltinType(const boost::string_view& type)
+    {
+        if(type == "u8") return "std::uint8_t";
+        if(type == "i8") return "std::int8_t";
+        if(type == "u16") return "std::uint16_t";
+        if(type == "i16") return "std::int16_t";
+        if(type == "u32") return "std::uint32_t";
+        if(type == "i32") return "std::int32_t";
+        if(type == "u64") return "std::uint64_t";
+        if(type == "i64") return "std::int64_t";
+        if(type == "f32") return "float";
+        if(type == "f64") return "double";
+
+        return std::string();
+    }
+
+    std::string cppQualifiedName(const boost::string_view& name)
+    {
+        // declarations outside of any namespace are named "::Bar"
+        return name.starts_with("::") ? name.to_string() : "::" + name.to_string();
+    }
+
+    std::string cppShortName(const boost::string_view& name)
+    {
+        const auto colon = name.rfind(':');
+        return (colon == boost::string_view::npos ? name : name.substr(colon + 1)).to_string();
+    }
+
+    std::string cppIdentifier(const boost::string_view& name)
+    {
+        auto result = name.to_string();
+        return isReserved(result) ? result + "_" : result;
+    }
+
+    std::string cppValueType(const ast::nodes::StructField& field)
+    {
+        const auto declaration = field.typeDeclaration();
+        if(!declaration)
+        {
+            return cppBuiltinType(field.type());
+        }
+
+        switch(declaration->kind())
+        {
+            case ast::NodeKind::Enum: return cppQualifiedName(static_cast<const ast::nodes::Enum&>(*declaration).name());
+            case ast::NodeKind::Bitfield: return cppQualifiedName(static_cast<const ast::nodes::Bitfield&>(*declaration).name());
+            default: return cppQualifiedName(static_cast<const ast::nodes::Struct&>(*declaration).name());
+        }
+    }
+
+    std::string cppByteOrder(const ast::nodes::Struct& structure, const ast::nodes::StructField& field)
+    {
+        const auto big = hasAttribute(field, "@big_endian")
+            || (!hasAttribute(field, "@little_endian") && hasAttribute(structure, "@big_endian"));
+
+        return big ? "::swizzle::runtime::ByteOrder::Big" : "::swizzle::runtime::ByteOrder::Little";
+    }
+
+    std::string cppMemberPath(const boost::string_view& path, const std::string& call)
+    {
+        std::string result;
+
+        std::size_t begin = 0;
+        while(begin <= path.size())
+        {
+            const auto end = std::min(path.find('.', begin), path.size());
+
+            result += (result.empty() ? "" : ".") + cppIdentifier(path.substr(begin, end - begin)) + call;
+            begin = end + 1;
+        }
+
+        return result;
+    }
+
+    std::string cppStringLiteral(const boost::string_view& text)
+    {
+        std::string result = "\"";
+
+        for(const auto c : text)
+        {
+            switch(c)
+            {
+                case '"': result += "\\\""; break;
+                case '\\': result += "\\\\"; break;
+                case '\n': result += "\\n"; break;
+                case '\r': result += "\\r"; break;
+                case '\t': result += "\\t"; break;
+                default: result += c; break;
+            }
+        }
+
+        return result + "\"";
+    }
+
+    bool hasAttribute(const ast::Node& node, const boost::string_view& attribute)
+    {
+        for(const auto& child : node.children())
+        {
+            if((child->kind() == ast::NodeKind::Attribute) && (static_cast<const ast::nodes::Attribute&>(*child).info().token().value() == attribute))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}}}
@@ -0,0 +1,413 @@
+#include <swizzle/codegen/detail/Dispatch.hpp>
+
+#include <swizzle/Exceptions.hpp>
+#include <swizzle/ast/nodes/Enum.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/VariableBlock.hpp>
+#include <swizzle/ast/nodes/VariableBlockCase.hpp>
+#include <swizzle/codegen/detail/CppNames.hpp>
+#include <swizzle/codegen/detail/Members.hpp>
+#include <swizzle/lexer/TokenInfo.hpp>
+#include <swizzle/types/SetValue.hpp>
+#include <swizzle/types/SizeOf.hpp>
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <set>
+#include <type_traits>
+#include <utility>
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    namespace {
+
+        // fewer cases than this are left to the compiler's switch, a few compares beat any table
+        constexpr std::size_t MinCases = 4;
+
+        // a Table is used while at least half of its range is cases, and it stays small
+        constexpr std::uint64_t MaxTableSize = 4096;
+
+        // perfect hash tables of 2, 4 then 8 slots per case, each tried with this many multipliers
+        constexpr unsigned MaxHashGrowth = 3;
+        constexpr std::size_t HashAttempts = 1000;
+
+        // the value's bits as an unsigned integer of the same width, what KeyType holds
+        struct AsUnsigned : boost::static_visitor<std::uint64_t>
+        {
+            template<class T>
+            std::uint64_t operator()(const T value) const
+            {
+                return static_cast<typename std::make_unsigned<T>::type>(value);
+            }
+        };
+
+        // C++'s value of the character literal @literal ('a', '\n', '\x41'), false for anything else
+        bool charValue(boost::string_view literal, std::uint64_t& value)
+        {
+            if((literal.size() < 3) || (literal.front() != '\'') || (literal.back() != '\''))
+            {
+                return false;
+            }
+
+            literal = literal.substr(1, literal.size() - 2);
+
+            if(literal.size() == 1)
+            {
+                value = static_cast<unsigned char>(literal[0]);
+                return literal[0] != '\\';
+            }
+
+            if(literal[0] != '\\')
+            {
+                return false;
+            }
+
+            if((literal.size() > 2) && (literal[1] == 'x'))
+            {
+                value = 0;
+                for(const auto c : literal.substr(2))
+                {
+                    if(!std::isxdigit(static_cast<unsigned char>(c)))
+                    {
+                        return false;
+                    }
+
+                    value = value * 16 + (std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : std::tolower(static_cast<unsigned char>(c)) - 'a' + 10);
+                }
+
+                return value <= 0xff;
+            }
+
+            if(literal.size() != 2)
+            {
+                return false;
+            }
+
+            switch(literal[1])
+            {
+                case '0': value = 0; return true;
+                case 'a': value = '\a'; return true;
+                case 'b': value = '\b'; return true;
+                case 'f': value = '\f'; return true;
+                case 'n': value = '\n'; return true;
+                case 'r': value = '\r'; return true;
+                case 't': value = '\t'; return true;
+                case 'v': value = '\v'; return true;
+                case '\\': value = '\\'; return true;
+                case '\'': value = '\''; return true;
+                case '"': value = '"'; return true;
+                default: return false;
+            }
+        }
+
+        // @literal as a value of the discriminator's built in @type, false if it can't be evaluated here
+        bool caseValue(const lexer::TokenInfo& literal, const boost::string_view& type, std::uint64_t& value)
+        {
+            const auto text = literal.token().value();
+
+            try
+            {
+                switch(literal.token().type())
+                {
+                    case lexer::TokenType::char_literal:
+                        return charValue(text, value);
+
+                    case lexer::TokenType::hex_literal:
+                        value = boost::apply_visitor(AsUnsigned(), types::setValue(type, text, types::isHex, "variable_block case value"));
+                        return true;
+
+                    case lexer::TokenType::numeric_literal:
+                        value = boost::apply_visitor(AsUnsigned(), types::setValue(type, text, "variable_block case value"));
+                        return true;
+
+                    default:
+                        return false;
+                }
+            }
+            catch(const std::exception&)
+            {
+                return false;
+            }
+        }
+
+        // the built in type the variable_block switches on, an enum's underlying type for enums
+        std::string discriminatorType(const ast::nodes::Struct& node, const ast::nodes::VariableBlock& block)
+        {
+            const auto field = resolveMember(node, block.variableOnField().token().value());
+            if(!field || field->isArray() || field->isVector())
+            {
+                return std::string();
+            }
+
+            const auto declaration = field->typeDeclaration();
+            if(declaration && (declaration->kind() == ast::NodeKind::Enum))
+            {
+                return static_cast<const ast::nodes::Enum&>(*declaration).underlying().token().to_string();
+            }
+
+            return cppBuiltinType(field->type()).empty() ? std::string() : field->type().to_string();
+        }
+
+        std::uint64_t splitmix64(std::uint64_t& state)
+        {
+            auto z = (state += 0x9e3779b97f4a7c15ULL);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+
+            return z ^ (z >> 31);
+        }
+
+        std::string literal(const std::uint64_t value, const std::string& type)
+        {
+            return std::to_string(value) + (type == "std::uint64_t" ? "ULL" : "U");
+        }
+
+        std::string casesType(const Dispatch& dispatch)
+        {
+            const auto count = dispatch.Literals.size();
+            return (count < 0xff) ? "std::uint8_t" : (count < 0xffff) ? "std::uint16_t" : "std::uint32_t";
+        }
+
+        void emitTable(std::ostream& os, const std::string& type, const std::string& name, const std::vector<std::string>& values)
+        {
+            os << "        static constexpr " << type << " " << name << "[" << values.size() << "] = {";
+
+            for(std::size_t i = 0; i < values.size(); ++i)
+            {
+                os << ((i % 16) ? " " : "\n            ") << values[i] << ",";
+            }
+
+            os << "\n        };\n";
+        }
+
+        template<class T, class Format>
+        std::vector<std::string> format(const std::vector<T>& values, Format f)
+        {
+            std::vector<std::string> result;
+            for(const auto& value : values)
+            {
+                result.push_back(f(value));
+            }
+
+            return result;
+        }
+    }
+
+    bool findPerfectHash(const std::vector<std::uint64_t>& keys, std::uint64_t& multiplier, unsigned& shift)
+    {
+        unsigned bits = 1;
+        while((std::uint64_t(1) << bits) < keys.size())
+        {
+            ++bits;
+        }
+
+        std::uint64_t state = 0;
+        for(unsigned growth = 1; growth <= MaxHashGrowth; ++growth)
+        {
+            const auto slots = std::uint64_t(1) << (bits + growth);
+            if(slots > MaxTableSize)
+            {
+                break;
+            }
+
+            for(std::size_t attempt = 0; attempt < HashAttempts; ++attempt)
+            {
+                const auto candidate = splitmix64(state) | 1;
+                const auto candidateShift = 64 - (bits + growth);
+
+                std::vector<bool> used(slots, false);
+
+                bool collision = false;
+                for(const auto key : keys)
+                {
+                    const auto slot = (key * candidate) >> candidateShift;
+                    if(used[slot])
+                    {
+                        collision = true;
+                        break;
+                    }
+
+                    used[slot] = true;
+                }
+
+                if(!collision)
+                {
+                    multiplier = candidate;
+                    shift = candidateShift;
+
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    Dispatch analyzeDispatch(const ast::nodes::Struct& node, const ast::nodes::VariableBlock& block, const std::string& name)
+    {
+        Dispatch dispatch;
+
+        auto function = cppShortName(node.name()) + static_cast<char>(std::toupper(static_cast<unsigned char>(name[0]))) + name.substr(1) + "Case";
+        function[0] = static_cast<char>(std::tolower(static_cast<unsigned char>(function[0])));
+        dispatch.Function = function;
+
+        const auto type = discriminatorType(node, block);
+        dispatch.KeyType = type.empty() ? std::string() : "std::uint" + std::to_string(types::SizeOf(type) * 8) + "_t";
+
+        std::vector<std::pair<std::uint64_t, std::size_t>> entries;
+        std::map<std::uint64_t, std::string> values;            // the literal first written for each value
+        std::set<std::string> literals;
+        bool evaluated = !type.empty();
+
+        for(const auto& child : block.children())
+        {
+            if(child->kind() != ast::NodeKind::VariableBlockCase)
+            {
+                continue;
+            }
+
+            // a repeated value would be a duplicate label in the generated switch
+            const auto& value = static_cast<const ast::nodes::VariableBlockCase&>(*child).value();
+            if(!literals.insert(value.token().to_string()).second)
+            {
+                throw SyntaxError("variable_block case value repeats an earlier case", value);
+            }
+
+            dispatch.Literals.push_back(value.token().to_string());
+
+            std::uint64_t key = 0;
+            if(!evaluated || !caseValue(value, type, key))
+            {
+                evaluated = false;
+                continue;
+            }
+
+            const auto first = values.emplace(key, value.token().to_string());
+            if(!first.second)
+            {
+                throw SyntaxError("variable_block case value equals that of case " + first.first->second, value);
+            }
+
+            entries.emplace_back(key, dispatch.Literals.size());
+        }
+
+        if(!evaluated || (entries.size() < MinCases))
+        {
+            return dispatch;
+        }
+
+        std::sort(entries.begin(), entries.end());
+
+        const auto min = entries.front().first;
+        const auto range = entries.back().first - min;
+
+        if((range < MaxTableSize) && (range < 2 * entries.size()))
+        {
+            dispatch.Kind = Dispatch::Strategy::Table;
+            dispatch.Min = min;
+            dispatch.Cases.assign(range + 1, 0);
+
+            for(const auto& entry : entries)
+            {
+                dispatch.Cases[entry.first - min] = entry.second;
+            }
+
+            return dispatch;
+        }
+
+        std::vector<std::uint64_t> keys;
+        for(const auto& entry : entries)
+        {
+            keys.push_back(entry.first);
+        }
+
+        if(findPerfectHash(keys, dispatch.Multiplier, dispatch.Shift))
+        {
+            const auto slots = std::size_t(1) << (64 - dispatch.Shift);
+
+            dispatch.Kind = Dispatch::Strategy::PerfectHash;
+            dispatch.Keys.assign(slots, 0);
+            dispatch.Cases.assign(slots, 0);
+
+            for(const auto& entry : entries)
+            {
+                const auto slot = (entry.first * dispatch.Multiplier) >> dispatch.Shift;
+                dispatch.Keys[slot] = entry.first;
+                dispatch.Cases[slot] = entry.second;
+            }
+
+            return dispatch;
+        }
+
+        dispatch.Kind = Dispatch::Strategy::SortedSearch;
+        for(const auto& entry : entries)
+        {
+            dispatch.Keys.push_back(entry.first);
+            dispatch.Cases.push_back(entry.second);
+        }
+
+        return dispatch;
+    }
+
+    void emitDispatch(std::ostream& os, const Dispatch& dispatch)
+    {
+        if(dispatch.Kind == Dispatch::Strategy::Switch)
+        {
+            return;
+        }
+
+        const auto& key = dispatch.KeyType;
+        const auto cases = format(dispatch.Cases, [](const std::size_t c) { return std::to_string(c); });
+        const auto keys = format(dispatch.Keys, [&key](const std::uint64_t k) { return literal(k, key); });
+        const auto size = std::to_string(dispatch.Cases.size());
+
+        os << "    // 1 + the index of the variable_block case @value selects, 0 for none\n"
+           << "    inline std::size_t " << dispatch.Function << "(const " << key << " value)\n"
+           << "    {\n";
+
+        switch(dispatch.Kind)
+        {
+            case Dispatch::Strategy::Table:
+                emitTable(os, casesType(dispatch), "Cases", cases);
+                os << "        const auto slot = static_cast<std::uint64_t>(value) - " << dispatch.Min << "ULL;\n"
+                   << "        return (slot < " << size << ") ? Cases[slot] : 0;\n";
+                break;
+
+            case Dispatch::Strategy::PerfectHash:
+                emitTable(os, key, "Keys", keys);
+                emitTable(os, casesType(dispatch), "Cases", cases);
+                os << "        const auto slot = (static_cast<std::uint64_t>(value) * " << dispatch.Multiplier << "ULL) >> " << dispatch.Shift << ";\n"
+                   << "        return (Keys[slot] == value) ? Cases[slot] : 0;\n";
+                break;
+
+            default:
+                emitTable(os, key, "Keys", keys);
+                emitTable(os, casesType(dispatch), "Cases", cases);
+                os << "        const auto found = std::lower_bound(Keys, Keys + " << size << ", value);\n"
+                   << "        return ((found != Keys + " << size << ") && (*found == value)) ? Cases[found - Keys] : 0;\n";
+                break;
+        }
+
+        os << "    }\n\n";
+    }
+
+    std::string dispatchSwitch(const Dispatch& dispatch, const std::string& discriminator)
+    {
+        if(dispatch.Kind == Dispatch::Strategy::Switch)
+        {
+            return "switch(" + discriminator + ")";
+        }
+
+        return "switch(" + dispatch.Function + "(static_cast<" + dispatch.KeyType + ">(" + discriminator + ")))";
+    }
+
+    std::string dispatchLabel(const Dispatch& dispatch, const std::size_t i)
+    {
+        return "case " + (dispatch.Kind == Dispatch::Strategy::Switch ? dispatch.Literals[i] : std::to_string(i + 1));
+    }
+}}}
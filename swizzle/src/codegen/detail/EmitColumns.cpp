@@ -0,0 +1,563 @@
+#include <swizzle/codegen/detail/EmitColumns.hpp>
+
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/VariableBlock.hpp>
+#include <swizzle/codegen/detail/CppNames.hpp>
+#include <swizzle/codegen/detail/Dispatch.hpp>
+#include <swizzle/codegen/detail/Members.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    namespace {
+
+        // a field of FooColumns, one entry per message except for vectors
+        struct Column
+        {
+            enum class Kind
+            {
+                Scalar,         // a built in, enum or bitfield
+                Array,          // std::array of scalars
+                Value,          // a decoded struct, or std::array of them
+                Vector,         // the elements of every message back to back, indexed by <name>_begin
+            };
+
+            Kind Type = Kind::Scalar;
+            std::string Name;                                   // "header_length" for a field of a nested fixed size struct
+            const ast::nodes::Struct* Owner = nullptr;          // declares Field, for its byte order
+            const ast::nodes::StructField* Field = nullptr;
+            std::size_t Member = 0;                             // index of the top level member it is read from
+            std::size_t Offset = 0;                             // from the start of that member
+        };
+
+        // a nested struct whose fields become columns of their own
+        bool flattens(const ast::nodes::Struct& node)
+        {
+            const auto all = members(node);
+            return node.layout().fixed() && std::all_of(all.begin(), all.end(), [](const Member& m) { return m.Field != nullptr; });
+        }
+
+        void flatten(const ast::nodes::Struct& owner, const ast::nodes::StructField& field, const std::string& name,
+                     const std::size_t member, const std::size_t offset, std::vector<Column>& result)
+        {
+            const auto element = structType(field);
+
+            if(element && !field.isArray() && !field.isVector() && flattens(*element))
+            {
+                for(const auto& m : members(*element))
+                {
+                    flatten(*element, *m.Field, name + "_" + m.Name, member, offset + m.Layout->Offset, result);
+                }
+
+                return;
+            }
+
+            Column column;
+            column.Type = field.isVector() ? Column::Kind::Vector
+                        : element ? Column::Kind::Value
+                        : field.isArray() ? Column::Kind::Array
+                        : Column::Kind::Scalar;
+            column.Name = name;
+            column.Owner = &owner;
+            column.Field = &field;
+            column.Member = member;
+            column.Offset = offset;
+
+            result.push_back(column);
+        }
+
+        std::vector<Column> columns(const std::vector<Member>& all, const ast::nodes::Struct& node)
+        {
+            std::vector<Column> result;
+
+            for(std::size_t i = 0; i < all.size(); ++i)
+            {
+                if(all[i].Field)
+                {
+                    flatten(node, *all[i].Field, all[i].Name, i, 0, result);
+                }
+            }
+
+            return result;
+        }
+
+        // type of one entry of @column
+        std::string columnType(const Column& column)
+        {
+            const auto type = cppValueType(*column.Field);
+            return column.Field->isArray() ? "std::array<" + type + ", " + std::to_string(column.Field->arraySize()) + ">" : type;
+        }
+
+        std::string load(const Column& column, const std::string& at)
+        {
+            return "::swizzle::runtime::load<" + cppValueType(*column.Field) + ", " + cppByteOrder(*column.Owner, *column.Field) + ">(" + at + ")";
+        }
+
+        std::string loadRun(const Column& column, const std::string& at, const std::string& count, const std::string& out)
+        {
+            return "::swizzle::runtime::loadRun<" + cppValueType(*column.Field) + ", " + cppByteOrder(*column.Owner, *column.Field) + ">(" + at + ", " + count + ", " + out + ");\n";
+        }
+
+        // the value of the field @path names for message row_, read back from the
+        // columns: "out.header_count[row_]" or "out.hdr[row_].count"
+        std::string columnValue(const std::vector<Column>& all, const std::string& path)
+        {
+            for(auto end = path.size(); end != std::string::npos; end = (end ? path.rfind('.', end - 1) : std::string::npos))
+            {
+                auto name = path.substr(0, end);
+                std::replace(name.begin(), name.end(), '.', '_');
+
+                const auto column = std::find_if(all.begin(), all.end(), [&](const Column& c) { return c.Name == name; });
+                if(column != all.end())
+                {
+                    const auto rest = path.substr(std::min(end + 1, path.size()));
+                    return "out." + name + "[row_]" + (rest.empty() ? "" : "." + cppMemberPath(rest, ""));
+                }
+            }
+
+            return "out." + path + "[row_]";
+        }
+
+        std::string discriminator(const ast::nodes::Struct& node, const ast::nodes::VariableBlock& block, const std::vector<Column>& all)
+        {
+            const auto path = block.variableOnField().token().value();
+            const auto underlying = enumUnderlyingType(*resolveMember(node, path));
+            const auto value = columnValue(all, path.to_string());
+
+            return underlying.empty() ? value : "static_cast<" + underlying + ">(" + value + ")";
+        }
+
+        // a column read at @at, a constant offset into the message
+        void emitFixed(std::ostream& os, const Column& column, const std::string& at)
+        {
+            const auto target = "out." + column.Name + "[row_]";
+            const auto element = std::to_string(column.Field->layout().ElementSize);
+
+            switch(column.Type)
+            {
+                case Column::Kind::Scalar:
+                    os << "            " << target << " = " << load(column, at) << ";\n";
+                    break;
+
+                case Column::Kind::Array:
+                    if(scalarRun(*column.Field))
+                    {
+                        os << "            " << loadRun(column, at, std::to_string(column.Field->arraySize()), target + ".data()");
+                        break;
+                    }
+
+                    os << "            for(std::size_t j_ = 0; j_ < " << column.Field->arraySize() << "; ++j_)\n"
+                       << "                " << target << "[j_] = " << load(column, at + " + j_ * " + element) << ";\n";
+                    break;
+
+                default:
+                    if(column.Field->isArray())
+                    {
+                        os << "            for(std::size_t j_ = 0; j_ < " << column.Field->arraySize() << "; ++j_)\n"
+                           << "                decode(" << at << " + j_ * " << element << ", end_, " << target << "[j_]);\n";
+                    }
+                    else
+                    {
+                        os << "            decode(" << at << ", end_, " << target << ");\n";
+                    }
+                    break;
+            }
+        }
+
+        // decoded structs that may hold vectors put them in out.arena_
+        bool hasArena(const std::vector<Member>& all, const std::vector<Column>& fields)
+        {
+            const auto vectors = [](const ast::nodes::Struct* type) { return type && !type->layout().fixed(); };
+
+            for(const auto& column : fields)
+            {
+                if(vectors(structType(*column.Field)))
+                {
+                    return true;
+                }
+            }
+
+            for(const auto& member : all)
+            {
+                if(member.Block)
+                {
+                    for(const auto& c : cases(*member.Block))
+                    {
+                        if(vectors(c.Type))
+                        {
+                            return true;
+                        }
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        // a column of varying size at at_, moving at_ past it, @arena the
+        // decode()s' last argument, ", &out.arena_" or empty
+        void emitVariable(std::ostream& os, const Column& column, const std::vector<Column>& all, const std::string& arena)
+        {
+            const auto target = "out." + column.Name;
+
+            if(column.Type != Column::Kind::Vector)
+            {
+                if(column.Field->isArray())
+                {
+                    os << "            for(auto& element_ : " << target << "[row_])\n"
+                       << "                at_ = decode(at_, end_, element_" << arena << ");\n";
+                }
+                else
+                {
+                    os << "            at_ = decode(at_, end_, " << target << "[row_]" << arena << ");\n";
+                }
+
+                return;
+            }
+
+            os << "            {\n"
+               << "                const auto count_ = static_cast<std::size_t>(" << columnValue(all, column.Field->vectorSizeMember().token().to_string()) << ");\n"
+               << "                const auto first_ = " << target << ".size();\n"
+               << "                " << target << "_begin[row_] = first_;\n"
+               << "                " << target << ".resize(first_ + count_);\n";
+
+            if(structType(*column.Field))
+            {
+                os << "                for(std::size_t j_ = 0; j_ < count_; ++j_)\n"
+                   << "                    at_ = decode(at_, end_, " << target << "[first_ + j_]" << arena << ");\n";
+            }
+            else
+            {
+                os << "                " << loadRun(column, "at_", "count_", target + ".data() + first_")
+                   << "                at_ += count_ * " << column.Field->layout().ElementSize << ";\n";
+            }
+
+            os << "            }\n";
+        }
+
+        void emitBlock(std::ostream& os, const ast::nodes::Struct& node, const Member& member, const std::vector<Column>& all, const std::string& arena)
+        {
+            const auto dispatch = analyzeDispatch(node, *member.Block, member.Name);
+            const auto blockCases = cases(*member.Block);
+
+            os << "            " << dispatchSwitch(dispatch, discriminator(node, *member.Block, all)) << "\n"
+               << "            {\n";
+
+            for(std::size_t c = 0; c < blockCases.size(); ++c)
+            {
+                const auto target = "out." + caseMemberName(*blockCases[c].Type);
+
+                os << "            " << dispatchLabel(dispatch, c) << ":\n"
+                   << "                out." << member.Name << "_index[row_] = " << target << ".size();\n"
+                   << "                " << target << ".emplace_back();\n"
+                   << "                at_ = decode(at_, end_, " << target << ".back()" << arena << ");\n"
+                   << "                break;\n";
+            }
+
+            os << "            default:\n"
+               << "                break;\n"
+               << "            }\n";
+        }
+
+        // the part of a message the gathers don't cover, for message i_ at data_
+        std::string loopBody(const ast::nodes::Struct& node, const std::vector<Member>& all, const std::vector<Column>& fields)
+        {
+            std::ostringstream os;
+            const std::string arena = hasArena(all, fields) ? ", &out.arena_" : "";
+
+            std::size_t prefix = 0;
+            for(; (prefix < all.size()) && constantSize(all[prefix]); ++prefix)
+            {
+            }
+
+            for(const auto& column : fields)
+            {
+                if((column.Member < prefix) && (column.Type != Column::Kind::Scalar))
+                {
+                    emitFixed(os, column, "data_ + " + std::to_string(all[column.Member].Layout->Offset + column.Offset));
+                }
+            }
+
+            for(std::size_t i = prefix; i < all.size(); ++i)
+            {
+                const auto& member = all[i];
+
+                if(member.Block)
+                {
+                    emitBlock(os, node, member, fields, arena);
+                    continue;
+                }
+
+                for(const auto& column : fields)
+                {
+                    if(column.Member != i)
+                    {
+                        continue;
+                    }
+
+                    if(constantSize(member))
+                    {
+                        emitFixed(os, column, column.Offset ? "at_ + " + std::to_string(column.Offset) : "at_");
+                    }
+                    else
+                    {
+                        emitVariable(os, column, fields, arena);
+                    }
+                }
+
+                if(constantSize(member))
+                {
+                    os << "            at_ += " << member.Layout->MinSize << ";\n";
+                }
+            }
+
+            return os.str();
+        }
+
+        // one overload of decodeColumns(): @record addresses message i_ and @end its end,
+        // @validate moves valid_ past the block's valid messages, up to last_, and
+        // @kernel(@arguments, rows_, column) gathers a column of the block at begin_,
+        // "@offset" in @arguments standing for its offset
+        void emitDecodeColumns(std::ostream& os, const ast::nodes::Struct& node, const std::vector<Member>& all, const std::vector<Column>& fields,
+                               const std::string& parameters, const std::string& validate, const std::string& record, const std::string& end,
+                               const std::string& kernel, const std::string& arguments)
+        {
+            const auto name = cppShortName(node.name());
+
+            // indented for the loop over the block's messages
+            std::string body;
+            {
+                std::istringstream lines(loopBody(node, all, fields));
+                for(std::string line; std::getline(lines, line);)
+                {
+                    body += "    " + line + "\n";
+                }
+            }
+
+            // columns of one entry per message, sized for the whole batch up front
+            std::vector<std::string> presized;
+            for(const auto& column : fields)
+            {
+                presized.push_back(column.Name + (column.Type == Column::Kind::Vector ? "_begin" : ""));
+            }
+
+            std::set<std::string> caseColumns;
+            for(const auto& member : all)
+            {
+                if(member.Block)
+                {
+                    presized.push_back(member.Name + "_index");
+
+                    for(const auto& c : cases(*member.Block))
+                    {
+                        caseColumns.insert(caseMemberName(*c.Type));
+                    }
+                }
+            }
+
+            os << "    inline std::size_t decodeColumns(" << parameters << ", " << name << "Columns& out)\n"
+               << "    {\n"
+               << "        const auto base_ = out.count_;\n";
+
+            for(const auto& column : presized)
+            {
+                os << "        out." << column << ".resize(base_ + count);\n";
+            }
+
+            for(const auto& caseColumn : caseColumns)
+            {
+                os << "        out." << caseColumn << ".reserve(out." << caseColumn << ".size() + count);\n";
+            }
+
+            // validated a block at a time, while its bytes are in cache for the gathers
+            os << "\n"
+               << "        std::size_t valid_ = 0;\n"
+               << "        while(valid_ < count)\n"
+               << "        {\n"
+               << "            const auto begin_ = valid_;\n"
+               << "            const auto last_ = std::min(count, begin_ + ::swizzle::runtime::ColumnBlock);\n"
+               << validate
+               << "\n"
+               << "            const auto rows_ = valid_ - begin_;\n";
+
+            if(fields.empty() && body.empty())
+            {
+                os << "            static_cast<void>(rows_);\n";
+            }
+
+            for(const auto& column : fields)
+            {
+                const auto& member = all[column.Member];
+                if((column.Type == Column::Kind::Scalar) && constantSize(member) && member.Layout->FixedOffset)
+                {
+                    auto source = arguments;
+                    source.replace(source.find("@offset"), 7, std::to_string(member.Layout->Offset + column.Offset));
+
+                    os << "            ::swizzle::runtime::" << kernel << "<" << cppValueType(*column.Field) << ", " << cppByteOrder(*column.Owner, *column.Field) << ">("
+                       << source << ", rows_, out." << column.Name << ".data() + base_ + begin_);\n";
+                }
+            }
+
+            if(!body.empty())
+            {
+                os << "\n"
+                   << "            for(std::size_t i_ = begin_; i_ < valid_; ++i_)\n"
+                   << "            {\n"
+                   << "                const auto row_ = base_ + i_;\n"
+                   << "                const char* const data_ = " << record << ";\n";
+
+                if(body.find("end_") != std::string::npos)
+                {
+                    os << "                const char* const end_ = " << end << ";\n";
+                }
+
+                if(body.find("at_") != std::string::npos)
+                {
+                    os << "                const char* at_ = data_ + " << node.layout().FixedPrefix << ";\n";
+                }
+
+                os << "\n" << body
+                   << "            }\n";
+            }
+
+            os << "\n"
+               << "            if(valid_ != last_)\n"
+               << "            {\n"
+               << "                break;\n"
+               << "            }\n"
+               << "        }\n"
+               << "\n"
+               << "        out.count_ = base_ + valid_;\n";
+
+            for(const auto& column : presized)
+            {
+                os << "        out." << column << ".resize(out.count_);\n";
+            }
+
+            os << "\n"
+               << "        return valid_;\n"
+               << "    }\n\n";
+        }
+    }
+
+    bool hasColumns(const ast::nodes::Struct& node)
+    {
+        return hasAttribute(node, "@columns");
+    }
+
+    void emitColumns(std::ostream& os, const ast::nodes::Struct& node)
+    {
+        const auto name = cppShortName(node.name());
+        const auto all = members(node);
+        const auto fields = columns(all, node);
+        const auto arena = hasArena(all, fields);
+
+        os << "    // " << name << " decoded a column at a time by decodeColumns(), message i's fields at\n"
+           << "    // [i]. Vector elements go back to back, message i's from foo_begin[i] on, and\n"
+           << "    // variable_block cases into a column per case type, at variableBlock_index[i]\n"
+           << (arena ? "    // The vectors of structs decoded whole are in arena_, until clear()\n" : "")
+           << "    struct " << name << "Columns\n"
+           << "    {\n"
+           << "        std::size_t count_ = 0;\n";
+
+        for(const auto& column : fields)
+        {
+            os << "        std::vector<" << columnType(column) << "> " << column.Name << ";\n";
+
+            if(column.Type == Column::Kind::Vector)
+            {
+                os << "        std::vector<std::size_t> " << column.Name << "_begin;\n";
+            }
+        }
+
+        std::set<std::string> caseColumns;
+        for(const auto& member : all)
+        {
+            if(!member.Block)
+            {
+                continue;
+            }
+
+            for(const auto& c : cases(*member.Block))
+            {
+                if(caseColumns.insert(caseMemberName(*c.Type)).second)
+                {
+                    os << "        std::vector<" << cppQualifiedName(c.Type->name()) << "> " << caseMemberName(*c.Type) << ";\n";
+                }
+            }
+
+            os << "        std::vector<std::size_t> " << member.Name << "_index;\n";
+        }
+
+        if(arena)
+        {
+            os << "        ::swizzle::runtime::Arena arena_;\n";
+        }
+
+        os << "    };\n\n";
+
+        os << "    // empty every column of @out, keeping their memory for the next batch\n"
+           << "    inline void clear(" << name << "Columns& out)\n"
+           << "    {\n"
+           << "        out.count_ = 0;\n";
+
+        for(const auto& column : fields)
+        {
+            os << "        out." << column.Name << ".clear();\n";
+
+            if(column.Type == Column::Kind::Vector)
+            {
+                os << "        out." << column.Name << "_begin.clear();\n";
+            }
+        }
+
+        for(const auto& caseColumn : caseColumns)
+        {
+            os << "        out." << caseColumn << ".clear();\n";
+        }
+
+        for(const auto& member : all)
+        {
+            if(member.Block)
+            {
+                os << "        out." << member.Name << "_index.clear();\n";
+            }
+        }
+
+        os << (arena ? "        out.arena_.reset();\n" : "")
+           << "    }\n\n";
+
+        const auto view = name + "View";
+        const auto blocks = std::any_of(all.begin(), all.end(), [](const Member& m) { return m.Block != nullptr; });
+
+        os << "    // append the @count messages at @messages[i], @lengths[i] bytes each, to @out.\n"
+           << "    // @return the messages appended, up to the first that isn't valid\n";
+
+        emitDecodeColumns(os, node, all, fields,
+            "const char* const* messages, const std::size_t* lengths, const std::size_t count",
+            "            while((valid_ < last_) && " + view + "(messages[valid_], lengths[valid_]).isValid()) ++valid_;\n",
+            "messages[i_]", "data_ + lengths[i_]", "gatherIndirect", "messages + begin_, @offset");
+
+        if(!node.layout().fixed())
+        {
+            return;
+        }
+
+        os << "    // append the @count records of " << view << "::Size bytes packed at @data to @out\n"
+           << "    // @return the records appended, up to the first that isn't valid\n";
+
+        emitDecodeColumns(os, node, all, fields,
+            "const char* data, const std::size_t count",
+            blocks
+                ? "            while((valid_ < last_) && " + view + "(data + valid_ * " + view + "::Size, " + view + "::Size).isValid()) ++valid_;\n"
+                : "            valid_ = last_;\n",
+            "data + i_ * " + view + "::Size", "data_ + " + view + "::Size", "gatherStrided", "data + begin_ * " + view + "::Size + @offset, " + view + "::Size");
+    }
+}}}
@@ -0,0 +1,251 @@
+#include <swizzle/codegen/detail/EmitDecoder.hpp>
+
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/VariableBlock.hpp>
+#include <swizzle/codegen/detail/CppNames.hpp>
+#include <swizzle/codegen/detail/Dispatch.hpp>
+#include <swizzle/codegen/detail/Members.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    namespace {
+
+        std::string load(const ast::nodes::Struct& node, const ast::nodes::StructField& field, const std::string& at)
+        {
+            return "::swizzle::runtime::load<" + cppValueType(field) + ", " + cppByteOrder(node, field) + ">(" + at + ")";
+        }
+
+        std::string loadRun(const ast::nodes::Struct& node, const ast::nodes::StructField& field, const std::string& at, const std::string& count, const std::string& out)
+        {
+            return "::swizzle::runtime::loadRun<" + cppValueType(field) + ", " + cppByteOrder(node, field) + ">(" + at + ", " + count + ", " + out + ");\n";
+        }
+
+        // @member at data + @offset, the run it is in has been bounds checked
+        void emitFixed(std::ostream& os, const ast::nodes::Struct& node, const Member& member, const std::size_t offset)
+        {
+            const auto& field = *member.Field;
+            const auto at = "data + " + std::to_string(offset);
+
+            if(!field.isArray())
+            {
+                if(structType(field))
+                {
+                    os << "        decode(" << at << ", end, out." << member.Name << ");\n";
+                }
+                else
+                {
+                    os << "        out." << member.Name << " = " << load(node, field, at) << ";\n";
+                }
+
+                return;
+            }
+
+            if(scalarRun(field))
+            {
+                os << "        " << loadRun(node, field, at, std::to_string(field.arraySize()), "out." + member.Name + ".data()");
+                return;
+            }
+
+            const auto element = std::to_string(member.Layout->ElementSize);
+            os << "        for(std::size_t i = 0; i < " << field.arraySize() << "; ++i)\n";
+
+            if(structType(field))
+            {
+                os << "            decode(" << at << " + i * " << element << ", end, out." << member.Name << "[i]);\n";
+            }
+            else
+            {
+                os << "            out." << member.Name << "[i] = " << load(node, field, at + " + i * " + element) << ";\n";
+            }
+        }
+
+        void emitVector(std::ostream& os, const ast::nodes::Struct& node, const Member& member)
+        {
+            const auto& field = *member.Field;
+            const auto element = structType(field);
+
+            // checked before resizing, so a corrupt count can't allocate
+            const auto minElement = element ? element->layout().MinSize : member.Layout->ElementSize;
+
+            os << "        {\n"
+               << "            const auto count = static_cast<std::size_t>(out." << cppMemberPath(field.vectorSizeMember().token().value(), "") << ");\n";
+
+            if(minElement != 0)
+            {
+                os << "            if(static_cast<std::size_t>(end - data) / " << minElement << " < count) return nullptr;\n";
+            }
+
+            os << "            ::swizzle::runtime::resize(out." << member.Name << ", count, arena);\n";
+
+            if(element)
+            {
+                os << "            for(auto& element : out." << member.Name << ")\n"
+                   << "            {\n"
+                   << "                data = decode(data, end, element, arena);\n"
+                   << "                if(!data) return nullptr;\n"
+                   << "            }\n";
+            }
+            else
+            {
+                os << "            " << loadRun(node, field, "data", "count", "out." + member.Name + ".data()")
+                   << "            data += count * " << member.Layout->ElementSize << ";\n";
+            }
+
+            os << "        }\n";
+        }
+
+        // a struct, or array of structs, of varying size
+        void emitVariableStruct(std::ostream& os, const Member& member)
+        {
+            if(member.Field->isArray())
+            {
+                os << "        for(auto& element : out." << member.Name << ")\n"
+                   << "        {\n"
+                   << "            data = decode(data, end, element, arena);\n"
+                   << "            if(!data) return nullptr;\n"
+                   << "        }\n";
+            }
+            else
+            {
+                os << "        data = decode(data, end, out." << member.Name << ", arena);\n"
+                   << "        if(!data) return nullptr;\n";
+            }
+        }
+
+        void emitVariableBlock(std::ostream& os, const ast::nodes::Struct& node, const Member& member)
+        {
+            const auto path = member.Block->variableOnField().token().value();
+            const auto underlying = enumUnderlyingType(*resolveMember(node, path));
+
+            auto discriminator = "out." + cppMemberPath(path, "");
+            if(!underlying.empty())
+            {
+                discriminator = "static_cast<" + underlying + ">(" + discriminator + ")";
+            }
+
+            const auto dispatch = analyzeDispatch(node, *member.Block, member.Name);
+            const auto blockCases = cases(*member.Block);
+
+            os << "        " << dispatchSwitch(dispatch, discriminator) << "\n"
+               << "        {\n";
+
+            for(std::size_t c = 0; c < blockCases.size(); ++c)
+            {
+                const auto selected = caseMemberName(*blockCases[c].Type);
+
+                // the other cases holding vectors are emptied, their storage
+                // may be in an arena that has been reset since
+                std::vector<const ast::nodes::Struct*> stale;
+                for(const auto& other : blockCases)
+                {
+                    const bool holdsVectors = !other.Type->layout().fixed();
+                    if(holdsVectors && (other.Type != blockCases[c].Type) && (std::find(stale.begin(), stale.end(), other.Type) == stale.end()))
+                    {
+                        stale.push_back(other.Type);
+                    }
+                }
+
+                if(stale.empty())
+                {
+                    os << "            " << dispatchLabel(dispatch, c) << ": data = decode(data, end, out." << selected << ", arena); break;\n";
+                    continue;
+                }
+
+                os << "            " << dispatchLabel(dispatch, c) << ":\n";
+                for(const auto type : stale)
+                {
+                    os << "                out." << caseMemberName(*type) << " = " << cppQualifiedName(type->name()) << "();\n";
+                }
+
+                os << "                data = decode(data, end, out." << selected << ", arena);\n"
+                   << "                break;\n";
+            }
+
+            os << "            default: return nullptr;\n"
+               << "        }\n"
+               << "        if(!data) return nullptr;\n";
+        }
+    }
+
+    void emitDecoder(std::ostream& os, const ast::nodes::Struct& node)
+    {
+        const auto name = cppShortName(node.name());
+        const auto all = members(node);
+
+        const bool hasBlock = std::any_of(all.begin(), all.end(), [](const Member& m) { return m.Block != nullptr; });
+
+        os << "    // decode the " << name << " at @data into @out, its vectors into @arena if not null.\n"
+           << (hasBlock ? "    // The variable_block cases it does not select that hold vectors are emptied.\n" : "")
+           << "    // @return one past its end, nullptr if it runs past @end or selects an unknown\n"
+           << "    // variable_block case\n"
+           << "    inline const char* decode(const char* data, const char* end, " << name << "& out, ::swizzle::runtime::Arena* arena)\n"
+           << "    {\n";
+
+        if(all.empty())
+        {
+            os << "        static_cast<void>(end);\n";
+        }
+
+        // only members of varying size can hold vectors
+        if(std::all_of(all.begin(), all.end(), constantSize))
+        {
+            os << "        static_cast<void>(arena);\n";
+        }
+
+        for(std::size_t i = 0; i < all.size();)
+        {
+            // fixed size fields are decoded in runs with a single bounds check
+            if(constantSize(all[i]))
+            {
+                std::size_t size = 0;
+                std::vector<const Member*> run;
+
+                for(; (i < all.size()) && constantSize(all[i]); ++i)
+                {
+                    run.push_back(&all[i]);
+                    size += all[i].Layout->MinSize;
+                }
+
+                os << "        if(end - data < " << size << ") return nullptr;\n";
+
+                std::size_t offset = 0;
+                for(const auto member : run)
+                {
+                    emitFixed(os, node, *member, offset);
+                    offset += member->Layout->MinSize;
+                }
+
+                os << "        data += " << size << ";\n";
+                continue;
+            }
+
+            const auto& member = all[i++];
+
+            if(member.Block)
+            {
+                emitVariableBlock(os, node, member);
+            }
+            else if(member.Field->isVector())
+            {
+                emitVector(os, node, member);
+            }
+            else
+            {
+                emitVariableStruct(os, member);
+            }
+        }
+
+        os << "        return data;\n"
+           << "    }\n\n"
+           << "    inline const char* decode(const char* data, const char* end, " << name << "& out)\n"
+           << "    {\n"
+           << "        return decode(data, end, out, nullptr);\n"
+           << "    }\n\n";
+    }
+}}}
@@ -0,0 +1,416 @@
+#include <swizzle/codegen/detail/EmitEncoder.hpp>
+
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/VariableBlock.hpp>
+#include <swizzle/codegen/detail/CppNames.hpp>
+#include <swizzle/codegen/detail/Dispatch.hpp>
+#include <swizzle/codegen/detail/Members.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    namespace {
+
+        // a vector's size member inside a nested struct ("header.count"),
+        // patched once the vector's size is known
+        struct NestedSize
+        {
+            std::size_t Offset = 0;                             // from the start of the message
+            const ast::nodes::Struct* Owner = nullptr;
+            const ast::nodes::StructField* Field = nullptr;
+        };
+
+        // false when a struct on @path has no constant offset, the size
+        // member is then written as the value holds it
+        bool nestedSize(const ast::nodes::Struct& node, const boost::string_view& path, NestedSize& result)
+        {
+            const ast::nodes::Struct* current = &node;
+            result.Offset = 0;
+
+            std::size_t begin = 0;
+            while(current)
+            {
+                const auto end = std::min(path.find('.', begin), path.size());
+                const auto field = resolveMember(*current, path.substr(begin, end - begin));
+
+                if(!field || !field->layout().FixedOffset)
+                {
+                    return false;
+                }
+
+                result.Offset += field->layout().Offset;
+
+                if(end == path.size())
+                {
+                    result.Owner = current;
+                    result.Field = field;
+                    return true;
+                }
+
+                current = structType(*field);
+                begin = end + 1;
+            }
+
+            return false;
+        }
+
+        std::string store(const ast::nodes::Struct& node, const ast::nodes::StructField& field, const std::string& at, const std::string& value)
+        {
+            return "::swizzle::runtime::store<" + cppValueType(field) + ", " + cppByteOrder(node, field) + ">(" + at + ", " + value + ");\n";
+        }
+
+        std::string storeRun(const ast::nodes::Struct& node, const ast::nodes::StructField& field, const std::string& at, const std::string& values, const std::string& count)
+        {
+            return "::swizzle::runtime::storeRun<" + cppValueType(field) + ", " + cppByteOrder(node, field) + ">(" + at + ", " + values + ", " + count + ");\n";
+        }
+
+        // a struct whose encode() can fail, it holds vectors or variable blocks
+        bool mayFail(const ast::nodes::Struct* type)
+        {
+            return type && !type->layout().fixed();
+        }
+
+        bool singleByte(const Member& member)
+        {
+            return !structType(*member.Field) && (member.Layout->ElementSize == 1);
+        }
+
+        std::string discriminator(const ast::nodes::Struct& node, const ast::nodes::VariableBlock& block)
+        {
+            const auto path = block.variableOnField().token().value();
+            const auto underlying = enumUnderlyingType(*resolveMember(node, path));
+            const auto value = "value." + cppMemberPath(path, "");
+
+            return underlying.empty() ? value : "static_cast<" + underlying + ">(" + value + ")";
+        }
+
+        // vectors sized by each top level field, the first one wins when several share it
+        std::map<std::string, std::string> sizedVectors(const std::vector<Member>& all)
+        {
+            std::map<std::string, std::string> result;
+
+            for(const auto& member : all)
+            {
+                if(member.Field && member.Field->isVector())
+                {
+                    const auto path = member.Field->vectorSizeMember().token().value();
+                    if(path.find('.') == boost::string_view::npos)
+                    {
+                        result.emplace(cppIdentifier(path), member.Name);
+                    }
+                }
+            }
+
+            return result;
+        }
+
+        // @member at out + @offset, the run it is in is stored with no pointer updates
+        void emitFixed(std::ostream& os, const ast::nodes::Struct& node, const Member& member, const std::size_t offset, const std::map<std::string, std::string>& vectors)
+        {
+            const auto& field = *member.Field;
+            const auto at = "out + " + std::to_string(offset);
+
+            if(!field.isArray())
+            {
+                const auto vector = vectors.find(member.Name);
+
+                if(structType(field))
+                {
+                    os << "        encode(value." << member.Name << ", " << at << ");\n";
+                }
+                else if(vector != vectors.end())
+                {
+                    os << "        " << store(node, field, at, "static_cast<" + cppValueType(field) + ">(value." + vector->second + ".size())");
+                }
+                else
+                {
+                    os << "        " << store(node, field, at, "value." + member.Name);
+                }
+
+                return;
+            }
+
+            if(singleByte(member))
+            {
+                os << "        std::memcpy(" << at << ", value." << member.Name << ".data(), " << field.arraySize() << ");\n";
+                return;
+            }
+
+            if(scalarRun(field))
+            {
+                os << "        " << storeRun(node, field, at, "value." + member.Name + ".data()", std::to_string(field.arraySize()));
+                return;
+            }
+
+            const auto element = std::to_string(member.Layout->ElementSize);
+            os << "        for(std::size_t i = 0; i < " << field.arraySize() << "; ++i)\n";
+
+            if(structType(field))
+            {
+                os << "            encode(value." << member.Name << "[i], " << at << " + i * " << element << ");\n";
+            }
+            else
+            {
+                os << "            " << store(node, field, at + " + i * " + element, "value." + member.Name + "[i]");
+            }
+        }
+
+        void emitVector(std::ostream& os, const ast::nodes::Struct& node, const Member& member)
+        {
+            const auto& field = *member.Field;
+            const auto element = structType(field);
+            const auto path = field.vectorSizeMember().token().value();
+
+            NestedSize nested;
+            if((path.find('.') != boost::string_view::npos) && nestedSize(node, path, nested))
+            {
+                os << "        " << store(*nested.Owner, *nested.Field, "start + " + std::to_string(nested.Offset),
+                    "static_cast<" + cppValueType(*nested.Field) + ">(value." + member.Name + ".size())");
+            }
+
+            if(mayFail(element))
+            {
+                os << "        for(const auto& element : value." << member.Name << ")\n"
+                   << "        {\n"
+                   << "            out = encode(element, out);\n"
+                   << "            if(!out) return nullptr;\n"
+                   << "        }\n";
+            }
+            else if(element)
+            {
+                os << "        for(const auto& element : value." << member.Name << ")\n"
+                   << "            out = encode(element, out);\n";
+            }
+            else if(singleByte(member))
+            {
+                os << "        if(!value." << member.Name << ".empty()) std::memcpy(out, value." << member.Name << ".data(), value." << member.Name << ".size());\n"
+                   << "        out += value." << member.Name << ".size();\n";
+            }
+            else
+            {
+                os << "        " << storeRun(node, field, "out", "value." + member.Name + ".data()", "value." + member.Name + ".size()")
+                   << "        out += value." << member.Name << ".size() * " << member.Layout->ElementSize << ";\n";
+            }
+        }
+
+        void emitSize(std::ostream& os, const ast::nodes::Struct& node, const std::vector<Member>& all)
+        {
+            const auto name = cppShortName(node.name());
+
+            os << "    // bytes encode() writes for @value\n";
+
+            if(node.layout().fixed())
+            {
+                os << "    inline std::size_t size(const " << name << "&)\n"
+                   << "    {\n"
+                   << "        return " << node.layout().MinSize << ";\n"
+                   << "    }\n\n";
+                return;
+            }
+
+            std::size_t constant = 0;
+            for(const auto& member : all)
+            {
+                constant += constantSize(member) ? member.Layout->MinSize : 0;
+            }
+
+            os << "    inline std::size_t size(const " << name << "& value)\n"
+               << "    {\n"
+               << "        std::size_t size_ = " << constant << ";\n";
+
+            for(const auto& member : all)
+            {
+                if(constantSize(member))
+                {
+                    continue;
+                }
+
+                if(member.Block)
+                {
+                    const auto dispatch = analyzeDispatch(node, *member.Block, member.Name);
+                    const auto blockCases = cases(*member.Block);
+
+                    os << "        " << dispatchSwitch(dispatch, discriminator(node, *member.Block)) << "\n"
+                       << "        {\n";
+
+                    for(std::size_t c = 0; c < blockCases.size(); ++c)
+                    {
+                        os << "            " << dispatchLabel(dispatch, c) << ": size_ += size(value." << caseMemberName(*blockCases[c].Type) << "); break;\n";
+                    }
+
+                    os << "            default: break;\n"
+                       << "        }\n";
+                }
+                else if(member.Field->isVector() && (!structType(*member.Field) || structType(*member.Field)->layout().fixed()))
+                {
+                    os << "        size_ += value." << member.Name << ".size() * " << member.Layout->ElementSize << ";\n";
+                }
+                else if(member.Field->isVector() || member.Field->isArray())
+                {
+                    os << "        for(const auto& element : value." << member.Name << ")\n"
+                       << "            size_ += size(element);\n";
+                }
+                else
+                {
+                    os << "        size_ += size(value." << member.Name << ");\n";
+                }
+            }
+
+            os << "        return size_;\n"
+               << "    }\n\n";
+        }
+
+        // encode() fails when a vector is too long for its size member, or
+        // differs in size from an earlier vector sharing it. A nested size
+        // member written as the value holds it must match the vector
+        void emitSizeChecks(std::ostream& os, const ast::nodes::Struct& node, const std::vector<Member>& all)
+        {
+            std::map<std::string, std::string> first;
+
+            for(const auto& member : all)
+            {
+                if(!member.Field || !member.Field->isVector())
+                {
+                    continue;
+                }
+
+                const auto path = member.Field->vectorSizeMember().token().value();
+                const auto size = "value." + member.Name + ".size()";
+                const auto shared = first.find(path.to_string());
+
+                if(shared != first.end())
+                {
+                    os << "        if(" << size << " != value." << shared->second << ".size()) return nullptr;\n";
+                    continue;
+                }
+
+                first.emplace(path.to_string(), member.Name);
+
+                NestedSize nested;
+                if((path.find('.') == boost::string_view::npos) || nestedSize(node, path, nested))
+                {
+                    os << "        if(!::swizzle::runtime::fits<" << cppValueType(*resolveMember(node, path)) << ">(" << size << ")) return nullptr;\n";
+                }
+                else
+                {
+                    os << "        if(" << size << " != static_cast<std::size_t>(value." << cppMemberPath(path, "") << ")) return nullptr;\n";
+                }
+            }
+        }
+
+        bool patchesNestedSizes(const ast::nodes::Struct& node, const std::vector<Member>& all)
+        {
+            for(const auto& member : all)
+            {
+                NestedSize nested;
+                if(member.Field && member.Field->isVector() && (member.Field->vectorSizeMember().token().value().find('.') != boost::string_view::npos)
+                    && nestedSize(node, member.Field->vectorSizeMember().token().value(), nested))
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    }
+
+    void emitEncoder(std::ostream& os, const ast::nodes::Struct& node)
+    {
+        const auto name = cppShortName(node.name());
+        const auto all = members(node);
+        const auto vectors = sizedVectors(all);
+
+        emitSize(os, node, all);
+
+        const bool hasBlock = std::any_of(all.begin(), all.end(), [](const Member& m) { return m.Block != nullptr; });
+
+        os << "    // write @value to @out, which holds at least size(value) bytes. Vector\n"
+           << "    // sizes are taken from the vectors. @return one past the last byte written,\n"
+           << "    // nullptr for a vector too long for its size member, or vectors sharing\n"
+           << (hasBlock
+               ? "    // one that differ in size, or a discriminator that selects no case, out\n"
+                 "    // may then hold a partly written message\n"
+               : "    // one that differ in size\n")
+           << "    inline char* encode(const " << name << "& value, char* out)\n"
+           << "    {\n";
+
+        emitSizeChecks(os, node, all);
+
+        if(all.empty())
+        {
+            os << "        static_cast<void>(value);\n";
+        }
+
+        if(patchesNestedSizes(node, all))
+        {
+            os << "        char* const start = out;\n";
+        }
+
+        for(std::size_t i = 0; i < all.size();)
+        {
+            // fixed size fields are stored in runs at constant offsets
+            if(constantSize(all[i]))
+            {
+                std::size_t offset = 0;
+                for(; (i < all.size()) && constantSize(all[i]); ++i)
+                {
+                    emitFixed(os, node, all[i], offset, vectors);
+                    offset += all[i].Layout->MinSize;
+                }
+
+                os << "        out += " << offset << ";\n";
+                continue;
+            }
+
+            const auto& member = all[i++];
+
+            if(member.Block)
+            {
+                const auto dispatch = analyzeDispatch(node, *member.Block, member.Name);
+                const auto blockCases = cases(*member.Block);
+
+                os << "        " << dispatchSwitch(dispatch, discriminator(node, *member.Block)) << "\n"
+                   << "        {\n";
+
+                for(std::size_t c = 0; c < blockCases.size(); ++c)
+                {
+                    os << "            " << dispatchLabel(dispatch, c) << ": out = encode(value." << caseMemberName(*blockCases[c].Type) << ", out); break;\n";
+                }
+
+                os << "            default: return nullptr;\n"
+                   << "        }\n";
+
+                if(std::any_of(blockCases.begin(), blockCases.end(), [](const Case& c) { return mayFail(c.Type); }))
+                {
+                    os << "        if(!out) return nullptr;\n";
+                }
+            }
+            else if(member.Field->isVector())
+            {
+                emitVector(os, node, member);
+            }
+            else if(member.Field->isArray())
+            {
+                os << "        for(const auto& element : value." << member.Name << ")\n"
+                   << "        {\n"
+                   << "            out = encode(element, out);\n"
+                   << "            if(!out) return nullptr;\n"
+                   << "        }\n";
+            }
+            else
+            {
+                os << "        out = encode(value." << member.Name << ", out);\n"
+                   << "        if(!out) return nullptr;\n";
+            }
+        }
+
+        os << "        return out;\n"
+           << "    }\n\n";
+    }
+}}}
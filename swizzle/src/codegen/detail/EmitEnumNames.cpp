@@ -0,0 +1,267 @@
+#include <swizzle/codegen/detail/EmitEnumNames.hpp>
+
+#include <swizzle/ast/nodes/Enum.hpp>
+#include <swizzle/ast/nodes/EnumField.hpp>
+#include <swizzle/codegen/detail/CppNames.hpp>
+#include <swizzle/codegen/detail/Dispatch.hpp>
+#include <swizzle/runtime/Reflection.hpp>
+#include <swizzle/types/SizeOf.hpp>
+
+#include <boost/variant/apply_visitor.hpp>
+#include <boost/variant/static_visitor.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    namespace {
+
+        // to_string() indexes an array while at least half of it is names, and it stays small
+        constexpr std::uint64_t MaxTableSize = 4096;
+
+        // the value's bits as an unsigned integer of the underlying type's width
+        struct AsUnsigned : boost::static_visitor<std::uint64_t>
+        {
+            template<class T>
+            std::uint64_t operator()(const T value) const
+            {
+                return static_cast<typename std::make_unsigned<T>::type>(value);
+            }
+        };
+
+        struct Enumerator
+        {
+            std::string Name;
+            std::string Value;                  // "Side::buy"
+            std::uint64_t Key = 0;
+        };
+
+        std::string literal(const std::uint64_t value, const std::string& type)
+        {
+            return std::to_string(value) + (type == "std::uint64_t" ? "ULL" : "U");
+        }
+
+        std::string runtime(const std::string& name)
+        {
+            return "::swizzle::runtime::" + name;
+        }
+
+        void emitTable(std::ostream& os, const std::string& type, const std::string& name, const std::vector<std::string>& values, const std::size_t perLine)
+        {
+            os << "        static constexpr " << type << " " << name << "[" << values.size() << "] = {";
+
+            for(std::size_t i = 0; i < values.size(); ++i)
+            {
+                os << ((i % perLine) ? " " : "\n            ") << values[i] << ",";
+            }
+
+            os << "\n        };\n";
+        }
+
+        void emitToString(std::ostream& os, const std::string& name, const std::string& key, const std::vector<Enumerator>& enumerators)
+        {
+            // an aliased value is named by its first enumerator
+            std::vector<std::pair<std::uint64_t, std::string>> entries;
+            std::set<std::uint64_t> seen;
+
+            for(const auto& enumerator : enumerators)
+            {
+                if(seen.insert(enumerator.Key).second)
+                {
+                    entries.emplace_back(enumerator.Key, cppStringLiteral(enumerator.Name));
+                }
+            }
+
+            std::sort(entries.begin(), entries.end());
+
+            const auto min = entries.front().first;
+            const auto range = entries.back().first - min;
+
+            os << "    // the name of @value, empty for a value no enumerator has\n"
+               << "    inline " << runtime("Name") << " to_string(const " << name << " value)\n"
+               << "    {\n";
+
+            if((range < MaxTableSize) && (range < 2 * entries.size()))
+            {
+                std::vector<std::string> names(range + 1, "\"\"");
+                for(const auto& entry : entries)
+                {
+                    names[entry.first - min] = entry.second;
+                }
+
+                emitTable(os, runtime("Name"), "Names", names, 8);
+                os << "\n"
+                   << "        const auto slot = static_cast<std::uint64_t>(static_cast<" << key << ">(value)) - " << min << "ULL;\n"
+                   << "        return (slot < " << names.size() << ") ? Names[slot] : " << runtime("Name()") << ";\n"
+                   << "    }\n\n";
+
+                return;
+            }
+
+            std::vector<std::uint64_t> keys;
+            for(const auto& entry : entries)
+            {
+                keys.push_back(entry.first);
+            }
+
+            std::uint64_t multiplier = 0;
+            unsigned shift = 0;
+
+            if(findPerfectHash(keys, multiplier, shift))
+            {
+                const auto slots = std::size_t(1) << (64 - shift);
+
+                std::vector<std::string> slotKeys(slots, literal(0, key));
+                std::vector<std::string> names(slots, "\"\"");
+
+                for(const auto& entry : entries)
+                {
+                    const auto slot = (entry.first * multiplier) >> shift;
+                    slotKeys[slot] = literal(entry.first, key);
+                    names[slot] = entry.second;
+                }
+
+                emitTable(os, key, "Keys", slotKeys, 8);
+                emitTable(os, runtime("Name"), "Names", names, 8);
+                os << "\n"
+                   << "        const auto key = static_cast<" << key << ">(value);\n"
+                   << "        const auto slot = (static_cast<std::uint64_t>(key) * " << multiplier << "ULL) >> " << shift << ";\n"
+                   << "        return (Keys[slot] == key) ? Names[slot] : " << runtime("Name()") << ";\n"
+                   << "    }\n\n";
+
+                return;
+            }
+
+            std::vector<std::string> sortedKeys;
+            std::vector<std::string> names;
+
+            for(const auto& entry : entries)
+            {
+                sortedKeys.push_back(literal(entry.first, key));
+                names.push_back(entry.second);
+            }
+
+            const auto size = std::to_string(entries.size());
+
+            emitTable(os, key, "Keys", sortedKeys, 8);
+            emitTable(os, runtime("Name"), "Names", names, 8);
+            os << "\n"
+               << "        const auto found = std::lower_bound(Keys, Keys + " << size << ", static_cast<" << key << ">(value));\n"
+               << "        return ((found != Keys + " << size << ") && (*found == static_cast<" << key << ">(value))) ? Names[found - Keys] : " << runtime("Name()") << ";\n"
+               << "    }\n\n";
+        }
+
+        void emitFromString(std::ostream& os, const std::string& name, std::vector<Enumerator> enumerators)
+        {
+            std::sort(enumerators.begin(), enumerators.end(), [](const Enumerator& lhs, const Enumerator& rhs) { return lhs.Name < rhs.Name; });
+
+            os << "    // the enumerator named by the @size characters at @name, false for none\n"
+               << "    inline bool from_string(const char* name, const std::size_t size, " << name << "& out)\n"
+               << "    {\n";
+
+            std::vector<std::uint64_t> hashes;
+            for(const auto& enumerator : enumerators)
+            {
+                hashes.push_back(swizzle::runtime::hashName(enumerator.Name.data(), enumerator.Name.size()));
+            }
+
+            std::uint64_t multiplier = 0;
+            unsigned shift = 0;
+
+            // distinct names whose hashes collide are searched for instead
+            if((std::set<std::uint64_t>(hashes.begin(), hashes.end()).size() == hashes.size()) && findPerfectHash(hashes, multiplier, shift))
+            {
+                const auto slots = std::size_t(1) << (64 - shift);
+
+                std::vector<std::string> names(slots, "\"\"");
+                std::vector<std::string> values(slots, name + "()");
+
+                for(std::size_t i = 0; i < enumerators.size(); ++i)
+                {
+                    const auto slot = (hashes[i] * multiplier) >> shift;
+                    names[slot] = cppStringLiteral(enumerators[i].Name);
+                    values[slot] = enumerators[i].Value;
+                }
+
+                emitTable(os, runtime("Name"), "Names", names, 8);
+                emitTable(os, name, "Values", values, 4);
+                os << "\n"
+                   << "        const auto slot = (" << runtime("hashName") << "(name, size) * " << multiplier << "ULL) >> " << shift << ";\n"
+                   << "        if((size == 0) || (Names[slot].size() != size) || (std::memcmp(Names[slot].data(), name, size) != 0))\n"
+                   << "        {\n"
+                   << "            return false;\n"
+                   << "        }\n\n"
+                   << "        out = Values[slot];\n"
+                   << "        return true;\n"
+                   << "    }\n\n";
+
+                return;
+            }
+
+            std::vector<std::string> names;
+            std::vector<std::string> values;
+
+            for(const auto& enumerator : enumerators)
+            {
+                names.push_back(cppStringLiteral(enumerator.Name));
+                values.push_back(enumerator.Value);
+            }
+
+            const auto size = std::to_string(enumerators.size());
+
+            emitTable(os, runtime("Name"), "Names", names, 8);
+            emitTable(os, name, "Values", values, 4);
+            os << "\n"
+               << "        const " << runtime("Name") << " key(name, size);\n"
+               << "        const auto found = std::lower_bound(Names, Names + " << size << ", key);\n"
+               << "        if((found == Names + " << size << ") || (*found != key))\n"
+               << "        {\n"
+               << "            return false;\n"
+               << "        }\n\n"
+               << "        out = Values[found - Names];\n"
+               << "        return true;\n"
+               << "    }\n\n";
+        }
+    }
+
+    void emitEnumNames(std::ostream& os, const ast::nodes::Enum& node)
+    {
+        const auto name = cppShortName(node.name());
+        const auto key = "std::uint" + std::to_string(types::SizeOf(node.underlying().token().value()) * 8) + "_t";
+
+        std::vector<Enumerator> enumerators;
+        for(const auto& child : node.children())
+        {
+            if(child->kind() == ast::NodeKind::EnumField)
+            {
+                const auto& field = static_cast<const ast::nodes::EnumField&>(*child);
+
+                Enumerator enumerator;
+                enumerator.Name = field.name().token().to_string();
+                enumerator.Value = name + "::" + cppIdentifier(field.name().token().value());
+                enumerator.Key = boost::apply_visitor(AsUnsigned(), field.value());
+
+                enumerators.push_back(enumerator);
+            }
+        }
+
+        if(enumerators.empty())
+        {
+            return;
+        }
+
+        emitToString(os, name, key, enumerators);
+        emitFromString(os, name, enumerators);
+
+        os << "    inline bool from_string(const std::string& name, " << name << "& out)\n"
+           << "    {\n"
+           << "        return from_string(name.data(), name.size(), out);\n"
+           << "    }\n\n";
+    }
+}}}
@@ -0,0 +1,301 @@
+#include <swizzle/codegen/detail/EmitMetadata.hpp>
+
+#include <swizzle/ast/nodes/Attribute.hpp>
+#include <swizzle/ast/nodes/AttributeBlock.hpp>
+#include <swizzle/ast/nodes/Bitfield.hpp>
+#include <swizzle/ast/nodes/BitfieldField.hpp>
+#include <swizzle/ast/nodes/Enum.hpp>
+#include <swizzle/ast/nodes/EnumField.hpp>
+#include <swizzle/ast/nodes/FieldLabel.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/VariableBlock.hpp>
+#include <swizzle/codegen/detail/CppNames.hpp>
+#include <swizzle/codegen/detail/Members.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    namespace {
+
+        std::string runtime(const std::string& name)
+        {
+            return "::swizzle::runtime::" + name;
+        }
+
+        std::string boolean(const bool value)
+        {
+            return value ? "true" : "false";
+        }
+
+        std::string size(const std::size_t value)
+        {
+            return value == ast::SizeRange::Unbounded ? runtime("Unbounded") : std::to_string(value);
+        }
+
+        // "{ \"@doc\", \"block\" }" per attribute of @node
+        std::vector<std::string> attributes(const ast::Node& node)
+        {
+            std::vector<std::string> result;
+
+            for(const auto& child : node.children())
+            {
+                if(child->kind() != ast::NodeKind::Attribute)
+                {
+                    continue;
+                }
+
+                const auto& attribute = static_cast<const ast::nodes::Attribute&>(*child);
+
+                std::string block;
+                for(const auto& grandchild : attribute.children())
+                {
+                    if(grandchild->kind() == ast::NodeKind::AttributeBlock)
+                    {
+                        block = static_cast<const ast::nodes::AttributeBlock&>(*grandchild).info().token().to_string();
+                    }
+                }
+
+                result.push_back("{ " + cppStringLiteral(attribute.info().token().value()) + ", " + cppStringLiteral(block) + " }");
+            }
+
+            return result;
+        }
+
+        // "static constexpr Type function(i)" returning the @i th of @entries
+        void emitTable(std::ostream& os, const std::string& type, const std::string& function, const std::vector<std::string>& entries)
+        {
+            if(entries.empty())
+            {
+                os << "\n        static constexpr " << type << " " << function << "(const std::size_t) { return {}; }\n";
+                return;
+            }
+
+            os << "\n        static constexpr " << type << " " << function << "(const std::size_t i)\n"
+               << "        {\n"
+               << "            const " << type << " table[] = {\n";
+
+            for(const auto& entry : entries)
+            {
+                os << "                " << entry << ",\n";
+            }
+
+            os << "            };\n\n"
+               << "            return table[i];\n"
+               << "        }\n";
+        }
+
+        void emitBegin(std::ostream& os, const boost::string_view& name)
+        {
+            const auto shortName = cppShortName(name);
+
+            os << "    // compile time description of " << shortName << ", swizzle::runtime::Metadata<" << shortName << ">\n"
+               << "    struct " << shortName << "Metadata\n"
+               << "    {\n"
+               << "        using Type = " << shortName << ";\n\n"
+               << "        static constexpr " << runtime("Name") << " name() { return " << cppStringLiteral(name) << "; }\n\n";
+        }
+
+        void emitEnd(std::ostream& os, const boost::string_view& name)
+        {
+            const auto shortName = cppShortName(name);
+
+            os << "    };\n\n"
+               << "    " << shortName << "Metadata metadata(const " << shortName << "&);\n\n";
+        }
+
+        std::string typeName(const ast::nodes::StructField& field)
+        {
+            const auto declaration = field.typeDeclaration();
+            if(!declaration)
+            {
+                return field.type().to_string();
+            }
+
+            switch(declaration->kind())
+            {
+                case ast::NodeKind::Enum: return static_cast<const ast::nodes::Enum&>(*declaration).name().to_string();
+                case ast::NodeKind::Bitfield: return static_cast<const ast::nodes::Bitfield&>(*declaration).name().to_string();
+                default: return static_cast<const ast::nodes::Struct&>(*declaration).name().to_string();
+            }
+        }
+
+        std::string typeKind(const ast::nodes::StructField& field)
+        {
+            const auto declaration = field.typeDeclaration();
+            if(!declaration)
+            {
+                return runtime("TypeKind::Builtin");
+            }
+
+            switch(declaration->kind())
+            {
+                case ast::NodeKind::Enum: return runtime("TypeKind::Enum");
+                case ast::NodeKind::Bitfield: return runtime("TypeKind::Bitfield");
+                default: return runtime("TypeKind::Struct");
+            }
+        }
+
+        // "true, 12ULL" for a field labelled "12:", "false, 0"
+        std::string label(const ast::nodes::StructField& field)
+        {
+            for(const auto& child : field.children())
+            {
+                if(child->kind() == ast::NodeKind::FieldLabel)
+                {
+                    return "true, " + static_cast<const ast::nodes::FieldLabel&>(*child).info().token().to_string() + "ULL";
+                }
+            }
+
+            return "false, 0";
+        }
+    }
+
+    void emitMetadata(std::ostream& os, const ast::nodes::Enum& node)
+    {
+        const auto name = cppQualifiedName(node.name());
+
+        std::vector<std::string> values;
+        for(const auto& child : node.children())
+        {
+            if(child->kind() == ast::NodeKind::EnumField)
+            {
+                const auto& field = static_cast<const ast::nodes::EnumField&>(*child);
+                values.push_back("{ " + cppStringLiteral(field.name().token().value()) + ", " + name + "::" + cppIdentifier(field.name().token().value()) + " }");
+            }
+        }
+
+        const auto attributeTable = attributes(node);
+
+        emitBegin(os, node.name());
+        os << "        using Underlying = " << cppBuiltinType(node.underlying().token().value()) << ";\n\n"
+           << "        static constexpr std::size_t ValueCount = " << values.size() << ";\n"
+           << "        static constexpr std::size_t AttributeCount = " << attributeTable.size() << ";\n";
+
+        emitTable(os, runtime("EnumeratorInfo<" + name + ">"), "value", values);
+        emitTable(os, runtime("AttributeInfo"), "attribute", attributeTable);
+        emitEnd(os, node.name());
+    }
+
+    void emitMetadata(std::ostream& os, const ast::nodes::Bitfield& node)
+    {
+        std::vector<std::string> fields;
+        for(const auto& child : node.children())
+        {
+            if(child->kind() != ast::NodeKind::BitfieldField)
+            {
+                continue;
+            }
+
+            const auto& field = static_cast<const ast::nodes::BitfieldField&>(*child);
+            const auto width = field.endBit() - field.beginBit() + 1;
+            const auto mask = ((width >= 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << width) - 1)) << field.beginBit();
+
+            std::ostringstream entry;
+            entry << "{ " << cppStringLiteral(field.name().token().value()) << ", " << field.beginBit() << ", " << field.endBit() << ", 0x" << std::hex << mask << "ULL }";
+            fields.push_back(entry.str());
+        }
+
+        const auto attributeTable = attributes(node);
+
+        emitBegin(os, node.name());
+        os << "        using Underlying = " << cppBuiltinType(node.underlying().token().value()) << ";\n\n"
+           << "        static constexpr std::size_t FieldCount = " << fields.size() << ";\n"
+           << "        static constexpr std::size_t AttributeCount = " << attributeTable.size() << ";\n";
+
+        emitTable(os, runtime("BitfieldFieldInfo"), "field", fields);
+        emitTable(os, runtime("AttributeInfo"), "attribute", attributeTable);
+        emitEnd(os, node.name());
+    }
+
+    void emitMetadata(std::ostream& os, const ast::nodes::Struct& node)
+    {
+        const auto& layout = node.layout();
+        const auto all = members(node);
+
+        // the struct's attributes, then each field's
+        auto attributeTable = attributes(node);
+        const auto ownAttributes = attributeTable.size();
+
+        std::vector<std::string> fieldNames;
+        for(const auto& member : all)
+        {
+            if(member.Field)
+            {
+                fieldNames.push_back(member.Field->name().token().to_string());
+            }
+        }
+
+        std::vector<std::string> fields;
+        std::vector<std::string> blocks;
+        std::vector<std::string> blockCases;
+        std::string pointers;
+
+        for(const auto& member : all)
+        {
+            if(member.Block)
+            {
+                const auto blockCaseList = cases(*member.Block);
+
+                blocks.push_back("{ " + cppStringLiteral(member.Block->variableOnField().token().value()) + ", " + std::to_string(fields.size()) + ", "
+                    + std::to_string(blockCases.size()) + ", " + std::to_string(blockCaseList.size()) + " }");
+
+                for(const auto& c : blockCaseList)
+                {
+                    blockCases.push_back("{ " + cppStringLiteral(c.Value) + ", " + cppStringLiteral(c.Type->name()) + " }");
+                }
+
+                continue;
+            }
+
+            const auto& field = *member.Field;
+            const auto& fieldLayout = field.layout();
+            const auto fieldAttributes = attributes(field);
+
+            std::string sizeField = runtime("NoField");
+            std::string sizePath;
+            if(field.isVector())
+            {
+                sizePath = field.vectorSizeMember().token().to_string();
+                const auto first = sizePath.substr(0, sizePath.find('.'));
+
+                for(std::size_t i = 0; i < fieldNames.size(); ++i)
+                {
+                    sizeField = (fieldNames[i] == first) ? std::to_string(i) : sizeField;
+                }
+            }
+
+            fields.push_back("{ " + cppStringLiteral(field.name().token().value()) + ", " + cppStringLiteral(typeName(field)) + ", " + typeKind(field) + ", "
+                + cppByteOrder(node, field) + ", " + boolean(fieldLayout.FixedOffset) + ", " + std::to_string(fieldLayout.FixedOffset ? fieldLayout.Offset : 0) + ", "
+                + size(fieldLayout.MinSize) + ", " + size(fieldLayout.MaxSize) + ", " + std::to_string(fieldLayout.ElementSize) + ", "
+                + std::to_string(field.isArray() ? field.arraySize() : 0) + ", " + sizeField + ", " + cppStringLiteral(sizePath) + ", "
+                + label(field) + ", " + boolean(field.isConst()) + ", " + std::to_string(attributeTable.size()) + ", " + std::to_string(fieldAttributes.size()) + " }");
+
+            attributeTable.insert(attributeTable.end(), fieldAttributes.begin(), fieldAttributes.end());
+            pointers += (pointers.empty() ? "&" : ", &") + cppShortName(node.name()) + "::" + member.Name;
+        }
+
+        emitBegin(os, node.name());
+        os << "        static constexpr std::size_t MinSize = " << size(layout.MinSize) << ";\n"
+           << "        static constexpr std::size_t MaxSize = " << size(layout.MaxSize) << ";\n"
+           << "        static constexpr std::size_t FixedPrefix = " << layout.FixedPrefix << ";\n"
+           << "        static constexpr std::size_t FieldCount = " << fields.size() << ";\n"
+           << "        static constexpr std::size_t VariableBlockCount = " << blocks.size() << ";\n"
+           << "        static constexpr std::size_t AttributeCount = " << ownAttributes << ";     // the struct's own, its fields' follow\n";
+
+        emitTable(os, runtime("FieldInfo"), "field", fields);
+        emitTable(os, runtime("VariableBlockInfo"), "variableBlock", blocks);
+        emitTable(os, runtime("CaseInfo"), "variableBlockCase", blockCases);
+        emitTable(os, runtime("AttributeInfo"), "attribute", attributeTable);
+
+        os << "\n        // pointers to the value type's members, in field order\n"
+           << "        static constexpr auto members() { return std::make_tuple(" << pointers << "); }\n";
+
+        emitEnd(os, node.name());
+    }
+}}}
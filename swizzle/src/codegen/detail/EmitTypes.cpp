@@ -0,0 +1,258 @@
+#include <swizzle/codegen/detail/EmitTypes.hpp>
+
+#include <swizzle/ast/nodes/Bitfield.hpp>
+#include <swizzle/ast/nodes/BitfieldField.hpp>
+#include <swizzle/ast/nodes/Enum.hpp>
+#include <swizzle/ast/nodes/EnumField.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/codegen/detail/CppNames.hpp>
+#include <swizzle/codegen/detail/Members.hpp>
+
+#include <boost/variant/static_visitor.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    namespace {
+
+        struct EnumValueToString : boost::static_visitor<std::string>
+        {
+            std::string operator()(const std::uint64_t value) const { return std::to_string(value) + "ULL"; }
+            std::string operator()(const std::int64_t value) const { return (value == std::numeric_limits<std::int64_t>::min()) ? "(-9223372036854775807LL - 1)" : std::to_string(value) + "LL"; }
+
+            // promote the 8 bit types so they don't print as characters
+            template<class T>
+            std::string operator()(const T value) const { return std::to_string(value + 0); }
+        };
+
+        // a field of a bitfield, its bits Begin..End inclusive
+        struct BitfieldFieldInfo
+        {
+            std::string Name;
+            std::size_t Begin = 0;
+            std::size_t End = 0;
+            std::uint64_t Mask = 0;
+        };
+
+        std::vector<BitfieldFieldInfo> bitfieldFields(const ast::nodes::Bitfield& node)
+        {
+            std::vector<BitfieldFieldInfo> result;
+
+            for(const auto& child : node.children())
+            {
+                if(child->kind() != ast::NodeKind::BitfieldField)
+                {
+                    continue;
+                }
+
+                const auto& field = static_cast<const ast::nodes::BitfieldField&>(*child);
+
+                BitfieldFieldInfo info;
+                info.Name = cppIdentifier(field.name().token().value());
+                info.Begin = field.beginBit();
+                info.End = field.endBit();
+
+                const auto width = info.End - info.Begin + 1;
+                info.Mask = ((width >= 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << width) - 1)) << info.Begin;
+
+                // the members every generated bitfield has
+                if((info.Name == "value") || (info.Name == "fields") || (info.Name == "Fields"))
+                {
+                    info.Name += "_";
+                }
+
+                result.push_back(info);
+            }
+
+            return result;
+        }
+
+        // bits per lane of Fields: the smallest that holds every field, with
+        // all lanes in 64 bits so unpack() can spread them with one pdep. 0
+        // when there is no such width, Fields is then not generated.
+        std::size_t bitfieldLaneBits(const std::vector<BitfieldFieldInfo>& fields)
+        {
+            if(fields.empty())
+            {
+                return 0;
+            }
+
+            std::size_t widest = 0;
+            for(const auto& field : fields)
+            {
+                widest = std::max(widest, field.End - field.Begin + 1);
+            }
+
+            for(std::size_t lane = 8; lane <= 64; lane *= 2)
+            {
+                if((widest <= lane) && (fields.size() * lane <= 64))
+                {
+                    return lane;
+                }
+            }
+
+            return 0;
+        }
+
+        // fields() of many bitfields, pext/pdep when the CPU has BMI2
+        void emitUnpack(std::ostream& os, const std::string& name, const std::vector<BitfieldFieldInfo>& fields, const std::size_t lane)
+        {
+            std::uint64_t fieldBits = 0;
+            std::uint64_t laneBits = 0;
+
+            for(std::size_t i = 0; i < fields.size(); ++i)
+            {
+                const auto width = fields[i].End - fields[i].Begin + 1;
+
+                fieldBits |= fields[i].Mask;
+                laneBits |= ((width >= 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << width) - 1)) << (i * lane);
+            }
+
+            std::ostringstream masks;
+            masks << "0x" << std::hex << fieldBits << "ULL, 0x" << laneBits << "ULL";
+
+            os << "    // fields() of @count bitfields at once, through BMI2 when the CPU has it\n"
+               << "    inline void unpack(const " << name << "* values, const std::size_t count, " << name << "::Fields* out)\n"
+               << "    {\n"
+               << "#if defined(SWIZZLE_X86_SIMD)\n"
+               << "        if(::swizzle::runtime::hasBmi2())\n"
+               << "        {\n"
+               << "            ::swizzle::runtime::spreadBitsBmi2(values, count, " << masks.str() << ", out);\n"
+               << "            return;\n"
+               << "        }\n"
+               << "#endif\n"
+               << "        for(std::size_t i = 0; i < count; ++i)\n"
+               << "        {\n"
+               << "            out[i] = values[i].fields();\n"
+               << "        }\n"
+               << "    }\n\n";
+        }
+    }
+
+    void emitEnum(std::ostream& os, const ast::nodes::Enum& node)
+    {
+        os << "    enum class " << cppShortName(node.name()) << " : " << cppBuiltinType(node.underlying().token().value()) << "\n"
+           << "    {\n";
+
+        for(const auto& child : node.children())
+        {
+            if(child->kind() == ast::NodeKind::EnumField)
+            {
+                const auto& field = static_cast<const ast::nodes::EnumField&>(*child);
+                os << "        " << cppIdentifier(field.name().token().value()) << " = " << boost::apply_visitor(EnumValueToString(), field.value()) << ",\n";
+            }
+        }
+
+        os << "    };\n\n";
+    }
+
+    void emitBitfield(std::ostream& os, const ast::nodes::Bitfield& node)
+    {
+        const auto name = cppShortName(node.name());
+        const auto type = cppBuiltinType(node.underlying().token().value());
+        const auto fields = bitfieldFields(node);
+        const auto lane = bitfieldLaneBits(fields);
+
+        os << "    struct " << name << "\n"
+           << "    {\n"
+           << "        " << type << " value;\n";
+
+        for(const auto& field : fields)
+        {
+            std::ostringstream mask;
+            mask << "0x" << std::hex << field.Mask;
+
+            os << "\n"
+               << "        // bits " << field.Begin << ".." << field.End << "\n"
+               << "        static constexpr " << type << " " << field.Name << "Mask() { return " << mask.str() << "; }\n"
+               << "        static constexpr unsigned " << field.Name << "Shift() { return " << field.Begin << "; }\n"
+               << "        constexpr " << type << " " << field.Name << "() const { return static_cast<" << type << ">((value & " << field.Name << "Mask()) >> " << field.Name << "Shift()); }\n"
+               << "        void " << field.Name << "(const " << type << " field_) { value = static_cast<" << type << ">((value & ~" << field.Name << "Mask()) | ((field_ << " << field.Name << "Shift()) & " << field.Name << "Mask())); }\n";
+        }
+
+        if(lane)
+        {
+            const auto laneType = "std::uint" + std::to_string(lane) + "_t";
+
+            os << "\n"
+               << "        // every field, each in a lane of its own, see unpack()\n"
+               << "        struct Fields\n"
+               << "        {\n";
+
+            for(const auto& field : fields)
+            {
+                os << "            " << laneType << " " << field.Name << ";\n";
+            }
+
+            os << "        };\n\n"
+               << "        constexpr Fields fields() const\n"
+               << "        {\n"
+               << "            return Fields {";
+
+            for(std::size_t i = 0; i < fields.size(); ++i)
+            {
+                os << (i ? ", " : " ") << "static_cast<" << laneType << ">(" << fields[i].Name << "())";
+            }
+
+            os << " };\n"
+               << "        }\n";
+        }
+
+        os << "    };\n\n";
+
+        if(lane)
+        {
+            emitUnpack(os, name, fields, lane);
+        }
+    }
+
+    void emitValueType(std::ostream& os, const ast::nodes::Struct& node)
+    {
+        os << "    struct " << cppShortName(node.name()) << "\n"
+           << "    {\n";
+
+        for(const auto& member : members(node))
+        {
+            if(member.Field)
+            {
+                const auto& field = *member.Field;
+                const auto type = cppValueType(field);
+
+                if(field.isArray())
+                {
+                    os << "        std::array<" << type << ", " << field.arraySize() << "> " << member.Name << " {};\n";
+                }
+                else if(field.isVector())
+                {
+                    os << "        ::swizzle::runtime::ArenaVector<" << type << "> " << member.Name << ";\n";
+                }
+                else
+                {
+                    os << "        " << type << " " << member.Name << " {};\n";
+                }
+
+                continue;
+            }
+
+            // one member per case type, only the selected one is decoded
+            std::set<const ast::nodes::Struct*> types;
+            for(const auto& c : cases(*member.Block))
+            {
+                if(types.insert(c.Type).second)
+                {
+                    os << "        " << cppQualifiedName(c.Type->name()) << " " << caseMemberName(*c.Type) << ";\n";
+                }
+            }
+        }
+
+        os << "    };\n\n";
+    }
+}}}
@@ -0,0 +1,368 @@
+#include <swizzle/codegen/detail/EmitView.hpp>
+
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/VariableBlock.hpp>
+#include <swizzle/codegen/detail/CppNames.hpp>
+#include <swizzle/codegen/detail/Dispatch.hpp>
+#include <swizzle/codegen/detail/Members.hpp>
+
+#include <cstddef>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    namespace {
+
+        std::string viewName(const ast::nodes::Struct& node)
+        {
+            return cppQualifiedName(node.name()) + "View";
+        }
+
+        // where @member starts, relative to data_
+        std::string offsetOf(const Member& member)
+        {
+            return member.Layout->FixedOffset ? std::to_string(member.Layout->Offset) : "offset_" + member.Name + "()";
+        }
+
+        std::string sizeOf(const Member& member)
+        {
+            return constantSize(member) ? std::to_string(member.Layout->MinSize) : "size_" + member.Name + "()";
+        }
+
+        // number of elements of an array or vector field, read through the view's accessors
+        std::string count(const ast::nodes::StructField& field)
+        {
+            if(field.isArray())
+            {
+                return std::to_string(field.arraySize());
+            }
+
+            return "static_cast<std::size_t>(" + cppMemberPath(field.vectorSizeMember().token().value(), "()") + ")";
+        }
+
+        std::string discriminator(const ast::nodes::Struct& node, const ast::nodes::VariableBlock& block)
+        {
+            const auto path = block.variableOnField().token().value();
+            const auto underlying = enumUnderlyingType(*resolveMember(node, path));
+            const auto value = cppMemberPath(path, "()");
+
+            return underlying.empty() ? value : "static_cast<" + underlying + ">(" + value + ")";
+        }
+
+        // return type of @field's accessor
+        std::string accessorType(const ast::nodes::Struct& node, const ast::nodes::StructField& field)
+        {
+            const auto element = structType(field);
+            const auto many = field.isArray() || field.isVector();
+
+            if(!element)
+            {
+                const auto type = cppValueType(field);
+                return many ? "::swizzle::runtime::FixedRange<::swizzle::runtime::Scalar<" + type + ", " + cppByteOrder(node, field) + ">>" : type;
+            }
+
+            if(!many)
+            {
+                return viewName(*element);
+            }
+
+            return (element->layout().fixed() ? "::swizzle::runtime::FixedRange<" : "::swizzle::runtime::VariableRange<") + viewName(*element) + ">";
+        }
+
+        // "const auto offset_ = offset_foo();" for members after the first variable
+        // length one, then @body with data/length replaced by the member's position
+        void emitBody(std::ostream& os, const Member& member, const std::string& body)
+        {
+            std::string data = "data_ + " + offsetOf(member);
+            std::string length = "length_ - " + offsetOf(member);
+
+            if(!member.Layout->FixedOffset)
+            {
+                os << "            const auto offset_ = " << offsetOf(member) << ";\n";
+                data = "data_ + offset_";
+                length = "length_ - offset_";
+            }
+
+            std::string result = body;
+            for(std::size_t at = result.find("@data"); at != std::string::npos; at = result.find("@data", at))
+            {
+                result.replace(at, 5, data);
+            }
+
+            for(std::size_t at = result.find("@length"); at != std::string::npos; at = result.find("@length", at))
+            {
+                result.replace(at, 7, length);
+            }
+
+            os << result;
+        }
+
+        void emitFieldAccessor(std::ostream& os, const ast::nodes::Struct& node, const Member& member)
+        {
+            const auto& field = *member.Field;
+            const auto type = accessorType(node, field);
+            const auto element = structType(field);
+
+            std::string body;
+            if(!field.isArray() && !field.isVector())
+            {
+                body = element
+                    ? "            return " + type + "(@data, @length);\n"
+                    : "            return ::swizzle::runtime::load<" + type + ", " + cppByteOrder(node, field) + ">(@data);\n";
+            }
+            else
+            {
+                body = (element && !element->layout().fixed())
+                    ? "            return " + type + "(@data, @length, " + count(field) + ");\n"
+                    : "            return " + type + "(@data, " + count(field) + ");\n";
+            }
+
+            os << "        " << type << " " << member.Name << "() const\n"
+               << "        {\n";
+            emitBody(os, member, body);
+            os << "        }\n\n";
+        }
+
+        // isFoo() and asFoo() for every case type Foo
+        void emitBlockAccessors(std::ostream& os, const ast::nodes::Struct& node, const Member& member)
+        {
+            const auto all = cases(*member.Block);
+            std::set<const ast::nodes::Struct*> done;
+
+            for(const auto& c : all)
+            {
+                if(!done.insert(c.Type).second)
+                {
+                    continue;
+                }
+
+                std::string values;
+                for(const auto& other : all)
+                {
+                    if(other.Type == c.Type)
+                    {
+                        values += (values.empty() ? "" : " || ") + std::string("(value_ == ") + other.Value + ")";
+                    }
+                }
+
+                const auto name = cppShortName(c.Type->name());
+
+                os << "        bool is" << name << "() const\n"
+                   << "        {\n"
+                   << "            const auto value_ = " << discriminator(node, *member.Block) << ";\n"
+                   << "            return " << values << ";\n"
+                   << "        }\n\n"
+                   << "        " << viewName(*c.Type) << " as" << name << "() const\n"
+                   << "        {\n";
+                emitBody(os, member, "            return " + viewName(*c.Type) + "(@data, @length);\n");
+                os << "        }\n\n";
+            }
+        }
+
+        void emitIsValid(std::ostream& os, const ast::nodes::Struct& node, const std::vector<Member>& all)
+        {
+            os << "        // @length holds the whole message and every variable_block case is known,\n"
+               << "        // the accessors assume both\n"
+               << "        bool isValid() const\n"
+               << "        {\n";
+
+            if(node.layout().fixed())
+            {
+                os << "            return length_ >= Size;\n"
+                   << "        }\n\n";
+                return;
+            }
+
+            os << "            std::size_t offset_ = 0;\n";
+
+            std::size_t pending = 0;
+            for(const auto& member : all)
+            {
+                if(constantSize(member))
+                {
+                    pending += member.Layout->MinSize;
+                    continue;
+                }
+
+                if(pending)
+                {
+                    os << "            offset_ += " << pending << ";\n";
+                    pending = 0;
+                }
+
+                os << "            if(length_ < offset_) return false;\n";
+
+                const auto view = member.Field && structType(*member.Field) ? viewName(*structType(*member.Field)) : std::string();
+                const auto check = "                " + view + " view_(data_ + offset_, length_ - offset_);\n"
+                                   "                if(!view_.isValid()) return false;\n"
+                                   "                offset_ += view_.wireSize();\n";
+
+                if(member.Block)
+                {
+                    const auto dispatch = analyzeDispatch(node, *member.Block, member.Name);
+                    const auto blockCases = cases(*member.Block);
+
+                    os << "            " << dispatchSwitch(dispatch, discriminator(node, *member.Block)) << "\n"
+                       << "            {\n";
+
+                    for(std::size_t c = 0; c < blockCases.size(); ++c)
+                    {
+                        os << "            " << dispatchLabel(dispatch, c) << ":\n"
+                           << "            {\n"
+                           << "                " << viewName(*blockCases[c].Type) << " view_(data_ + offset_, length_ - offset_);\n"
+                           << "                if(!view_.isValid()) return false;\n"
+                           << "                offset_ += view_.wireSize();\n"
+                           << "                break;\n"
+                           << "            }\n";
+                    }
+
+                    os << "            default:\n"
+                       << "                return false;\n"
+                       << "            }\n";
+                }
+                else if(view.empty() || structType(*member.Field)->layout().fixed())
+                {
+                    os << "            offset_ += " << count(*member.Field) << " * " << member.Layout->ElementSize << ";\n";
+                }
+                else if(member.Field->isArray() || member.Field->isVector())
+                {
+                    os << "            for(std::size_t i_ = 0, count_ = " << count(*member.Field) << "; i_ < count_; ++i_)\n"
+                       << "            {\n" << check
+                       << "            }\n";
+                }
+                else
+                {
+                    os << "            {\n" << check
+                       << "            }\n";
+                }
+            }
+
+            if(pending)
+            {
+                os << "            offset_ += " << pending << ";\n";
+            }
+
+            os << "            return length_ >= offset_;\n"
+               << "        }\n\n";
+        }
+
+        void emitHelpers(std::ostream& os, const ast::nodes::Struct& node, const std::vector<Member>& all)
+        {
+            for(std::size_t i = 0; i < all.size(); ++i)
+            {
+                const auto& member = all[i];
+
+                if(!member.Layout->FixedOffset)
+                {
+                    os << "        std::size_t offset_" << member.Name << "() const\n"
+                       << "        {\n"
+                       << "            return " << offsetOf(all[i - 1]) << " + " << sizeOf(all[i - 1]) << ";\n"
+                       << "        }\n\n";
+                }
+
+                if(constantSize(member))
+                {
+                    continue;
+                }
+
+                os << "        std::size_t size_" << member.Name << "() const\n"
+                   << "        {\n";
+
+                if(member.Field)
+                {
+                    os << "            return " << member.Name << "().wireSize();\n";
+                }
+                else
+                {
+                    const auto dispatch = analyzeDispatch(node, *member.Block, member.Name);
+                    const auto blockCases = cases(*member.Block);
+
+                    std::string body = "            " + dispatchSwitch(dispatch, discriminator(node, *member.Block)) + "\n"
+                                       "            {\n";
+
+                    for(std::size_t c = 0; c < blockCases.size(); ++c)
+                    {
+                        body += "            " + dispatchLabel(dispatch, c) + ": return " + viewName(*blockCases[c].Type) + "(@data, @length).wireSize();\n";
+                    }
+
+                    body += "            default: return 0;\n"
+                            "            }\n";
+
+                    emitBody(os, member, body);
+                }
+
+                os << "        }\n\n";
+            }
+        }
+    }
+
+    void emitView(std::ostream& os, const ast::nodes::Struct& node)
+    {
+        const auto name = cppShortName(node.name()) + "View";
+        const auto& layout = node.layout();
+        const auto all = members(node);
+
+        os << "    class " << name << "\n"
+           << "    {\n"
+           << "    public:\n"
+           << "        static constexpr std::size_t FixedPrefix = " << layout.FixedPrefix << ";     // bytes at constant offsets\n"
+           << "        static constexpr std::size_t MinSize = " << layout.MinSize << ";\n";
+
+        if(layout.fixed())
+        {
+            os << "        static constexpr std::size_t Size = " << layout.MinSize << ";\n";
+        }
+
+        os << "\n"
+           << "        " << name << "(const char* data, const std::size_t length)\n"
+           << "            : data_(data)\n"
+           << "            , length_(length)\n"
+           << "        {\n"
+           << "        }\n\n";
+
+        if(layout.fixed())
+        {
+            os << "        // element codec of a FixedRange\n"
+               << "        static " << name << " read(const char* data) { return " << name << "(data, Size); }\n\n";
+        }
+
+        emitIsValid(os, node, all);
+
+        os << "        // bytes the message takes on the wire\n"
+           << "        std::size_t wireSize() const\n"
+           << "        {\n";
+
+        if(layout.fixed())
+        {
+            os << "            return Size;\n";
+        }
+        else
+        {
+            os << "            return " << offsetOf(all.back()) << " + " << sizeOf(all.back()) << ";\n";
+        }
+
+        os << "        }\n\n";
+
+        for(const auto& member : all)
+        {
+            if(member.Field)
+            {
+                emitFieldAccessor(os, node, member);
+            }
+            else
+            {
+                emitBlockAccessors(os, node, member);
+            }
+        }
+
+        os << "    private:\n";
+        emitHelpers(os, node, all);
+
+        os << "        const char* data_;\n"
+           << "        std::size_t length_;\n"
+           << "    };\n\n";
+    }
+}}}
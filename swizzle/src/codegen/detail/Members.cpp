@@ -0,0 +1,140 @@
+#include <swizzle/codegen/detail/Members.hpp>
+
+#include <swizzle/ast/nodes/Enum.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/VariableBlock.hpp>
+#include <swizzle/ast/nodes/VariableBlockCase.hpp>
+#include <swizzle/codegen/detail/CppNames.hpp>
+
+#include <algorithm>
+#include <cctype>
+
+namespace swizzle { namespace codegen { namespace detail {
+
+    std::vector<Member> members(const ast::nodes::Struct& structure)
+    {
+        std::vector<Member> result;
+        std::size_t blocks = 0;
+
+        for(const auto& child : structure.children())
+        {
+            Member member;
+
+            if(child->kind() == ast::NodeKind::StructField)
+            {
+                member.Field = static_cast<const ast::nodes::StructField*>(child.get());
+                member.Layout = &member.Field->layout();
+                member.Name = cppIdentifier(member.Field->name().token().value());
+            }
+            else if(child->kind() == ast::NodeKind::VariableBlock)
+            {
+                member.Block = static_cast<const ast::nodes::VariableBlock*>(child.get());
+                member.Layout = &member.Block->layout();
+                member.Name = "variableBlock" + (blocks ? std::to_string(blocks) : std::string());
+                ++blocks;
+            }
+            else
+            {
+                continue;
+            }
+
+            result.push_back(member);
+        }
+
+        return result;
+    }
+
+    bool constantSize(const Member& member)
+    {
+        return member.Field && !member.Field->isVector() && member.Layout->fixed();
+    }
+
+    bool scalarRun(const ast::nodes::StructField& field)
+    {
+        if(structType(field))
+        {
+            return false;
+        }
+
+        return field.isVector() || (field.isArray() && (static_cast<std::size_t>(field.arraySize()) * field.layout().ElementSize >= 16));
+    }
+
+    std::vector<Case> cases(const ast::nodes::VariableBlock& block)
+    {
+        std::vector<Case> result;
+
+        for(const auto& child : block.children())
+        {
+            if(child->kind() == ast::NodeKind::VariableBlockCase)
+            {
+                const auto& blockCase = static_cast<const ast::nodes::VariableBlockCase&>(*child);
+
+                Case c;
+                c.Value = blockCase.value().token().to_string();
+                c.Type = static_cast<const ast::nodes::Struct*>(blockCase.typeDeclaration());
+
+                result.push_back(c);
+            }
+        }
+
+        return result;
+    }
+
+    std::string caseMemberName(const ast::nodes::Struct& type)
+    {
+        auto name = cppShortName(type.name());
+        name[0] = static_cast<char>(std::tolower(static_cast<unsigned char>(name[0])));
+
+        return name + "Case";
+    }
+
+    const ast::nodes::StructField* resolveMember(const ast::nodes::Struct& structure, const boost::string_view& path)
+    {
+        const ast::nodes::Struct* current = &structure;
+
+        std::size_t begin = 0;
+        while(current)
+        {
+            const auto end = std::min(path.find('.', begin), path.size());
+            const auto name = path.substr(begin, end - begin);
+
+            const ast::nodes::StructField* member = nullptr;
+            for(const auto& child : current->children())
+            {
+                if((child->kind() == ast::NodeKind::StructField) && (static_cast<const ast::nodes::StructField&>(*child).name().token().value() == name))
+                {
+                    member = static_cast<const ast::nodes::StructField*>(child.get());
+                    break;
+                }
+            }
+
+            if(!member || (end == path.size()))
+            {
+                return member;
+            }
+
+            current = structType(*member);
+            begin = end + 1;
+        }
+
+        return nullptr;
+    }
+
+    const ast::nodes::Struct* structType(const ast::nodes::StructField& field)
+    {
+        const auto declaration = field.typeDeclaration();
+        return (declaration && declaration->kind() == ast::NodeKind::Struct) ? static_cast<const ast::nodes::Struct*>(declaration) : nullptr;
+    }
+
+    std::string enumUnderlyingType(const ast::nodes::StructField& field)
+    {
+        const auto declaration = field.typeDeclaration();
+        if(declaration && declaration->kind() == ast::NodeKind::Enum)
+        {
+            return cppBuiltinType(static_cast<const ast::nodes::Enum&>(*declaration).underlying().token().value());
+        }
+
+        return std::string();
+    }
+}}}
@@ -0,0 +1,39 @@
+#include <swizzle/driver/AllocationCount.hpp>
+
+#include <atomic>
+
+namespace swizzle { namespace driver {
+
+    namespace {
+
+        thread_local std::uint64_t allocations = 0;
+        thread_local std::uint64_t allocatedBytes = 0;
+
+        std::atomic<bool> counted(false);
+    }
+
+    void countAllocation(std::size_t bytes) noexcept
+    {
+        if(allocations++ == 0)
+        {
+            counted.store(true, std::memory_order_relaxed);
+        }
+
+        allocatedBytes += bytes;
+    }
+
+    std::uint64_t threadAllocations() noexcept
+    {
+        return allocations;
+    }
+
+    std::uint64_t threadAllocatedBytes() noexcept
+    {
+        return allocatedBytes;
+    }
+
+    bool allocationsCounted() noexcept
+    {
+        return counted.load(std::memory_order_relaxed);
+    }
+}}
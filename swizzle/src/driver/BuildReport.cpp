@@ -0,0 +1,283 @@
+#include <swizzle/driver/BuildReport.hpp>
+
+#include <swizzle/ast/NodeIndex.hpp>
+#include <swizzle/ast/StaticVisitor.hpp>
+#include <swizzle/driver/AllocationCount.hpp>
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace swizzle { namespace driver {
+
+    namespace {
+
+        std::string name(const ast::NodeKind kind)
+        {
+            std::ostringstream os;
+            os << kind;
+
+            // "NodeKind::Struct" -> "Struct"
+            const auto s = os.str();
+            const auto colon = s.rfind(':');
+            return colon == std::string::npos ? s : s.substr(colon + 1);
+        }
+
+        std::size_t nodeSize(const ast::NodeKind kind)
+        {
+            using namespace ast;
+
+            switch(kind)
+            {
+            case NodeKind::Node: return sizeof(Node);
+            case NodeKind::Attribute: return sizeof(nodes::Attribute);
+            case NodeKind::AttributeBlock: return sizeof(nodes::AttributeBlock);
+            case NodeKind::Bitfield: return sizeof(nodes::Bitfield);
+            case NodeKind::BitfieldField: return sizeof(nodes::BitfieldField);
+            case NodeKind::CharLiteral: return sizeof(nodes::CharLiteral);
+            case NodeKind::Comment: return sizeof(nodes::Comment);
+            case NodeKind::DefaultStringValue: return sizeof(nodes::DefaultStringValue);
+            case NodeKind::DefaultValue: return sizeof(nodes::DefaultValue);
+            case NodeKind::Enum: return sizeof(nodes::Enum);
+            case NodeKind::EnumField: return sizeof(nodes::EnumField);
+            case NodeKind::Extern: return sizeof(nodes::Extern);
+            case NodeKind::FieldLabel: return sizeof(nodes::FieldLabel);
+            case NodeKind::HexLiteral: return sizeof(nodes::HexLiteral);
+            case NodeKind::Import: return sizeof(nodes::Import);
+            case NodeKind::MultilineComment: return sizeof(nodes::MultilineComment);
+            case NodeKind::Namespace: return sizeof(nodes::Namespace);
+            case NodeKind::NumericLiteral: return sizeof(nodes::NumericLiteral);
+            case NodeKind::StringLiteral: return sizeof(nodes::StringLiteral);
+            case NodeKind::Struct: return sizeof(nodes::Struct);
+            case NodeKind::StructField: return sizeof(nodes::StructField);
+            case NodeKind::TypeAlias: return sizeof(nodes::TypeAlias);
+            case NodeKind::VariableBlock: return sizeof(nodes::VariableBlock);
+            case NodeKind::VariableBlockCase: return sizeof(nodes::VariableBlockCase);
+            };
+
+            return 0;
+        }
+
+        double rate(std::uint64_t count, double seconds)
+        {
+            return seconds > 0 ? static_cast<double>(count) / seconds : 0;
+        }
+
+        ast::NodeKind kindAt(std::size_t i)
+        {
+            return static_cast<ast::NodeKind>(i);
+        }
+
+        Phase phaseAt(std::size_t i)
+        {
+            return static_cast<Phase>(i);
+        }
+    }
+
+    void BuildReport::add(const Module& module)
+    {
+        phases_ += module.phases();
+
+        ++files_;
+        bytes_ += module.sourceSize();
+        tokens_ += module.tokenCount();
+        tokenizerStats_ += module.tokenizerStats();
+        parserStats_ += module.parserStats();
+
+        if(!module.parsed())
+        {
+            return;
+        }
+
+        const auto& index = module.ast().index();
+        for(std::size_t i = 0; i < ast::NodeKindCount; ++i)
+        {
+            const auto count = index.of(kindAt(i)).size();
+
+            nodesByKind_[i] += count;
+            nodes_ += count;
+            nodeBytes_ += count * nodeSize(kindAt(i));
+        }
+    }
+
+    void BuildReport::print(std::ostream& os, const Sections& sections) const
+    {
+        const auto flags = os.flags();
+        os << std::fixed;
+
+        if(sections.Time)
+        {
+            os << "Time report: " << files_ << " file(s), " << bytes_ << " bytes, " << std::setprecision(3) << (elapsedSeconds_ * 1000) << " ms elapsed\n";
+            os << "  " << std::left << std::setw(10) << "phase" << std::right << std::setw(12) << "wall ms" << std::setw(12) << "cpu ms" << "\n";
+
+            for(std::size_t i = 0; i < PhaseCount; ++i)
+            {
+                std::ostringstream phase;
+                phase << phaseAt(i);
+
+                os << "  " << std::left << std::setw(10) << phase.str() << std::right
+                    << std::setw(12) << (phases_[phaseAt(i)].WallSeconds * 1000)
+                    << std::setw(12) << (phases_[phaseAt(i)].CpuSeconds * 1000) << "\n";
+            }
+
+            os << std::setprecision(0);
+            os << "  tokens/s  " << rate(tokens_, phases_[Phase::Lex].WallSeconds) << " (" << tokens_ << " tokens)\n";
+            os << "  nodes/s   " << rate(nodes_, phases_[Phase::Parse].WallSeconds) << " (" << nodes_ << " nodes)\n";
+        }
+
+        if(sections.Memory)
+        {
+            os << "Memory report: peak RSS " << (peakResidentSetSize() / 1024) << " KiB\n";
+
+            if(allocationsCounted())
+            {
+                os << "  " << std::left << std::setw(10) << "phase" << std::right << std::setw(14) << "allocations" << std::setw(14) << "bytes" << "\n";
+
+                for(std::size_t i = 0; i < PhaseCount; ++i)
+                {
+                    std::ostringstream phase;
+                    phase << phaseAt(i);
+
+                    os << "  " << std::left << std::setw(10) << phase.str() << std::right
+                        << std::setw(14) << phases_[phaseAt(i)].Allocations
+                        << std::setw(14) << phases_[phaseAt(i)].AllocatedBytes << "\n";
+                }
+            }
+            else
+            {
+                os << "  allocations not counted (operator new is not instrumented)\n";
+            }
+
+            os << "  " << std::left << std::setw(20) << "node kind" << std::right << std::setw(10) << "nodes" << std::setw(12) << "bytes" << "\n";
+
+            for(std::size_t i = 0; i < ast::NodeKindCount; ++i)
+            {
+                if(nodesByKind_[i] != 0)
+                {
+                    os << "  " << std::left << std::setw(20) << name(kindAt(i)) << std::right
+                        << std::setw(10) << nodesByKind_[i]
+                        << std::setw(12) << (nodesByKind_[i] * nodeSize(kindAt(i))) << "\n";
+                }
+            }
+        }
+
+        if(sections.States)
+        {
+            if(lexer::TokenizerStateStats::Enabled)
+            {
+                os << "Lexer states: " << tokenizerStats_.transitions() << " transition(s)\n";
+                tokenizerStats_.print(os);
+
+                os << "Parser states: " << parserStats_.transitions() << " transition(s)\n";
+                parserStats_.print(os);
+            }
+            else
+            {
+                os << "State report: not available, build with SWIZZLE_STATE_STATS\n";
+            }
+        }
+
+        os.flags(flags);
+    }
+
+    void BuildReport::printJson(std::ostream& os, const Sections& sections) const
+    {
+        const auto flags = os.flags();
+        const auto precision = os.precision();
+        os << std::setprecision(9);
+
+        os << "{\n";
+        os << "  \"files\": " << files_ << ",\n";
+        os << "  \"bytes\": " << bytes_ << ",\n";
+        os << "  \"tokens\": " << tokens_ << ",\n";
+        os << "  \"nodes\": " << nodes_;
+
+        if(sections.Time)
+        {
+            os << ",\n  \"elapsed_seconds\": " << elapsedSeconds_ << ",\n";
+            os << "  \"tokens_per_second\": " << rate(tokens_, phases_[Phase::Lex].WallSeconds) << ",\n";
+            os << "  \"nodes_per_second\": " << rate(nodes_, phases_[Phase::Parse].WallSeconds);
+        }
+
+        if(sections.Memory)
+        {
+            os << ",\n  \"peak_rss_bytes\": " << peakResidentSetSize();
+            os << ",\n  \"allocations_counted\": " << (allocationsCounted() ? "true" : "false");
+        }
+
+        os << ",\n  \"phases\": {";
+
+        for(std::size_t i = 0; i < PhaseCount; ++i)
+        {
+            const auto& stats = phases_[phaseAt(i)];
+            os << (i == 0 ? "\n" : ",\n") << "    \"" << phaseAt(i) << "\": {";
+
+            const char* separator = "";
+            if(sections.Time)
+            {
+                os << " \"wall_seconds\": " << stats.WallSeconds << ", \"cpu_seconds\": " << stats.CpuSeconds;
+                separator = ",";
+            }
+
+            if(sections.Memory)
+            {
+                os << separator << " \"allocations\": " << stats.Allocations << ", \"allocated_bytes\": " << stats.AllocatedBytes;
+            }
+
+            os << " }";
+        }
+
+        os << "\n  }";
+
+        if(sections.Memory)
+        {
+            os << ",\n  \"node_kinds\": {";
+
+            bool first = true;
+            for(std::size_t i = 0; i < ast::NodeKindCount; ++i)
+            {
+                if(nodesByKind_[i] != 0)
+                {
+                    os << (first ? "\n" : ",\n") << "    \"" << name(kindAt(i)) << "\": { \"nodes\": " << nodesByKind_[i]
+                        << ", \"bytes\": " << (nodesByKind_[i] * nodeSize(kindAt(i))) << " }";
+                    first = false;
+                }
+            }
+
+            os << "\n  }";
+        }
+
+        if(sections.States && lexer::TokenizerStateStats::Enabled)
+        {
+            os << ",\n  \"lexer_states\": ";
+            tokenizerStats_.printJson(os);
+            os << ",\n  \"parser_states\": ";
+            parserStats_.printJson(os);
+        }
+
+        os << "\n}\n";
+
+        os.precision(precision);
+        os.flags(flags);
+    }
+
+    std::uint64_t peakResidentSetSize()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        rusage usage;
+        if(getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+#if defined(__APPLE__)
+            return static_cast<std::uint64_t>(usage.ru_maxrss);            // bytes
+#else
+            return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;     // KiB
+#endif
+        }
+#endif
+        return 0;
+    }
+}}
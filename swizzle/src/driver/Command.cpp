@@ -0,0 +1,456 @@
+#include <swizzle/driver/Command.hpp>
+
+#include <swizzle/ast/binary/Serialize.hpp>
+#include <swizzle/codegen/Cpp.hpp>
+#include <swizzle/driver/Depfile.hpp>
+#include <swizzle/driver/Hash.hpp>
+#include <swizzle/driver/OutputCache.hpp>
+#include <swizzle/driver/PhaseTimer.hpp>
+#include <swizzle/driver/Version.hpp>
+#include <swizzle/driver/WriteIfChanged.hpp>
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/utility/string_view.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace swizzle { namespace driver {
+
+    namespace {
+
+        // output of @module relative to Command::EmitAst
+        std::string astName(const boost::filesystem::path& module)
+        {
+            auto output = module.is_absolute() ? module.filename() : module;
+            output.replace_extension(".swzast");
+
+            return output.generic_string();
+        }
+
+        bool hasOutputs(const Command& command)
+        {
+            return !command.EmitAst.empty() || !command.EmitCpp.empty();
+        }
+
+        // every output of @module
+        std::vector<boost::filesystem::path> outputs(const Command& command, const boost::filesystem::path& module)
+        {
+            std::vector<boost::filesystem::path> result;
+
+            if(!command.EmitAst.empty())
+            {
+                result.push_back(command.EmitAst / astName(module));
+            }
+
+            if(!command.EmitCpp.empty())
+            {
+                result.push_back(command.EmitCpp / codegen::cppHeaderName(module));
+            }
+
+            return result;
+        }
+
+        // where an artifact goes, each backend's outputs have their own extension
+        boost::filesystem::path outputPath(const Command& command, const std::string& artifact)
+        {
+            const auto extension = boost::filesystem::path(artifact).extension();
+            return (extension == ".swzast" ? command.EmitAst : command.EmitCpp) / artifact;
+        }
+
+        // the backends and their options, part of every OutputCache key
+        std::string backend(const Command& command)
+        {
+            std::string result;
+            result += command.EmitAst.empty() ? "" : "ast;";
+            result += command.EmitCpp.empty() ? "" : "cpp;";
+
+            return result;
+        }
+
+        void update(Hash& hash, const boost::string_view& text)
+        {
+            hash.update(text.length()).update(text);
+        }
+
+        std::uint64_t manifestKey(const boost::filesystem::path& module, std::uint64_t contentHash)
+        {
+            Hash hash;
+            update(hash, "manifest");
+            update(hash, compilerVersion());
+            update(hash, module.generic_string());
+
+            return hash.update(contentHash).value();
+        }
+
+        // @imports: interface hash of every module @module imports, directly or not
+        std::uint64_t artifactsKey(const Command& command, const boost::filesystem::path& module, std::uint64_t contentHash, const std::map<boost::filesystem::path, std::uint64_t>& imports)
+        {
+            Hash hash;
+            update(hash, "artifacts");
+            update(hash, compilerVersion());
+            update(hash, backend(command));
+            update(hash, module.generic_string());
+            hash.update(contentHash);
+
+            for(const auto& import : imports)
+            {
+                update(hash, import.first.generic_string());
+                hash.update(import.second);
+            }
+
+            return hash.value();
+        }
+
+        // the interface hash of everything @module imports, false if one is unknown
+        template<class InterfaceOf>
+        bool importedInterfaces(const ImportGraph& graph, const boost::filesystem::path& module, InterfaceOf interfaceOf, std::map<boost::filesystem::path, std::uint64_t>& imports)
+        {
+            for(const auto& import : transitiveImports(graph, module))
+            {
+                if(import != module && !interfaceOf(import, imports[import]))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        bool contentHash(const boost::filesystem::path& file, std::uint64_t& hash)
+        {
+            boost::filesystem::ifstream is(file, std::ios::in | std::ios::binary);
+            if(!is)
+            {
+                return false;
+            }
+
+            const std::string source((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+            hash = Hash().update(source).value();
+
+            return true;
+        }
+
+        // the import closure of @module from the cached manifests, without lexing anything
+        bool findManifests(const OutputCache& cache, const Driver& driver, const boost::filesystem::path& module, std::map<boost::filesystem::path, DependencyRecord>& manifests)
+        {
+            if(manifests.count(module))
+            {
+                return true;
+            }
+
+            std::uint64_t hash = 0;
+            DependencyRecord manifest;
+
+            if(!contentHash(module.is_absolute() ? module : driver.importRoot() / module, hash) || !cache.find(manifestKey(module, hash), manifest))
+            {
+                return false;
+            }
+
+            manifests[module] = manifest;
+
+            for(const auto& import : manifest.Imports)
+            {
+                if(!findManifests(cache, driver, import.lexically_normal(), manifests))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // write the outputs of every module @file needs from @cache, @graph
+        // gains their imports. False, with nothing written, unless all of
+        // them were cached.
+        bool restore(const OutputCache& cache, const Driver& driver, const Command& command, const boost::filesystem::path& file, ImportGraph& graph)
+        {
+            std::map<boost::filesystem::path, DependencyRecord> manifests;
+            if(!findManifests(cache, driver, driver.key(file), manifests))
+            {
+                return false;
+            }
+
+            ImportGraph closure;
+            for(const auto& manifest : manifests)
+            {
+                auto& imports = closure[manifest.first];
+                for(const auto& import : manifest.second.Imports)
+                {
+                    imports.push_back(import.lexically_normal());
+                }
+            }
+
+            const auto interfaceOf = [&](const boost::filesystem::path& module, std::uint64_t& hash)
+            {
+                hash = manifests.at(module).InterfaceHash;
+                return true;
+            };
+
+            std::vector<OutputCache::Artifacts> outputs;
+            for(const auto& manifest : manifests)
+            {
+                std::map<boost::filesystem::path, std::uint64_t> imports;
+                importedInterfaces(closure, manifest.first, interfaceOf, imports);
+
+                OutputCache::Artifacts artifacts;
+                if(!cache.find(artifactsKey(command, manifest.first, manifest.second.ContentHash, imports), artifacts))
+                {
+                    return false;
+                }
+
+                outputs.push_back(std::move(artifacts));
+            }
+
+            for(const auto& artifacts : outputs)
+            {
+                for(const auto& artifact : artifacts)
+                {
+                    writeIfChanged(outputPath(command, artifact.first), artifact.second);
+                }
+            }
+
+            graph.insert(closure.begin(), closure.end());
+            return true;
+        }
+
+        void store(OutputCache& cache, const Command& command, const ModuleMap& modules, const std::map<boost::filesystem::path, OutputCache::Artifacts>& outputs)
+        {
+            const auto graph = importGraph(modules);
+
+            const auto interfaceOf = [&](const boost::filesystem::path& module, std::uint64_t& hash)
+            {
+                const auto iter = modules.find(module);
+                if(iter == modules.end() || iter->second->failed())
+                {
+                    return false;
+                }
+
+                hash = iter->second->interfaceHash();
+                return true;
+            };
+
+            for(const auto& module : modules)
+            {
+                const auto record = module.second->record();
+                cache.insert(manifestKey(module.first, record.ContentHash), record);
+
+                const auto artifacts = outputs.find(module.first);
+                std::map<boost::filesystem::path, std::uint64_t> imports;
+
+                if(artifacts != outputs.end() && importedInterfaces(graph, module.first, interfaceOf, imports))
+                {
+                    cache.insert(artifactsKey(command, module.first, record.ContentHash, imports), artifacts->second);
+                }
+            }
+        }
+
+        bool reportErrors(const ModuleMap& modules, std::ostream& errors)
+        {
+            bool failed = false;
+            for(const auto& module : modules)
+            {
+                if(module.second->failed())
+                {
+                    errors << module.first.string() << ": " << module.second->error() << "\n";
+                    failed = true;
+                }
+            }
+
+            return failed;
+        }
+
+        // outputs are only written for changed modules, if one of an up to date
+        // module's outputs went missing it has to be rebuilt from scratch
+        bool outputsMissing(const Command& command, const ModuleMap& modules)
+        {
+            for(const auto& module : modules)
+            {
+                if(!module.second->changed())
+                {
+                    for(const auto& output : outputs(command, module.first))
+                    {
+                        if(!boost::filesystem::exists(output))
+                        {
+                            return true;
+                        }
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        // outputs of the changed modules only, those of up to date modules
+        // (reused from a ModuleCache, or parsed for an importer) are current.
+        // @return what was written for each module
+        std::map<boost::filesystem::path, OutputCache::Artifacts> emit(const Command& command, const ModuleMap& modules)
+        {
+            std::map<boost::filesystem::path, OutputCache::Artifacts> result;
+
+            for(const auto& module : modules)
+            {
+                if(!module.second->changed())
+                {
+                    continue;
+                }
+
+                auto& artifacts = result[module.first];
+
+                if(!command.EmitAst.empty())
+                {
+                    const auto buffer = ast::binary::serialize(module.second->ast());
+                    artifacts.emplace_back(astName(module.first), std::string(buffer.data(), buffer.size()));
+                }
+
+                if(!command.EmitCpp.empty())
+                {
+                    artifacts.emplace_back(codegen::cppHeaderName(module.first), codegen::generateCpp(module.second->ast()));
+                }
+
+                for(const auto& artifact : artifacts)
+                {
+                    writeIfChanged(outputPath(command, artifact.first), artifact.second);
+                }
+            }
+
+            return result;
+        }
+
+        void writeDepfile(const Command& command, const ImportGraph& graph, const boost::filesystem::path& importRoot)
+        {
+            std::string depfile;
+
+            for(const auto& module : graph)
+            {
+                std::vector<boost::filesystem::path> dependencies;
+                for(const auto& dependency : transitiveImports(graph, module.first))
+                {
+                    dependencies.push_back(dependency.is_absolute() ? dependency : importRoot / dependency);
+                }
+
+                depfile += makeRule(outputs(command, module.first), dependencies);
+            }
+
+            writeIfChanged(command.Depfile, depfile);
+        }
+    }
+
+    bool runCommand(Driver& driver, const Command& command, std::ostream& errors, BuildReport* report)
+    {
+        if(command.Files.empty() || (!command.Depfile.empty() && !hasOutputs(command)))
+        {
+            errors << "Nothing to compile, or a depfile requested without outputs\n";
+            return false;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        try
+        {
+            std::unique_ptr<OutputCache> cache;
+            if(!driver.options().OutputCache.empty() && hasOutputs(command))
+            {
+                cache.reset(new OutputCache(driver.options().OutputCache, driver.options().OutputCacheSize));
+            }
+
+            // files whose outputs (and those of everything they import) are
+            // all cached are not compiled at all
+            ImportGraph graph;
+            std::vector<boost::filesystem::path> files;
+
+            for(const auto& file : command.Files)
+            {
+                if(!cache || !restore(*cache, driver, command, file, graph))
+                {
+                    files.push_back(file);
+                }
+            }
+
+            ModuleMap modules;
+            if(!files.empty())
+            {
+                modules = driver.compile(files);
+
+                if(reportErrors(modules, errors))
+                {
+                    return false;
+                }
+
+                if(outputsMissing(command, modules))
+                {
+                    auto options = driver.options();
+                    options.DependencyDatabase.clear();
+                    options.CacheSize = 0;
+
+                    modules = Driver(options).compile(files);
+
+                    if(reportErrors(modules, errors))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            const auto compiled = importGraph(modules);
+            for(const auto& module : compiled)
+            {
+                graph[module.first] = module.second;
+            }
+
+            PhaseStats codegen;
+
+            {
+                PhaseTimer timer(codegen);
+
+                if(hasOutputs(command))
+                {
+                    const auto outputs = emit(command, modules);
+
+                    if(cache)
+                    {
+                        // the cache only saves time, a full or read only
+                        // cache directory must not fail the build
+                        try
+                        {
+                            store(*cache, command, modules, outputs);
+                            cache->trim();
+                        }
+                        catch(const std::exception&)
+                        {
+                        }
+                    }
+                }
+
+                if(!command.Depfile.empty())
+                {
+                    writeDepfile(command, graph, driver.importRoot());
+                }
+            }
+
+            if(report)
+            {
+                for(const auto& module : modules)
+                {
+                    report->add(*module.second);
+                }
+
+                report->phase(Phase::Codegen) += codegen;
+                report->elapsed(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+            }
+
+            return true;
+        }
+        catch(const std::exception& e)
+        {
+            errors << e.what() << "\n";
+            return false;
+        }
+    }
+}}
@@ -0,0 +1,327 @@
+#include <swizzle/driver/CompileServer.hpp>
+
+#include <boost/asio.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include <condition_variable>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace swizzle { namespace driver {
+
+#if defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+
+    namespace {
+
+        using Protocol = boost::asio::local::stream_protocol;
+
+        // false if @socket closes, or a complete request does not arrive before
+        // @timeout. @io runs only this connection's operations.
+        bool readRequest(boost::asio::io_context& io, Protocol::socket& socket, const std::chrono::milliseconds& timeout, std::string& request)
+        {
+            boost::asio::streambuf buffer;
+            boost::asio::steady_timer deadline(io, timeout);
+            boost::system::error_code result = boost::asio::error::timed_out;
+
+            boost::asio::async_read_until(socket, buffer, "\n\n", [&](const boost::system::error_code& ec, std::size_t) {
+                result = ec;
+                deadline.cancel();
+            });
+
+            deadline.async_wait([&](const boost::system::error_code& ec) {
+                if(!ec)
+                {
+                    socket.cancel();
+                }
+            });
+
+            io.run();
+
+            if(result)
+            {
+                return false;
+            }
+
+            request.assign(boost::asio::buffers_begin(buffer.data()), boost::asio::buffers_end(buffer.data()));
+            return true;
+        }
+
+        bool connected(const boost::filesystem::path& socket)
+        {
+            boost::asio::io_context io;
+            Protocol::socket client(io);
+
+            boost::system::error_code ec;
+            client.connect(Protocol::endpoint(socket.string()), ec);
+
+            return !ec;
+        }
+
+        std::string roundTrip(const boost::filesystem::path& socket, const std::string& request)
+        {
+            boost::asio::io_context io;
+            Protocol::socket client(io);
+            client.connect(Protocol::endpoint(socket.string()));
+
+            boost::asio::write(client, boost::asio::buffer(request));
+
+            boost::asio::streambuf buffer;
+            boost::system::error_code ec;
+            boost::asio::read(client, buffer, ec);
+
+            if(ec && (ec != boost::asio::error::eof))
+            {
+                throw boost::system::system_error(ec);
+            }
+
+            return std::string(boost::asio::buffers_begin(buffer.data()), boost::asio::buffers_end(buffer.data()));
+        }
+    }
+
+    // Accepts on io_ (the thread in run()), each connection is then served on
+    // its own thread with its own io_context, so a slow or stalled client only
+    // holds up itself. Builds take turns on the one Driver.
+    struct CompileServer::Listener
+    {
+        Listener(Driver& driver, const boost::filesystem::path& socket, const std::chrono::milliseconds& requestTimeout)
+            : driver(driver)
+            , requestTimeout(requestTimeout)
+            , acceptor(io, Protocol::endpoint(socket.string()))
+        {
+        }
+
+        void run()
+        {
+            accept();
+            io.run();
+
+            // shut down, let the connections still being served finish
+            std::unique_lock<std::mutex> lock(mutex);
+            idle.wait(lock, [this]{ return active == 0; });
+        }
+
+        void accept()
+        {
+            auto context = std::make_shared<boost::asio::io_context>();
+            auto connection = std::make_shared<Protocol::socket>(*context);
+
+            acceptor.async_accept(*connection, [this, context, connection](const boost::system::error_code& ec) {
+                if(ec)
+                {
+                    // the acceptor was closed by a shutdown request
+                    return;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++active;
+                }
+
+                std::thread([this, context, connection]{
+
+                    serve(*context, *connection);
+
+                    std::lock_guard<std::mutex> lock(mutex);
+                    --active;
+                    idle.notify_all();
+
+                }).detach();
+
+                accept();
+            });
+        }
+
+        void serve(boost::asio::io_context& context, Protocol::socket& connection)
+        {
+            try
+            {
+                std::string text;
+                if(!readRequest(context, connection, requestTimeout, text))
+                {
+                    return;
+                }
+
+                std::istringstream request(text);
+                std::string line;
+                std::getline(request, line);
+
+                if(line == "shutdown")
+                {
+                    boost::asio::post(io, [this]{ acceptor.close(); });
+                    boost::asio::write(connection, boost::asio::buffer(std::string("status 0\n")));
+                    return;
+                }
+
+                Command command;
+                bool valid = (line == "compile");
+
+                while(valid && std::getline(request, line) && !line.empty())
+                {
+                    const auto space = line.find(' ');
+                    const auto keyword = line.substr(0, space);
+                    const auto value = (space == std::string::npos) ? std::string() : line.substr(space + 1);
+
+                    if(keyword == "file") { command.Files.emplace_back(value); }
+                    else if(keyword == "emit-ast") { command.EmitAst = value; }
+                    else if(keyword == "emit-cpp") { command.EmitCpp = value; }
+                    else if(keyword == "depfile") { command.Depfile = value; }
+                    else { valid = false; }
+                }
+
+                std::ostringstream errors;
+                bool success = false;
+
+                if(valid)
+                {
+                    std::lock_guard<std::mutex> lock(build);
+                    success = runCommand(driver, command, errors);
+                }
+                else
+                {
+                    errors << "Malformed request\n";
+                }
+
+                std::ostringstream response;
+                std::istringstream lines(errors.str());
+                while(std::getline(lines, line))
+                {
+                    response << "error " << line << "\n";
+                }
+
+                response << "status " << (success ? 0 : 1) << "\n";
+                boost::asio::write(connection, boost::asio::buffer(response.str()));
+            }
+            catch(const boost::system::system_error&)
+            {
+                // the client went away, nothing to report it to
+            }
+        }
+
+        Driver& driver;
+        const std::chrono::milliseconds requestTimeout;
+
+        boost::asio::io_context io;
+        Protocol::acceptor acceptor;
+
+        std::mutex build;                   // one runCommand() at a time on driver
+        std::mutex mutex;                   // guards active
+        std::condition_variable idle;
+        std::size_t active = 0;             // connections being served
+    };
+
+    CompileServer::CompileServer(const DriverOptions& options, const boost::filesystem::path& socket, const std::chrono::milliseconds& requestTimeout)
+        : driver_(options)
+        , socket_(socket)
+    {
+        if(connected(socket_))
+        {
+            throw std::runtime_error("A compile server is already listening on " + socket_.string());
+        }
+
+        // left behind by a server that did not shut down cleanly
+        boost::filesystem::remove(socket_);
+        listener_.reset(new Listener(driver_, socket_, requestTimeout));
+    }
+
+    CompileServer::~CompileServer()
+    {
+        listener_.reset();
+
+        boost::system::error_code ec;
+        boost::filesystem::remove(socket_, ec);
+    }
+
+    void CompileServer::run()
+    {
+        listener_->run();
+    }
+
+    bool sendCommand(const boost::filesystem::path& socket, const Command& command, std::ostream& errors)
+    {
+        std::ostringstream request;
+        request << "compile\n";
+
+        for(const auto& file : command.Files)
+        {
+            request << "file " << file.string() << "\n";
+        }
+
+        if(!command.EmitAst.empty())
+        {
+            request << "emit-ast " << command.EmitAst.string() << "\n";
+        }
+
+        if(!command.EmitCpp.empty())
+        {
+            request << "emit-cpp " << command.EmitCpp.string() << "\n";
+        }
+
+        if(!command.Depfile.empty())
+        {
+            request << "depfile " << command.Depfile.string() << "\n";
+        }
+
+        request << "\n";
+
+        std::istringstream response(roundTrip(socket, request.str()));
+        std::string line;
+
+        while(std::getline(response, line))
+        {
+            if(line.compare(0, 6, "error ") == 0)
+            {
+                errors << line.substr(6) << "\n";
+            }
+            else if(line.compare(0, 7, "status ") == 0)
+            {
+                return line.substr(7) == "0";
+            }
+        }
+
+        errors << "Compile server closed the connection without a status\n";
+        return false;
+    }
+
+    void sendShutdown(const boost::filesystem::path& socket)
+    {
+        roundTrip(socket, "shutdown\n\n");
+    }
+
+#else
+
+    struct CompileServer::Listener
+    {
+    };
+
+    CompileServer::CompileServer(const DriverOptions& options, const boost::filesystem::path& socket, const std::chrono::milliseconds&)
+        : driver_(options)
+        , socket_(socket)
+    {
+        throw std::runtime_error("The compile server requires Unix domain sockets");
+    }
+
+    CompileServer::~CompileServer()
+    {
+    }
+
+    void CompileServer::run()
+    {
+    }
+
+    bool sendCommand(const boost::filesystem::path&, const Command&, std::ostream& errors)
+    {
+        errors << "The compile server requires Unix domain sockets\n";
+        return false;
+    }
+
+    void sendShutdown(const boost::filesystem::path&)
+    {
+    }
+
+#endif
+}}
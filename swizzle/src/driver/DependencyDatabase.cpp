@@ -0,0 +1,117 @@
+#include <swizzle/driver/DependencyDatabase.hpp>
+
+#include <swizzle/driver/WriteIfChanged.hpp>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include <ios>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace swizzle { namespace driver {
+
+    namespace {
+
+        static const char* const Signature = "swizzle-deps 1";
+
+        // split "keyword value" at the first space
+        bool split(const std::string& line, std::string& keyword, std::string& value)
+        {
+            const auto space = line.find(' ');
+            if(space == std::string::npos)
+            {
+                keyword = line;
+                value.clear();
+                return false;
+            }
+
+            keyword = line.substr(0, space);
+            value = line.substr(space + 1);
+            return true;
+        }
+    }
+
+    void DependencyDatabase::load(const boost::filesystem::path& file)
+    {
+        records_.clear();
+
+        boost::filesystem::ifstream is(file);
+        std::string line;
+
+        if(!is || !std::getline(is, line) || (line != Signature))
+        {
+            return;
+        }
+
+        std::map<boost::filesystem::path, DependencyRecord> records;
+        boost::filesystem::path module;
+        DependencyRecord record;
+
+        std::string keyword;
+        std::string value;
+
+        try
+        {
+            while(std::getline(is, line))
+            {
+                split(line, keyword, value);
+
+                if(keyword == "module") { module = value; record = DependencyRecord(); }
+                else if(keyword == "content") { record.ContentHash = std::stoull(value, nullptr, 16); }
+                else if(keyword == "interface") { record.InterfaceHash = std::stoull(value, nullptr, 16); }
+                else if(keyword == "import") { record.Imports.emplace_back(value); }
+                else if((keyword == "end") && !module.empty()) { records[module] = record; module.clear(); }
+                else
+                {
+                    return;
+                }
+            }
+        }
+        catch(const std::logic_error&)
+        {
+            // std::stoull on a corrupt hash, treat like a missing database
+            return;
+        }
+
+        records_.swap(records);
+    }
+
+    void DependencyDatabase::save(const boost::filesystem::path& file) const
+    {
+        std::ostringstream os;
+        os << Signature << "\n" << std::hex;
+
+        for(const auto& entry : records_)
+        {
+            os << "module " << entry.first.generic_string() << "\n";
+            os << "content " << entry.second.ContentHash << "\n";
+            os << "interface " << entry.second.InterfaceHash << "\n";
+
+            for(const auto& import : entry.second.Imports)
+            {
+                os << "import " << import.generic_string() << "\n";
+            }
+
+            os << "end\n";
+        }
+
+        writeIfChanged(file, os.str());
+    }
+
+    const DependencyRecord* DependencyDatabase::find(const boost::filesystem::path& module) const
+    {
+        const auto iter = records_.find(module);
+        return iter == records_.end() ? nullptr : &iter->second;
+    }
+
+    void DependencyDatabase::update(const boost::filesystem::path& module, const DependencyRecord& record)
+    {
+        records_[module] = record;
+    }
+
+    void DependencyDatabase::erase(const boost::filesystem::path& module)
+    {
+        records_.erase(module);
+    }
+}}
@@ -0,0 +1,99 @@
+#include <swizzle/driver/Depfile.hpp>
+
+#include <set>
+
+namespace swizzle { namespace driver {
+
+    namespace {
+
+        void append(std::string& rule, const boost::filesystem::path& path)
+        {
+            for(const auto c : path.generic_string())
+            {
+                switch(c)
+                {
+                case ' ': rule += "\\ "; break;
+                case '#': rule += "\\#"; break;
+                case '$': rule += "$$"; break;
+                default: rule += c; break;
+                }
+            }
+        }
+    }
+
+    ImportGraph importGraph(const ModuleMap& modules)
+    {
+        ImportGraph graph;
+        for(const auto& module : modules)
+        {
+            auto& imports = graph[module.first];
+            for(const auto& import : module.second->imports())
+            {
+                imports.push_back(import.lexically_normal());
+            }
+        }
+
+        return graph;
+    }
+
+    std::vector<boost::filesystem::path> transitiveImports(const ModuleMap& modules, const boost::filesystem::path& module)
+    {
+        return transitiveImports(importGraph(modules), module);
+    }
+
+    std::vector<boost::filesystem::path> transitiveImports(const ImportGraph& graph, const boost::filesystem::path& module)
+    {
+        std::vector<boost::filesystem::path> result;
+        std::set<boost::filesystem::path> seen;
+        std::vector<boost::filesystem::path> stack { module };
+
+        while(!stack.empty())
+        {
+            const auto path = stack.back();
+            stack.pop_back();
+
+            if(!seen.insert(path).second)
+            {
+                continue;
+            }
+
+            result.push_back(path);
+
+            const auto iter = graph.find(path);
+            if(iter == graph.end())
+            {
+                continue;
+            }
+
+            stack.insert(stack.end(), iter->second.begin(), iter->second.end());
+        }
+
+        return result;
+    }
+
+    std::string makeRule(const std::vector<boost::filesystem::path>& targets, const std::vector<boost::filesystem::path>& dependencies)
+    {
+        std::string rule;
+
+        for(const auto& target : targets)
+        {
+            if(!rule.empty())
+            {
+                rule += ' ';
+            }
+
+            append(rule, target);
+        }
+
+        rule += ':';
+
+        for(const auto& dependency : dependencies)
+        {
+            rule += " \\\n  ";
+            append(rule, dependency);
+        }
+
+        rule += '\n';
+        return rule;
+    }
+}}
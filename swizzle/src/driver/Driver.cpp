@@ -0,0 +1,424 @@
+#include <swizzle/driver/Driver.hpp>
+
+#include <swizzle/driver/DependencyDatabase.hpp>
+#include <swizzle/driver/ThreadPool.hpp>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+
+namespace swizzle { namespace driver {
+
+    namespace {
+
+        // Import graph bookkeeping for one compile(). The mutex guards the
+        // graph only (entries, pending counts, dependents), modules are
+        // loaded and parsed outside of it. Every task is posted while the
+        // mutex is held so @outstanding_ reaching zero means no more work.
+        //
+        // A module is decided once all of its imports are decided: it is
+        // either parsed, or found up to date (unchanged content, no imported
+        // interface changed) and skipped. A module that must be parsed but
+        // imports a skipped one demands it, the skipped module is then parsed
+        // too (without being marked changed) and the demanding module waits
+        // for it.
+        //
+        // A module found in the ModuleCache with the same content is reused
+        // instead of the freshly loaded one, unless the interface of one of
+        // its imports no longer matches what it was parsed against.
+        class Build
+        {
+        public:
+            Build(ThreadPool& pool, const boost::filesystem::path& importRoot, const DependencyDatabase& database, const ModuleCache& cache)
+                : pool_(pool)
+                , importRoot_(importRoot)
+                , database_(database)
+                , cache_(cache)
+                , outstanding_(0)
+            {
+            }
+
+            void add(const boost::filesystem::path& path)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                entry(path);
+            }
+
+            void wait()
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                idle_.wait(lock, [this]{ return outstanding_ == 0; });
+
+                // anything still waiting on imports is part of (or depends on) a cycle
+                for(auto& e : entries_)
+                {
+                    if(!e.second.done)
+                    {
+                        unuse(e.second);
+                        e.second.module->fail("Import cycle: " + e.first.string() + " was never parsed because its imports could not be completed");
+                        e.second.done = true;
+                    }
+                }
+            }
+
+            ModuleMap modules() const
+            {
+                ModuleMap result;
+                for(const auto& e : entries_)
+                {
+                    result.emplace(e.first, e.second.module);
+                }
+
+                return result;
+            }
+
+        private:
+            struct Entry
+            {
+                std::shared_ptr<Module> module;
+                std::shared_ptr<Module> loaded;     // loaded this build when module is reused from the cache
+                bool reused = false;
+
+                std::vector<Entry*> imports;
+                std::vector<Entry*> dependents;     // waiting for this entry to be decided
+                std::vector<Entry*> demanders;      // waiting for this entry to be parsed
+                std::size_t pending = 0;
+                bool done = false;                  // decided: parsed, skipped or failed
+                bool required = false;              // must be parsed even if up to date
+
+                // snapshot of the module taken when it completes, a skipped
+                // module may be parsed on demand while importers read these
+                bool parsed = false;
+                bool failed = false;
+                bool interfaceChanged = false;
+                std::uint64_t interfaceHash = 0;
+            };
+
+            // requires mutex_, schedules the load of modules seen for the first time
+            Entry& entry(const boost::filesystem::path& path)
+            {
+                auto iter = entries_.find(path);
+                if(iter != entries_.end())
+                {
+                    return iter->second;
+                }
+
+                auto& e = entries_[path];
+                e.module = std::make_shared<Module>(path, importRoot_);
+                post(e, &Build::load);
+
+                return e;
+            }
+
+            // requires mutex_
+            void post(Entry& e, void (Build::*step)(Entry&))
+            {
+                ++outstanding_;
+                pool_.post([this, &e, step]{
+
+                    (this->*step)(e);
+
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if(--outstanding_ == 0)
+                    {
+                        idle_.notify_all();
+                    }
+                });
+            }
+
+            void load(Entry& e)
+            {
+                const auto cached = cache_.find(e.module->path());
+                const auto cachedRecord = cached ? cached->record() : DependencyRecord();
+
+                try
+                {
+                    e.module->load(cached ? &cachedRecord : database_.find(e.module->path()));
+                }
+                catch(const std::exception& ex)
+                {
+                    e.module->fail(ex.what());
+                    complete(e);
+                    return;
+                }
+
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                if(cached && !e.module->contentChanged())
+                {
+                    e.loaded = e.module;
+                    e.module = cached;
+                    e.reused = true;
+                }
+                for(const auto& import : e.module->imports())
+                {
+                    auto& dependency = entry(import.lexically_normal());
+                    e.imports.push_back(&dependency);
+
+                    if(!dependency.done)
+                    {
+                        ++e.pending;
+                        dependency.dependents.push_back(&e);
+                    }
+                }
+
+                if(e.pending == 0)
+                {
+                    post(e, &Build::parse);
+                }
+            }
+
+            // imports are decided (the tasks that finished them released mutex_
+            // before this task was posted) so their ASTs are read without locking
+            void parse(Entry& e)
+            {
+                bool changed = e.module->contentChanged();
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+
+                    for(const auto dependency : e.imports)
+                    {
+                        if(dependency->failed)
+                        {
+                            unuse(e);
+                            e.module->fail("Import failed: " + dependency->module->path().string());
+                            completeLocked(e);
+                            return;
+                        }
+
+                        changed = changed || dependency->interfaceChanged;
+                    }
+
+                    if(e.reused)
+                    {
+                        if(importsMatch(e))
+                        {
+                            e.module->changed(false);
+                            completeLocked(e);
+                            return;
+                        }
+
+                        unuse(e);
+                    }
+
+                    e.module->changed(changed);
+
+                    if(!changed && !e.required)
+                    {
+                        completeLocked(e);
+                        return;
+                    }
+
+                    if(demand(e))
+                    {
+                        return;
+                    }
+                }
+
+                std::vector<std::shared_ptr<const Module>> imports;
+                imports.reserve(e.imports.size());
+
+                for(const auto dependency : e.imports)
+                {
+                    imports.push_back(dependency->module);
+                }
+
+                try
+                {
+                    e.module->parse(imports);
+                }
+                catch(const std::exception& ex)
+                {
+                    e.module->fail(ex.what());
+                }
+
+                complete(e);
+            }
+
+            // requires mutex_, a reused module is only valid if its imports
+            // still export what it was parsed against
+            bool importsMatch(const Entry& e) const
+            {
+                const auto& interfaces = e.module->importedInterfaces();
+                if(interfaces.size() != e.imports.size())
+                {
+                    return false;
+                }
+
+                for(std::size_t i = 0, end = interfaces.size(); i < end; ++i)
+                {
+                    if(e.imports[i]->interfaceHash != interfaces[i])
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            // requires mutex_, go back to the module loaded this build, a
+            // cached module is never modified
+            void unuse(Entry& e)
+            {
+                if(e.reused)
+                {
+                    e.module = e.loaded;
+                    e.reused = false;
+                }
+            }
+
+            // requires mutex_, true if @e has to wait for skipped imports to be parsed
+            bool demand(Entry& e)
+            {
+                for(const auto dependency : e.imports)
+                {
+                    if(dependency->parsed)
+                    {
+                        continue;
+                    }
+
+                    ++e.pending;
+                    dependency->demanders.push_back(&e);
+
+                    if(!dependency->required)
+                    {
+                        dependency->required = true;
+
+                        if(dependency->done)
+                        {
+                            post(*dependency, &Build::parse);
+                        }
+                    }
+                }
+
+                return e.pending != 0;
+            }
+
+            void complete(Entry& e)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                completeLocked(e);
+            }
+
+            void completeLocked(Entry& e)
+            {
+                e.parsed = e.module->parsed();
+                e.failed = e.module->failed();
+                e.interfaceChanged = !e.failed && !e.reused && e.module->interfaceChanged();
+                e.interfaceHash = e.module->interfaceHash();
+
+                if(!e.done)
+                {
+                    e.done = true;
+
+                    for(const auto dependent : e.dependents)
+                    {
+                        if(--dependent->pending == 0)
+                        {
+                            post(*dependent, &Build::parse);
+                        }
+                    }
+                }
+
+                if(e.parsed || e.failed)
+                {
+                    for(const auto demander : e.demanders)
+                    {
+                        if(--demander->pending == 0)
+                        {
+                            post(*demander, &Build::parse);
+                        }
+                    }
+
+                    e.demanders.clear();
+                }
+            }
+
+        private:
+            ThreadPool& pool_;
+            const boost::filesystem::path importRoot_;
+            const DependencyDatabase& database_;
+            const ModuleCache& cache_;
+
+            std::mutex mutex_;
+            std::condition_variable idle_;
+            std::size_t outstanding_;
+
+            std::map<boost::filesystem::path, Entry> entries_;  // node based, Entry addresses are stable
+        };
+    }
+
+    Driver::Driver(const DriverOptions& options)
+        : options_(options)
+        , importRoot_(boost::filesystem::weakly_canonical(boost::filesystem::absolute(options.ImportRoot)))
+        , cache_(options.CacheSize)
+    {
+    }
+
+    boost::filesystem::path Driver::key(const boost::filesystem::path& file) const
+    {
+        const auto absolute = boost::filesystem::weakly_canonical(boost::filesystem::absolute(file));
+        const auto relative = absolute.lexically_relative(importRoot_);
+
+        return relative.empty() ? absolute : relative;
+    }
+
+    ModuleMap Driver::compile(const std::vector<boost::filesystem::path>& files)
+    {
+        DependencyDatabase database;
+        if(!options_.DependencyDatabase.empty())
+        {
+            database.load(options_.DependencyDatabase);
+        }
+
+        ModuleMap modules;
+
+        {
+            ThreadPool pool(options_.Threads);
+            Build build(pool, importRoot_, database, cache_);
+
+            for(const auto& file : files)
+            {
+                build.add(key(file));
+            }
+
+            build.wait();
+            modules = build.modules();
+        }
+
+        for(const auto& module : modules)
+        {
+            if(module.second->failed())
+            {
+                cache_.erase(module.first);
+            }
+            else if(module.second->parsed())
+            {
+                cache_.insert(module.first, module.second);
+            }
+        }
+
+        if(!options_.DependencyDatabase.empty())
+        {
+            for(const auto& module : modules)
+            {
+                if(module.second->failed())
+                {
+                    database.erase(module.first);
+                }
+                else if(module.second->parsed())
+                {
+                    database.update(module.first, module.second->record());
+                }
+            }
+
+            database.save(options_.DependencyDatabase);
+        }
+
+        return modules;
+    }
+}}
@@ -0,0 +1,258 @@
+#include <swizzle/driver/FileWatcher.hpp>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <string>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace swizzle { namespace driver {
+
+#if defined(__linux__)
+
+    namespace {
+
+        static const std::uint32_t FileEvents = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF;
+    }
+
+    FileWatcher::FileWatcher(const boost::filesystem::path& directory, std::ostream& log)
+        : fd_(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+        , log_(log)
+        , root_(directory)
+    {
+        if(fd_ < 0)
+        {
+            throw std::runtime_error("Unable to initialize inotify");
+        }
+
+        try
+        {
+            add(directory);
+
+            for(boost::filesystem::recursive_directory_iterator iter(directory), end; iter != end; ++iter)
+            {
+                if(boost::filesystem::is_directory(iter->status()))
+                {
+                    addBelow(iter->path(), nullptr);
+                }
+            }
+        }
+        catch(...)
+        {
+            ::close(fd_);
+            throw;
+        }
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+        ::close(fd_);
+    }
+
+    void FileWatcher::add(const boost::filesystem::path& directory)
+    {
+        const auto wd = inotify_add_watch(fd_, directory.c_str(), FileEvents | IN_ONLYDIR);
+        if(wd < 0)
+        {
+            throw std::runtime_error("Unable to watch directory: " + directory.string());
+        }
+
+        directories_[wd] = directory;
+    }
+
+    void FileWatcher::addBelow(const boost::filesystem::path& directory, std::vector<boost::filesystem::path>* changed)
+    {
+        // it may be gone or unreadable already, the rest is still watched
+        try
+        {
+            add(directory);
+
+            if(!changed)
+            {
+                return;
+            }
+
+            // files may have appeared before the watch was added
+            for(boost::filesystem::directory_iterator iter(directory), end; iter != end; ++iter)
+            {
+                if(iter->path().extension() == ".swizzle")
+                {
+                    changed->push_back(iter->path());
+                }
+            }
+        }
+        catch(const std::exception& e)
+        {
+            log_ << "Not watching " << directory.string() << ": " << e.what() << std::endl;
+        }
+    }
+
+    void FileWatcher::rescan(std::vector<boost::filesystem::path>& changed)
+    {
+        try
+        {
+            // adding a watch again returns the descriptor it already has
+            add(root_);
+
+            for(boost::filesystem::recursive_directory_iterator iter(root_), end; iter != end; ++iter)
+            {
+                if(boost::filesystem::is_directory(iter->status()))
+                {
+                    addBelow(iter->path(), nullptr);
+                }
+                else if(iter->path().extension() == ".swizzle")
+                {
+                    changed.push_back(iter->path());
+                }
+            }
+        }
+        catch(const std::exception& e)
+        {
+            log_ << "Rescan of " << root_.string() << " failed: " << e.what() << std::endl;
+        }
+    }
+
+    bool FileWatcher::read(std::chrono::milliseconds timeout, std::vector<boost::filesystem::path>& changed)
+    {
+        pollfd pfd { fd_, POLLIN, 0 };
+        if(::poll(&pfd, 1, static_cast<int>(timeout.count())) <= 0)
+        {
+            return false;
+        }
+
+        alignas(inotify_event) char buffer[16 * 1024];
+        bool lost = false;
+
+        for(;;)
+        {
+            const auto length = ::read(fd_, buffer, sizeof(buffer));
+            if(length <= 0)
+            {
+                break;
+            }
+
+            for(auto position = buffer; position < buffer + length; )
+            {
+                const auto& event = *reinterpret_cast<const inotify_event*>(position);
+                position += sizeof(inotify_event) + event.len;
+
+                // the queue overflowed and dropped events, or a watched
+                // directory went away, what changed is no longer known
+                if(event.mask & (IN_Q_OVERFLOW | IN_IGNORED | IN_DELETE_SELF))
+                {
+                    if(event.mask & IN_IGNORED)
+                    {
+                        directories_.erase(event.wd);
+                    }
+
+                    lost = true;
+                    continue;
+                }
+
+                const auto directory = directories_.find(event.wd);
+                if((directory == directories_.end()) || (event.len == 0))
+                {
+                    continue;
+                }
+
+                const auto path = directory->second / event.name;
+
+                if(event.mask & IN_ISDIR)
+                {
+                    if(event.mask & (IN_CREATE | IN_MOVED_TO))
+                    {
+                        addBelow(path, &changed);
+                    }
+
+                    continue;
+                }
+
+                if(path.extension() == ".swizzle")
+                {
+                    changed.push_back(path);
+                }
+            }
+        }
+
+        if(lost)
+        {
+            rescan(changed);
+        }
+
+        return true;
+    }
+
+    std::vector<boost::filesystem::path> FileWatcher::wait(std::chrono::milliseconds timeout, std::chrono::milliseconds settle)
+    {
+        std::vector<boost::filesystem::path> changed;
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while(changed.empty())
+        {
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            if(remaining.count() <= 0)
+            {
+                return changed;
+            }
+
+            // events for other files wake us up without adding anything
+            read(remaining, changed);
+        }
+
+        // coalesce, editors often write a file several times per save
+        while(read(settle, changed))
+        {
+        }
+
+        std::sort(changed.begin(), changed.end());
+        changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+
+        return changed;
+    }
+
+#else
+
+    FileWatcher::FileWatcher(const boost::filesystem::path& directory, std::ostream& log)
+        : fd_(-1)
+        , log_(log)
+        , root_(directory)
+    {
+        throw std::runtime_error("Watching files requires inotify");
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+    }
+
+    void FileWatcher::add(const boost::filesystem::path&)
+    {
+    }
+
+    void FileWatcher::addBelow(const boost::filesystem::path&, std::vector<boost::filesystem::path>*)
+    {
+    }
+
+    void FileWatcher::rescan(std::vector<boost::filesystem::path>&)
+    {
+    }
+
+    bool FileWatcher::read(std::chrono::milliseconds, std::vector<boost::filesystem::path>&)
+    {
+        return false;
+    }
+
+    std::vector<boost::filesystem::path> FileWatcher::wait(std::chrono::milliseconds, std::chrono::milliseconds)
+    {
+        return std::vector<boost::filesystem::path>();
+    }
+
+#endif
+}}
@@ -0,0 +1,26 @@
+#include <swizzle/driver/Hash.hpp>
+
+namespace swizzle { namespace driver {
+
+    Hash& Hash::update(const boost::string_view& bytes)
+    {
+        for(const auto c : bytes)
+        {
+            value_ ^= static_cast<unsigned char>(c);
+            value_ *= 1099511628211ULL;
+        }
+
+        return *this;
+    }
+
+    Hash& Hash::update(std::uint64_t value)
+    {
+        for(int i = 0; i < 8; ++i)
+        {
+            value_ ^= static_cast<unsigned char>(value >> (i * 8));
+            value_ *= 1099511628211ULL;
+        }
+
+        return *this;
+    }
+}}
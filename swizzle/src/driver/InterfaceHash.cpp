@@ -0,0 +1,186 @@
+#include <swizzle/driver/InterfaceHash.hpp>
+
+#include <swizzle/driver/Hash.hpp>
+
+#include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/NodeKind.hpp>
+#include <swizzle/ast/nodes/Attribute.hpp>
+#include <swizzle/ast/nodes/AttributeBlock.hpp>
+#include <swizzle/ast/nodes/Bitfield.hpp>
+#include <swizzle/ast/nodes/BitfieldField.hpp>
+#include <swizzle/ast/nodes/CharLiteral.hpp>
+#include <swizzle/ast/nodes/DefaultStringValue.hpp>
+#include <swizzle/ast/nodes/DefaultValue.hpp>
+#include <swizzle/ast/nodes/Enum.hpp>
+#include <swizzle/ast/nodes/EnumField.hpp>
+#include <swizzle/ast/nodes/FieldLabel.hpp>
+#include <swizzle/ast/nodes/HexLiteral.hpp>
+#include <swizzle/ast/nodes/NumericLiteral.hpp>
+#include <swizzle/ast/nodes/StringLiteral.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/TypeAlias.hpp>
+#include <swizzle/ast/nodes/VariableBlock.hpp>
+#include <swizzle/ast/nodes/VariableBlockCase.hpp>
+#include <swizzle/lexer/TokenInfo.hpp>
+
+namespace swizzle { namespace driver {
+
+    namespace {
+
+        using namespace ast;
+
+        void update(Hash& hash, const boost::string_view& text)
+        {
+            // length prefix keeps ("ab", "c") and ("a", "bc") apart
+            hash.update(text.length()).update(text);
+        }
+
+        void update(Hash& hash, const lexer::TokenInfo& info)
+        {
+            update(hash, info.token().value());
+        }
+
+        bool isComment(const Node& node)
+        {
+            const auto kind = node.kind();
+            return (kind == NodeKind::Comment) || (kind == NodeKind::MultilineComment);
+        }
+
+        void hashNode(Hash& hash, const Node& node)
+        {
+            switch(node.kind())
+            {
+            case NodeKind::Attribute: update(hash, static_cast<const nodes::Attribute&>(node).info()); break;
+            case NodeKind::AttributeBlock: update(hash, static_cast<const nodes::AttributeBlock&>(node).info()); break;
+            case NodeKind::CharLiteral: update(hash, static_cast<const nodes::CharLiteral&>(node).info()); break;
+            case NodeKind::FieldLabel: update(hash, static_cast<const nodes::FieldLabel&>(node).info()); break;
+            case NodeKind::HexLiteral: update(hash, static_cast<const nodes::HexLiteral&>(node).info()); break;
+            case NodeKind::NumericLiteral: update(hash, static_cast<const nodes::NumericLiteral&>(node).info()); break;
+            case NodeKind::StringLiteral: update(hash, static_cast<const nodes::StringLiteral&>(node).info()); break;
+            case NodeKind::VariableBlock: update(hash, static_cast<const nodes::VariableBlock&>(node).variableOnField()); break;
+
+            case NodeKind::Struct:
+                update(hash, static_cast<const nodes::Struct&>(node).name());
+                break;
+
+            case NodeKind::Enum:
+            {
+                const auto& e = static_cast<const nodes::Enum&>(node);
+                update(hash, e.name());
+                update(hash, e.underlying());
+                break;
+            }
+
+            case NodeKind::EnumField:
+            {
+                const auto& field = static_cast<const nodes::EnumField&>(node);
+                update(hash, field.name());
+                update(hash, field.valueInfo());
+                break;
+            }
+
+            case NodeKind::Bitfield:
+            {
+                const auto& bitfield = static_cast<const nodes::Bitfield&>(node);
+                update(hash, bitfield.name());
+                update(hash, bitfield.underlying());
+                break;
+            }
+
+            case NodeKind::BitfieldField:
+            {
+                const auto& field = static_cast<const nodes::BitfieldField&>(node);
+                update(hash, field.name());
+                hash.update(field.beginBit()).update(field.endBit());
+                break;
+            }
+
+            case NodeKind::DefaultValue:
+                update(hash, static_cast<const nodes::DefaultValue&>(node).value());
+                break;
+
+            case NodeKind::DefaultStringValue:
+                update(hash, static_cast<const nodes::DefaultStringValue&>(node).value());
+                break;
+
+            case NodeKind::StructField:
+            {
+                const auto& field = static_cast<const nodes::StructField&>(node);
+                update(hash, field.name());
+                update(hash, field.type());
+
+                hash.update(field.isConst()).update(field.isArray()).update(field.isVector());
+                hash.update(static_cast<std::uint64_t>(field.arraySize()));
+
+                if(field.isVector())
+                {
+                    update(hash, field.vectorSizeMember());
+                }
+
+                break;
+            }
+
+            case NodeKind::TypeAlias:
+            {
+                const auto& alias = static_cast<const nodes::TypeAlias&>(node);
+                update(hash, alias.aliasedType());
+                update(hash, alias.existingType());
+                break;
+            }
+
+            case NodeKind::VariableBlockCase:
+            {
+                const auto& c = static_cast<const nodes::VariableBlockCase&>(node);
+                update(hash, c.value());
+                update(hash, c.type());
+                break;
+            }
+
+            default:
+                break;
+            }
+
+            hash.update(static_cast<std::uint64_t>(node.kind()));
+
+            // the child count leaves out comments, or adding one to a struct
+            // or enum body would change the hash
+            std::uint64_t children = 0;
+            for(const auto& child : node.children())
+            {
+                children += isComment(*child) ? 0 : 1;
+            }
+
+            hash.update(children);
+
+            for(const auto& child : node.children())
+            {
+                if(!isComment(*child))
+                {
+                    hashNode(hash, *child);
+                }
+            }
+        }
+
+        bool isExported(const Node& node)
+        {
+            const auto kind = node.kind();
+            return (kind == NodeKind::Struct) || (kind == NodeKind::Enum) || (kind == NodeKind::Bitfield) || (kind == NodeKind::TypeAlias);
+        }
+    }
+
+    std::uint64_t interfaceHash(const ast::AbstractSyntaxTree& ast)
+    {
+        Hash hash;
+
+        for(const auto& node : ast.root()->children())
+        {
+            if(isExported(*node))
+            {
+                hashNode(hash, *node);
+            }
+        }
+
+        return hash.value();
+    }
+}}
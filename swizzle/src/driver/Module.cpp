@@ -0,0 +1,167 @@
+#include <swizzle/driver/Module.hpp>
+
+#include <swizzle/ast/Layout.hpp>
+#include <swizzle/driver/Hash.hpp>
+#include <swizzle/driver/InterfaceHash.hpp>
+#include <swizzle/driver/PhaseTimer.hpp>
+#include <swizzle/driver/ScanImports.hpp>
+#include <swizzle/lexer/Tokenizer.hpp>
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/utility/string_view.hpp>
+
+#include <iterator>
+#include <stdexcept>
+
+namespace swizzle { namespace driver {
+
+    namespace {
+
+        struct AppendToken
+        {
+            AppendToken(std::deque<lexer::TokenInfo>& tokens)
+                : tokens_(tokens)
+            {
+            }
+
+            void operator()(const lexer::TokenInfo& token)
+            {
+                tokens_.push_back(token);
+            }
+
+        private:
+            std::deque<lexer::TokenInfo>& tokens_;
+        };
+    }
+
+    Module::Module(const boost::filesystem::path& path, const boost::filesystem::path& importRoot)
+        : path_(path)
+        , importRoot_(importRoot)
+        , parser_(importRoot)
+    {
+    }
+
+    void Module::load(const DependencyRecord* previous)
+    {
+        {
+            PhaseTimer timer(phases_[Phase::Load]);
+            const auto file = path_.is_absolute() ? path_ : importRoot_ / path_;
+
+            boost::filesystem::ifstream is(file, std::ios::in | std::ios::binary);
+            if(!is)
+            {
+                throw std::runtime_error("Unable to open file: " + file.string());
+            }
+
+            source_.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+
+            hasPrevious_ = (previous != nullptr);
+            previous_ = hasPrevious_ ? *previous : DependencyRecord();
+            contentHash_ = Hash().update(source_).value();
+        }
+
+        if(!contentChanged())
+        {
+            // nothing to tokenize unless an importer needs this module parsed
+            imports_ = previous_.Imports;
+            interfaceHash_ = previous_.InterfaceHash;
+            return;
+        }
+
+        tokenize();
+    }
+
+    void Module::tokenize()
+    {
+        PhaseTimer timer(phases_[Phase::Lex]);
+        const auto file = path_.is_absolute() ? path_ : importRoot_ / path_;
+
+        AppendToken callback(tokens_);
+        lexer::Tokenizer<AppendToken> tokenizer(file.string(), callback);
+
+        const boost::string_view sv(source_);
+        for(std::size_t position = 0, end = sv.length(); position < end; ++position)
+        {
+            tokenizer.consume(sv, position);
+        }
+
+        tokenizer.flush();
+        tokenizerStats_ = tokenizer.stats();
+
+        imports_ = scanImports(tokens_);
+        tokenized_ = true;
+        tokenCount_ = tokens_.size();
+    }
+
+    void Module::parse(const std::vector<std::shared_ptr<const Module>>& imports)
+    {
+        if(!tokenized_)
+        {
+            tokenize();
+        }
+
+        {
+            PhaseTimer timer(phases_[Phase::Parse]);
+
+            for(const auto& module : imports)
+            {
+                parser_.import(module->ast());
+                importedInterfaces_.push_back(module->interfaceHash());
+            }
+
+            imported_ = imports;
+
+            for(const auto& token : tokens_)
+            {
+                parser_.consume(token);
+            }
+        }
+
+        {
+            PhaseTimer timer(phases_[Phase::Validate]);
+            parser_.finalize();
+            ast::computeLayout(parser_.ast());
+        }
+
+        tokens_.clear();
+
+        // generated code bakes in the layouts of imported types, so a change
+        // anywhere below an import changes this module's interface too
+        Hash hash;
+        hash.update(driver::interfaceHash(parser_.ast()));
+
+        for(const auto imported : importedInterfaces_)
+        {
+            hash.update(imported);
+        }
+
+        interfaceHash_ = hash.value();
+        parsed_ = true;
+    }
+
+    bool Module::contentChanged() const
+    {
+        return !hasPrevious_ || (previous_.ContentHash != contentHash_);
+    }
+
+    bool Module::interfaceChanged() const
+    {
+        return !hasPrevious_ || (previous_.InterfaceHash != interfaceHash_);
+    }
+
+    DependencyRecord Module::record() const
+    {
+        DependencyRecord result;
+        result.ContentHash = contentHash_;
+        result.InterfaceHash = interfaceHash_;
+        result.Imports = imports_;
+
+        return result;
+    }
+
+    void Module::fail(const std::string& error)
+    {
+        error_ = error;
+        tokens_.clear();
+    }
+}}
@@ -0,0 +1,50 @@
+#include <swizzle/driver/ModuleCache.hpp>
+
+namespace swizzle { namespace driver {
+
+    ModuleCache::ModuleCache(std::size_t capacity)
+        : capacity_(capacity)
+    {
+    }
+
+    std::shared_ptr<Module> ModuleCache::find(const boost::filesystem::path& path) const
+    {
+        const auto iter = index_.find(path);
+        return iter == index_.end() ? nullptr : iter->second->second;
+    }
+
+    void ModuleCache::insert(const boost::filesystem::path& path, const std::shared_ptr<Module>& module)
+    {
+        if(capacity_ == 0)
+        {
+            return;
+        }
+
+        const auto iter = index_.find(path);
+        if(iter != index_.end())
+        {
+            iter->second->second = module;
+            entries_.splice(entries_.begin(), entries_, iter->second);
+            return;
+        }
+
+        entries_.emplace_front(path, module);
+        index_.emplace(path, entries_.begin());
+
+        if(entries_.size() > capacity_)
+        {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+    }
+
+    void ModuleCache::erase(const boost::filesystem::path& path)
+    {
+        const auto iter = index_.find(path);
+        if(iter != index_.end())
+        {
+            entries_.erase(iter->second);
+            index_.erase(iter);
+        }
+    }
+}}
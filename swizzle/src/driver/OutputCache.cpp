@@ -0,0 +1,271 @@
+#include <swizzle/driver/OutputCache.hpp>
+
+#include <swizzle/driver/WriteIfChanged.hpp>
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include <algorithm>
+#include <ctime>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+namespace swizzle { namespace driver {
+
+    namespace {
+
+        static const char* const ManifestSignature = "swizzle-manifest 1";
+        static const char* const ArtifactsSignature = "swizzle-artifacts 1";
+
+        bool read(const boost::filesystem::path& file, std::string& contents)
+        {
+            boost::filesystem::ifstream is(file, std::ios::in | std::ios::binary);
+            if(!is)
+            {
+                return false;
+            }
+
+            contents.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+
+            // LRU order for trim(), another job may have removed it meanwhile
+            boost::system::error_code ec;
+            boost::filesystem::last_write_time(file, std::time(nullptr), ec);
+
+            return true;
+        }
+
+        // "keyword value\n" at @position
+        bool line(const std::string& contents, std::size_t& position, std::string& keyword, std::string& value)
+        {
+            const auto end = contents.find('\n', position);
+            if(end == std::string::npos)
+            {
+                return false;
+            }
+
+            const auto text = contents.substr(position, end - position);
+            position = end + 1;
+
+            const auto space = text.find(' ');
+            keyword = text.substr(0, space);
+            value = (space == std::string::npos) ? std::string() : text.substr(space + 1);
+
+            return true;
+        }
+    }
+
+    OutputCache::OutputCache(const boost::filesystem::path& directory, std::uint64_t maxBytes)
+        : directory_(directory)
+        , maxBytes_(maxBytes)
+    {
+    }
+
+    boost::filesystem::path OutputCache::entry(std::uint64_t key, const char* kind) const
+    {
+        std::ostringstream name;
+        name << std::hex << std::setw(16) << std::setfill('0') << key;
+
+        const auto hex = name.str();
+        return directory_ / hex.substr(0, 2) / (hex.substr(2) + kind);
+    }
+
+    bool OutputCache::find(std::uint64_t key, DependencyRecord& manifest) const
+    {
+        std::string contents;
+        if(!read(entry(key, ".manifest"), contents))
+        {
+            return false;
+        }
+
+        DependencyRecord record;
+        std::size_t position = 0;
+        std::string keyword;
+        std::string value;
+
+        if(!line(contents, position, keyword, value) || (keyword + " " + value) != ManifestSignature)
+        {
+            return false;
+        }
+
+        try
+        {
+            while(line(contents, position, keyword, value))
+            {
+                if(keyword == "content") { record.ContentHash = std::stoull(value, nullptr, 16); }
+                else if(keyword == "interface") { record.InterfaceHash = std::stoull(value, nullptr, 16); }
+                else if(keyword == "import") { record.Imports.emplace_back(value); }
+                else if(keyword == "end") { manifest = record; return true; }
+                else
+                {
+                    return false;
+                }
+            }
+        }
+        catch(const std::logic_error&)
+        {
+        }
+
+        return false;
+    }
+
+    void OutputCache::insert(std::uint64_t key, const DependencyRecord& manifest)
+    {
+        std::ostringstream os;
+        os << ManifestSignature << "\n" << std::hex;
+        os << "content " << manifest.ContentHash << "\n";
+        os << "interface " << manifest.InterfaceHash << "\n";
+
+        for(const auto& import : manifest.Imports)
+        {
+            os << "import " << import.generic_string() << "\n";
+        }
+
+        os << "end\n";
+
+        const auto contents = os.str();
+        if(writeIfChanged(entry(key, ".manifest"), contents))
+        {
+            inserted_ += contents.size();
+        }
+    }
+
+    bool OutputCache::find(std::uint64_t key, Artifacts& artifacts) const
+    {
+        std::string contents;
+        if(!read(entry(key, ".artifacts"), contents))
+        {
+            return false;
+        }
+
+        Artifacts result;
+        std::size_t position = 0;
+        std::string keyword;
+        std::string value;
+
+        if(!line(contents, position, keyword, value) || (keyword + " " + value) != ArtifactsSignature)
+        {
+            return false;
+        }
+
+        try
+        {
+            // artifact <size> <name>\n<size bytes>\n
+            while(line(contents, position, keyword, value))
+            {
+                if(keyword == "end")
+                {
+                    artifacts.swap(result);
+                    return true;
+                }
+
+                std::size_t length = 0;
+                const auto size = std::stoull(value, &length);
+
+                if(keyword != "artifact" || length >= value.size() || (position + size + 1) > contents.size())
+                {
+                    return false;
+                }
+
+                result.emplace_back(value.substr(length + 1), contents.substr(position, size));
+                position += size + 1;
+            }
+        }
+        catch(const std::logic_error&)
+        {
+        }
+
+        return false;
+    }
+
+    void OutputCache::insert(std::uint64_t key, const Artifacts& artifacts)
+    {
+        std::string contents = std::string(ArtifactsSignature) + "\n";
+
+        for(const auto& artifact : artifacts)
+        {
+            contents += "artifact " + std::to_string(artifact.second.size()) + " " + artifact.first + "\n";
+            contents += artifact.second;
+            contents += "\n";
+        }
+
+        contents += "end\n";
+
+        if(writeIfChanged(entry(key, ".artifacts"), contents))
+        {
+            inserted_ += contents.size();
+        }
+    }
+
+    std::uint64_t OutputCache::size() const
+    {
+        std::uint64_t bytes = 0;
+        boost::system::error_code ec;
+
+        for(boost::filesystem::recursive_directory_iterator iter(directory_, ec), end; !ec && iter != end; iter.increment(ec))
+        {
+            if(boost::filesystem::is_regular_file(iter->status()))
+            {
+                bytes += boost::filesystem::file_size(iter->path(), ec);
+            }
+        }
+
+        return bytes;
+    }
+
+    void OutputCache::trim()
+    {
+        if(inserted_ == 0)
+        {
+            return;
+        }
+
+        inserted_ = 0;
+
+        struct Entry
+        {
+            std::time_t Used;
+            std::uint64_t Size;
+            boost::filesystem::path Path;
+        };
+
+        std::vector<Entry> entries;
+        std::uint64_t bytes = 0;
+        boost::system::error_code ec;
+
+        for(boost::filesystem::recursive_directory_iterator iter(directory_, ec), end; !ec && iter != end; iter.increment(ec))
+        {
+            // skip entries still being written by writeIfChanged()
+            if(boost::filesystem::is_regular_file(iter->status()) && (iter->path().extension() != ".tmp"))
+            {
+                Entry e { boost::filesystem::last_write_time(iter->path(), ec), boost::filesystem::file_size(iter->path(), ec), iter->path() };
+                if(!ec)
+                {
+                    bytes += e.Size;
+                    entries.push_back(e);
+                }
+            }
+        }
+
+        if(bytes <= maxBytes_)
+        {
+            return;
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs){ return lhs.Used < rhs.Used; });
+
+        const auto target = maxBytes_ / 10 * 9;
+        for(const auto& e : entries)
+        {
+            if(bytes <= target)
+            {
+                break;
+            }
+
+            // a parallel job may be trimming too
+            boost::filesystem::remove(e.Path, ec);
+            bytes -= e.Size;
+        }
+    }
+}}
@@ -0,0 +1,38 @@
+#include <swizzle/driver/Phase.hpp>
+
+namespace swizzle { namespace driver {
+
+    std::ostream& operator<<(std::ostream& os, const Phase phase)
+    {
+        switch(phase)
+        {
+        case Phase::Load: return os << "load";
+        case Phase::Lex: return os << "lex";
+        case Phase::Parse: return os << "parse";
+        case Phase::Validate: return os << "validate";
+        case Phase::Codegen: return os << "codegen";
+        };
+
+        return os << "unknown";
+    }
+
+    PhaseStats& PhaseStats::operator+=(const PhaseStats& other)
+    {
+        WallSeconds += other.WallSeconds;
+        CpuSeconds += other.CpuSeconds;
+        Allocations += other.Allocations;
+        AllocatedBytes += other.AllocatedBytes;
+
+        return *this;
+    }
+
+    PhaseTimes& PhaseTimes::operator+=(const PhaseTimes& other)
+    {
+        for(std::size_t i = 0; i < PhaseCount; ++i)
+        {
+            phases_[i] += other.phases_[i];
+        }
+
+        return *this;
+    }
+}}
@@ -0,0 +1,39 @@
+#include <swizzle/driver/PhaseTimer.hpp>
+
+#include <swizzle/driver/AllocationCount.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+#endif
+
+namespace swizzle { namespace driver {
+
+    double threadCpuSeconds()
+    {
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+        timespec ts;
+        if(clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+        {
+            return static_cast<double>(ts.tv_sec) + (static_cast<double>(ts.tv_nsec) / 1e9);
+        }
+#endif
+        return 0;
+    }
+
+    PhaseTimer::PhaseTimer(PhaseStats& stats)
+        : stats_(stats)
+        , wall_(std::chrono::steady_clock::now())
+        , cpu_(threadCpuSeconds())
+        , allocations_(threadAllocations())
+        , allocatedBytes_(threadAllocatedBytes())
+    {
+    }
+
+    PhaseTimer::~PhaseTimer()
+    {
+        stats_.WallSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_).count();
+        stats_.CpuSeconds += threadCpuSeconds() - cpu_;
+        stats_.Allocations += threadAllocations() - allocations_;
+        stats_.AllocatedBytes += threadAllocatedBytes() - allocatedBytes_;
+    }
+}}
@@ -0,0 +1,49 @@
+#include <swizzle/driver/ScanImports.hpp>
+
+#include <swizzle/parser/TokenStack.hpp>
+#include <swizzle/parser/detail/CreateImportPath.hpp>
+
+namespace swizzle { namespace driver {
+
+    std::vector<boost::filesystem::path> scanImports(const std::deque<lexer::TokenInfo>& tokens)
+    {
+        std::vector<boost::filesystem::path> imports;
+
+        bool inImport = false;
+        parser::TokenStack tokenStack;
+
+        for(const auto& token : tokens)
+        {
+            const auto type = token.token().type();
+
+            if(!inImport)
+            {
+                inImport = (type == lexer::TokenType::keyword) && (token.token().value() == "import");
+                continue;
+            }
+
+            if(type == lexer::TokenType::string)
+            {
+                tokenStack.push(token);
+            }
+            else if(type == lexer::TokenType::end_statement)
+            {
+                // malformed statements are left for the parser to report
+                if(!tokenStack.empty())
+                {
+                    imports.push_back(parser::detail::createImportPath(tokenStack));
+                    tokenStack = parser::TokenStack();
+                }
+
+                inImport = false;
+            }
+            else if(type != lexer::TokenType::colon)
+            {
+                tokenStack = parser::TokenStack();
+                inImport = false;
+            }
+        }
+
+        return imports;
+    }
+}}
@@ -0,0 +1,71 @@
+#include <swizzle/driver/ThreadPool.hpp>
+
+#include <utility>
+
+namespace swizzle { namespace driver {
+
+    ThreadPool::ThreadPool(std::size_t threads)
+        : stopping_(false)
+    {
+        if(threads == 0)
+        {
+            threads = std::thread::hardware_concurrency();
+        }
+
+        threads = threads == 0 ? 1 : threads;
+        threads_.reserve(threads);
+
+        for(std::size_t i = 0; i < threads; ++i)
+        {
+            threads_.emplace_back([this]{ run(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+
+        ready_.notify_all();
+
+        for(auto& thread : threads_)
+        {
+            thread.join();
+        }
+    }
+
+    void ThreadPool::post(Task task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(std::move(task));
+        }
+
+        ready_.notify_one();
+    }
+
+    void ThreadPool::run()
+    {
+        for(;;)
+        {
+            Task task;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [this]{ return stopping_ || !tasks_.empty(); });
+
+                if(tasks_.empty())
+                {
+                    return;
+                }
+
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+
+            task();
+        }
+    }
+}}
@@ -0,0 +1,17 @@
+#include <swizzle/driver/Version.hpp>
+
+#if defined(SWIZZLE_SOURCE_HASH_HEADER)
+#include <swizzle/driver/SourceHash.hpp>
+#endif
+
+namespace swizzle { namespace driver {
+
+    const char* compilerVersion()
+    {
+#if defined(SWIZZLE_SOURCE_HASH)
+        return SWIZZLE_SOURCE_HASH;
+#else
+        return "dev " __DATE__ " " __TIME__;
+#endif
+    }
+}}
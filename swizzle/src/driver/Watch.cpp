@@ -0,0 +1,75 @@
+#include <swizzle/driver/Watch.hpp>
+
+#include <swizzle/driver/FileWatcher.hpp>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <algorithm>
+
+namespace swizzle { namespace driver {
+
+    namespace {
+
+        std::vector<boost::filesystem::path> findSchemas(const boost::filesystem::path& directory)
+        {
+            std::vector<boost::filesystem::path> files;
+
+            for(boost::filesystem::recursive_directory_iterator iter(directory), end; iter != end; ++iter)
+            {
+                if(boost::filesystem::is_regular_file(iter->status()) && (iter->path().extension() == ".swizzle"))
+                {
+                    files.push_back(iter->path());
+                }
+            }
+
+            std::sort(files.begin(), files.end());
+            return files;
+        }
+
+        void compile(Driver& driver, Command command, const boost::filesystem::path& directory, std::ostream& log)
+        {
+            // a directory removed while it is walked fails this round, not the watch
+            try
+            {
+                if(command.Files.empty())
+                {
+                    command.Files = findSchemas(directory);
+                }
+            }
+            catch(const boost::filesystem::filesystem_error& e)
+            {
+                log << "Failed: " << e.what() << std::endl;
+                return;
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            const bool success = runCommand(driver, command, log);
+            const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+            log << (success ? "Compiled " : "Failed ") << command.Files.size() << " file(s) in " << elapsed.count() << " ms" << std::endl;
+        }
+    }
+
+    void watch(Driver& driver, const Command& command, const boost::filesystem::path& directory, std::ostream& log, const std::function<bool()>& stop, const WatchOptions& options)
+    {
+        // watch before the first compile so no edit can slip in between
+        FileWatcher watcher(directory, log);
+        compile(driver, command, directory, log);
+
+        while(!stop())
+        {
+            const auto changed = watcher.wait(options.Poll, options.Settle);
+            if(changed.empty())
+            {
+                continue;
+            }
+
+            for(const auto& file : changed)
+            {
+                log << "Changed: " << file.string() << "\n";
+            }
+
+            compile(driver, command, directory, log);
+        }
+    }
+}}
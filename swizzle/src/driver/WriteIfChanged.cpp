@@ -0,0 +1,79 @@
+#include <swizzle/driver/WriteIfChanged.hpp>
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace swizzle { namespace driver {
+
+    namespace {
+
+        bool sameContents(const boost::filesystem::path& file, const boost::string_view& contents)
+        {
+            boost::system::error_code ec;
+            const auto size = boost::filesystem::file_size(file, ec);
+
+            // different sizes (or no file) never need the bytes read
+            if(ec || (size != contents.size()))
+            {
+                return false;
+            }
+
+            boost::filesystem::ifstream is(file, std::ios::in | std::ios::binary);
+            if(!is)
+            {
+                return false;
+            }
+
+            return std::equal(contents.begin(), contents.end(), std::istreambuf_iterator<char>(is));
+        }
+    }
+
+    bool writeIfChanged(const boost::filesystem::path& file, const boost::string_view& contents)
+    {
+        if(sameContents(file, contents))
+        {
+            return false;
+        }
+
+        if(file.has_parent_path())
+        {
+            boost::filesystem::create_directories(file.parent_path());
+        }
+
+        auto temporary = file;
+        temporary += boost::filesystem::unique_path(".%%%%-%%%%.tmp");
+
+        {
+            boost::filesystem::ofstream os(temporary, std::ios::out | std::ios::binary | std::ios::trunc);
+            os.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+
+            if(!os.flush())
+            {
+                os.close();
+
+                boost::system::error_code ec;
+                boost::filesystem::remove(temporary, ec);
+
+                throw std::runtime_error("Unable to write file: " + temporary.string());
+            }
+        }
+
+        // rename() fails over a directory, say, and leaves the temporary behind
+        boost::system::error_code ec;
+        boost::filesystem::rename(temporary, file, ec);
+
+        if(ec)
+        {
+            boost::system::error_code ignored;
+            boost::filesystem::remove(temporary, ignored);
+
+            throw boost::filesystem::filesystem_error("Unable to replace file", temporary, file, ec);
+        }
+
+        return true;
+    }
+}}
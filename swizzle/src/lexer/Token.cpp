@@ -4,7 +4,9 @@
 namespace swizzle { namespace lexer {
     
     Token::Token()
-        : type_(TokenType::string)
+        : position_(0)
+        , length_(0)
+        , type_(TokenType::string)
     {
     }
     
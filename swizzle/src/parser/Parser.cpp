@@ -1,6 +1,9 @@
 #include <swizzle/parser/Parser.hpp>
 
 #include <swizzle/Exceptions.hpp>
+#include <swizzle/ast/nodes/Bitfield.hpp>
+#include <swizzle/ast/nodes/Enum.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
 #include <swizzle/lexer/TokenInfo.hpp>
 
 #include <sstream>
@@ -11,6 +14,33 @@ namespace swizzle { namespace parser {
         : state_(ParserState::Init)
     {
         nodeStack_.push(ast_.root());
+        context_.Index = &ast_.index();
+    }
+
+    Parser::Parser(const boost::filesystem::path& importRoot)
+        : Parser()
+    {
+        context_.ImportRoot = importRoot;
+    }
+
+    void Parser::import(const ast::AbstractSyntaxTree& module)
+    {
+        const auto& index = module.index();
+
+        for(const auto& node : index.of<ast::nodes::Struct>())
+        {
+            context_.TypeCache[static_cast<const ast::nodes::Struct&>(*node).name().to_string()] = node.get();
+        }
+
+        for(const auto& node : index.of<ast::nodes::Enum>())
+        {
+            context_.TypeCache[static_cast<const ast::nodes::Enum&>(*node).name().to_string()] = node.get();
+        }
+
+        for(const auto& node : index.of<ast::nodes::Bitfield>())
+        {
+            context_.TypeCache[static_cast<const ast::nodes::Bitfield&>(*node).name().to_string()] = node.get();
+        }
     }
 
     void Parser::consume(const lexer::TokenInfo& token)
@@ -33,4 +63,9 @@ namespace swizzle { namespace parser {
     {
         return ast_;
     }
+
+    const ParserStateStats& Parser::stats() const
+    {
+        return states_.stats();
+    }
 }}
@@ -1,6 +1,7 @@
 #include <swizzle/parser/ParserStateContext.hpp>
 
 #include <swizzle/Exceptions.hpp>
+#include <swizzle/ast/NodeIndex.hpp>
 #include <swizzle/lexer/TokenInfo.hpp>
 
 #include <cstddef>
@@ -42,6 +43,14 @@ namespace swizzle { namespace parser {
         UsedEnumValues.insert(value);
     }
 
+    void ParserStateContext::IndexNode(const ast::Node::smartptr& node)
+    {
+        if(Index)
+        {
+            Index->insert(node);
+        }
+    }
+
     void ParserStateContext::ClearEnumValueAllocations()
     {
         UsedEnumValues.clear();
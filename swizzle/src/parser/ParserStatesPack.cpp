@@ -1,11 +1,44 @@
 #include <swizzle/parser/ParserStatesPack.hpp>
 
 #include <swizzle/Exceptions.hpp>
+#include <swizzle/profile/CycleCounter.hpp>
 #include <sstream>
 
 namespace swizzle { namespace parser {
 
     ParserState ParserStatesPack::consume(const ParserState state, const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack& attributeStack, TokenStack& tokenStack, ParserStateContext& context)
+    {
+#if defined(SWIZZLE_STATE_STATS)
+        const auto start = profile::cycles();
+
+        try
+        {
+            const auto next = dispatch(state, token, nodeStack, attributeStack, tokenStack, context);
+            stats_.transition(state, profile::cycles() - start);
+
+            return next;
+        }
+        catch(...)
+        {
+            stats_.exception(state, profile::cycles() - start);
+            throw;
+        }
+#else
+        return dispatch(state, token, nodeStack, attributeStack, tokenStack, context);
+#endif
+    }
+
+    const ParserStateStats& ParserStatesPack::stats() const
+    {
+#if defined(SWIZZLE_STATE_STATS)
+        return stats_;
+#else
+        static const ParserStateStats empty;
+        return empty;
+#endif
+    }
+
+    ParserState ParserStatesPack::dispatch(const ParserState state, const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack& attributeStack, TokenStack& tokenStack, ParserStateContext& context)
     {
         switch(state)
         {
@@ -2,9 +2,7 @@
 
 #include <swizzle/Exceptions.hpp>
 
-#include <swizzle/ast/Matcher.hpp>
-#include <swizzle/ast/matchers/HasFieldNamed.hpp>
-#include <swizzle/ast/matchers/IsTypeOf.hpp>
+#include <swizzle/ast/CompiledMatcher.hpp>
 #include <swizzle/ast/nodes/Struct.hpp>
 #include <swizzle/ast/nodes/StructField.hpp>
 #include <swizzle/ast/nodes/VariableBlock.hpp>
@@ -37,7 +35,7 @@ namespace swizzle { namespace parser { namespace detail {
 
             NodeStack nodes = nodeStack;
 
-            auto isVariableBlock = ast::Matcher().isTypeOf<ast::nodes::VariableBlock>();
+            auto isVariableBlock = ast::CompiledMatcher<>().isTypeOf<ast::nodes::VariableBlock>();
             if(!isVariableBlock(nodes.top()))
             {
                 throw SyntaxError("Expected top of node stack to be ast::nodes::VariableBlock", " unexpected type", info);
@@ -46,7 +44,7 @@ namespace swizzle { namespace parser { namespace detail {
             const auto varBlock = nodes.top();
             nodes.pop();
 
-            auto isStruct = ast::Matcher().isTypeOf<ast::nodes::Struct>();
+            auto isStruct = ast::CompiledMatcher<>().isTypeOf<ast::nodes::Struct>();
             if(!isStruct(nodes.top()))
             {
                 throw SyntaxError("Expected node below top of node stack to be ast::nodes::Struct", " unexpected type", info);
@@ -59,17 +57,17 @@ namespace swizzle { namespace parser { namespace detail {
         }
     }
 
-    ast::Node::smartptr validateVariableBlockSizeMember(const lexer::TokenInfo& tokenInfo, const NodeStack& nodeStack, const TokenStack& tokenStack, const ParserStateContext& context)
+    ast::Node* validateVariableBlockSizeMember(const lexer::TokenInfo& tokenInfo, const NodeStack& nodeStack, const TokenStack& tokenStack, const ParserStateContext& context)
     {
         validateTokenStack(tokenStack, tokenInfo.fileInfo());
-        auto structure = validateNodeStack(nodeStack, tokenInfo.fileInfo());
+        ast::Node* structure = validateNodeStack(nodeStack, tokenInfo.fileInfo()).get();
 
         TokenStack stack = tokenStack;
         stack = utils::stack::invert(stack);
 
         bool last = false;
-        auto isStructField = ast::Matcher().isTypeOf<ast::nodes::StructField>();
-        ast::Node::smartptr fieldNode = nullptr;
+        auto isStructField = ast::CompiledMatcher<>().isTypeOf<ast::nodes::StructField>();
+        ast::Node* fieldNode = nullptr;
 
         const TokenList list = utils::stack::to_list(stack);
         for(const auto token : list)
@@ -79,15 +77,14 @@ namespace swizzle { namespace parser { namespace detail {
                 throw SyntaxError("Invalidly formatted variable block member", " intermediate member is integer type not struct", token.fileInfo());
             }
 
-            auto matcher = ast::Matcher().isTypeOf<ast::nodes::Struct>().hasFieldNamed(token.token().to_string()).bind("field");
-            if(matcher(structure))
+            auto matcher = ast::CompiledMatcher<>().isTypeOf<ast::nodes::Struct>().hasFieldNamed(token.token().value()).bind();
+            if(matcher(*structure))
             {
-                fieldNode = matcher.bound("field");
-                if(isStructField(fieldNode))
+                fieldNode = matcher.bound<0>();
+                if(isStructField(*fieldNode))
                 {
-                    auto field = static_cast<ast::nodes::StructField&>(*fieldNode);
-                    const auto ts = field.type();
-                    auto type = boost::string_view(ts);
+                    const auto& field = static_cast<ast::nodes::StructField&>(*fieldNode);
+                    const auto type = field.type();
 
                     // type can be integral or string (array or vector)
                     if(types::IsIntegerType(type))
@@ -98,6 +95,11 @@ namespace swizzle { namespace parser { namespace detail {
                     {
                         throw SyntaxError("Variable block member is constructed from unsupported type. Type must be integeral.", " non-integral type", token.fileInfo());
                     }
+                    else if(field.typeDeclaration())
+                    {
+                        // resolved by the parser when the field was declared
+                        structure = field.typeDeclaration();
+                    }
                     else
                     {
                         const auto typeName = containsNamespace(type) ? type.to_string() : context.CurrentNamespace + "::" + type.to_string();
@@ -118,7 +120,7 @@ namespace swizzle { namespace parser { namespace detail {
             else
             {
                 const auto& s = static_cast<ast::nodes::Struct&>(*structure);
-                throw SyntaxError("Variable block member invalid", " references to unknown field (" + token.token().to_string() + ") in type: " + s.name(), tokenInfo.fileInfo());
+                throw SyntaxError("Variable block member invalid", " references to unknown field (" + token.token().to_string() + ") in type: " + s.name().to_string(), tokenInfo.fileInfo());
             }
         }
 
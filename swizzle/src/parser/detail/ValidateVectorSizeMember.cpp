@@ -2,9 +2,7 @@
 
 #include <swizzle/Exceptions.hpp>
 
-#include <swizzle/ast/Matcher.hpp>
-#include <swizzle/ast/matchers/HasFieldNamed.hpp>
-#include <swizzle/ast/matchers/IsTypeOf.hpp>
+#include <swizzle/ast/CompiledMatcher.hpp>
 #include <swizzle/ast/nodes/Struct.hpp>
 #include <swizzle/ast/nodes/StructField.hpp>
 #include <swizzle/parser/ParserStateContext.hpp>
@@ -36,7 +34,7 @@ namespace swizzle { namespace parser { namespace detail {
 
             NodeStack nodes = nodeStack;
 
-            auto isStructField = ast::Matcher().isTypeOf<ast::nodes::StructField>();
+            auto isStructField = ast::CompiledMatcher<>().isTypeOf<ast::nodes::StructField>();
             if(!isStructField(nodes.top()))
             {
                 throw SyntaxError("Expected top of node stack to be ast::nodes::StructField", " unexpected type", info);
@@ -45,7 +43,7 @@ namespace swizzle { namespace parser { namespace detail {
             const auto field = nodes.top();
             nodes.pop();
 
-            auto isStruct = ast::Matcher().isTypeOf<ast::nodes::Struct>();
+            auto isStruct = ast::CompiledMatcher<>().isTypeOf<ast::nodes::Struct>();
             if(!isStruct(nodes.top()))
             {
                 throw SyntaxError("Expected node below top of node stack to be ast::nodes::Struct", " unexpected type", info);
@@ -61,13 +59,13 @@ namespace swizzle { namespace parser { namespace detail {
     void validateVectorSizeMember(const lexer::TokenInfo& tokenInfo, const NodeStack& nodeStack, const TokenStack& tokenStack, const ParserStateContext& context)
     {
         validateTokenStack(tokenStack, tokenInfo.fileInfo());
-        auto structure = validateNodeStack(nodeStack, tokenInfo.fileInfo());
+        ast::Node* structure = validateNodeStack(nodeStack, tokenInfo.fileInfo()).get();
 
         TokenStack stack = tokenStack;
         stack = utils::stack::invert(stack);
 
         bool last = false;
-        auto isStructField = ast::Matcher().isTypeOf<ast::nodes::StructField>();
+        auto isStructField = ast::CompiledMatcher<>().isTypeOf<ast::nodes::StructField>();
 
         const TokenList list = utils::stack::to_list(stack);
         for(const auto token : list)
@@ -77,15 +75,14 @@ namespace swizzle { namespace parser { namespace detail {
                 throw SyntaxError("Invalidly formatted vector size member", " intermediate member is integer type not struct", token.fileInfo());
             }
 
-            auto matcher = ast::Matcher().isTypeOf<ast::nodes::Struct>().hasFieldNamed(token.token().to_string()).bind("field");
-            if(matcher(structure))
+            auto matcher = ast::CompiledMatcher<>().isTypeOf<ast::nodes::Struct>().hasFieldNamed(token.token().value()).bind();
+            if(matcher(*structure))
             {
-                auto fieldNode = matcher.bound("field");
-                if(isStructField(fieldNode))
+                auto fieldNode = matcher.bound<0>();
+                if(isStructField(*fieldNode))
                 {
-                    auto field = static_cast<ast::nodes::StructField&>(*fieldNode);
-                    const auto ts = field.type();
-                    auto type = boost::string_view(ts);
+                    const auto& field = static_cast<ast::nodes::StructField&>(*fieldNode);
+                    const auto type = field.type();
 
                     if(types::IsIntegerType(type))
                     {
@@ -95,6 +92,11 @@ namespace swizzle { namespace parser { namespace detail {
                     {
                         throw SyntaxError("Vector size member is constructed from unsupported type. Type must be integeral.", " non-integral type", token.fileInfo());
                     }
+                    else if(field.typeDeclaration())
+                    {
+                        // resolved by the parser when the field was declared
+                        structure = field.typeDeclaration();
+                    }
                     else
                     {
                         const auto typeName = containsNamespace(type) ? type.to_string() : context.CurrentNamespace + "::" + type.to_string();
@@ -115,7 +117,7 @@ namespace swizzle { namespace parser { namespace detail {
             else
             {
                 const auto& s = static_cast<ast::nodes::Struct&>(*structure);
-                throw SyntaxError("Vector size member invalid", " references to unknown field (" + token.token().to_string() + ") in type: " + s.name(), tokenInfo.fileInfo());
+                throw SyntaxError("Vector size member invalid", " references to unknown field (" + token.token().to_string() + ") in type: " + s.name().to_string(), tokenInfo.fileInfo());
             }
         }
 
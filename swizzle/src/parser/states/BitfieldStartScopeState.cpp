@@ -22,7 +22,7 @@
 
 namespace swizzle { namespace parser { namespace states {
 
-    ParserState BitfieldStartScopeState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack& attributeStack, TokenStack&, ParserStateContext&)
+    ParserState BitfieldStartScopeState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack& attributeStack, TokenStack&, ParserStateContext& context)
     {
         const auto type = token.token().type();
 
@@ -35,50 +35,53 @@ namespace swizzle { namespace parser { namespace states {
 
             if(type == lexer::TokenType::char_literal)
             {
-                detail::appendNode<ast::nodes::CharLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::CharLiteral>(context, attributeStack, token);
                 return ParserState::BitfieldStartScope;
             }
 
             if(type == lexer::TokenType::string_literal)
             {
-                detail::appendNode<ast::nodes::StringLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::StringLiteral>(context, attributeStack, token);
                 return ParserState::BitfieldStartScope;
             }
 
             if(type == lexer::TokenType::hex_literal)
             {
-                detail::appendNode<ast::nodes::HexLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::HexLiteral>(context, attributeStack, token);
                 return ParserState::BitfieldStartScope;
             }
 
             if(type == lexer::TokenType::numeric_literal)
             {
-                detail::appendNode<ast::nodes::NumericLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::NumericLiteral>(context, attributeStack, token);
                 return ParserState::BitfieldStartScope;
             }
 
             if(type == lexer::TokenType::attribute_block)
             {
-                detail::appendNode<ast::nodes::AttributeBlock>(attributeStack, token);
+                detail::appendNode<ast::nodes::AttributeBlock>(context, attributeStack, token);
                 return ParserState::BitfieldStartScope;
             }
         }
 
         if(type == lexer::TokenType::attribute)
         {
-            attributeStack.push(new ast::nodes::Attribute(token));
+            ast::Node::smartptr attribute = new ast::nodes::Attribute(token);
+            context.IndexNode(attribute);
+
+            attributeStack.push(attribute);
             return ParserState::BitfieldStartScope;
         }
 
         if(type == lexer::TokenType::comment)
         {
-            detail::appendNode<ast::nodes::Comment>(nodeStack, token);
+            detail::appendNode<ast::nodes::Comment>(context, nodeStack, token);
             return ParserState::BitfieldStartScope;
         }
 
         if(type == lexer::TokenType::multiline_comment)
         {
-            detail::appendNode<ast::nodes::MultilineComment>(nodeStack, token);
+            detail::appendNode<ast::nodes::MultilineComment>(context, nodeStack, token);
             return ParserState::BitfieldStartScope;
         }
 
@@ -87,7 +90,7 @@ namespace swizzle { namespace parser { namespace states {
             if(detail::nodeStackTopIs<ast::nodes::Bitfield>(nodeStack))
             {
                 auto& top = static_cast<ast::nodes::Bitfield&>(*nodeStack.top());
-                const auto node = detail::appendNode<ast::nodes::BitfieldField>(nodeStack, token, top.underlying());
+                const auto node = detail::appendNode<ast::nodes::BitfieldField>(context, nodeStack, token, top.underlying());
 
                 detail::attachAttributes(attributeStack, node);
                 nodeStack.push(node);
@@ -105,7 +108,7 @@ namespace swizzle { namespace parser { namespace states {
                 auto& top = static_cast<ast::nodes::Bitfield&>(*nodeStack.top());
                 if(top.empty())
                 {
-                    throw SyntaxError("Enum must have fields, no fields declared in '" + top.name() + "'", token);
+                    throw SyntaxError("Enum must have fields, no fields declared in '" + top.name().to_string() + "'", token);
                 }
 
                 nodeStack.pop();
@@ -1,6 +1,6 @@
 #include <swizzle/parser/states/EnumStartScopeState.hpp>
 
-#include <swizzle/ast/Matcher.hpp>
+#include <swizzle/ast/CompiledMatcher.hpp>
 #include <swizzle/ast/nodes/Attribute.hpp>
 #include <swizzle/ast/nodes/AttributeBlock.hpp>
 #include <swizzle/ast/nodes/CharLiteral.hpp>
@@ -36,50 +36,53 @@ namespace swizzle { namespace parser { namespace states {
 
             if(type == lexer::TokenType::char_literal)
             {
-                detail::appendNode<ast::nodes::CharLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::CharLiteral>(context, attributeStack, token);
                 return ParserState::EnumStartScope;
             }
 
             if(type == lexer::TokenType::string_literal)
             {
-                detail::appendNode<ast::nodes::StringLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::StringLiteral>(context, attributeStack, token);
                 return ParserState::EnumStartScope;
             }
 
             if(type == lexer::TokenType::hex_literal)
             {
-                detail::appendNode<ast::nodes::HexLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::HexLiteral>(context, attributeStack, token);
                 return ParserState::EnumStartScope;
             }
 
             if(type == lexer::TokenType::numeric_literal)
             {
-                detail::appendNode<ast::nodes::NumericLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::NumericLiteral>(context, attributeStack, token);
                 return ParserState::EnumStartScope;
             }
 
             if(type == lexer::TokenType::attribute_block)
             {
-                detail::appendNode<ast::nodes::AttributeBlock>(attributeStack, token);
+                detail::appendNode<ast::nodes::AttributeBlock>(context, attributeStack, token);
                 return ParserState::EnumStartScope;
             }
         }
 
         if(type == lexer::TokenType::attribute)
         {
-            attributeStack.push(new ast::nodes::Attribute(token));
+            ast::Node::smartptr attribute = new ast::nodes::Attribute(token);
+            context.IndexNode(attribute);
+
+            attributeStack.push(attribute);
             return ParserState::EnumStartScope;
         }
 
         if(type == lexer::TokenType::comment)
         {
-            detail::appendNode<ast::nodes::Comment>(nodeStack, token);
+            detail::appendNode<ast::nodes::Comment>(context, nodeStack, token);
             return ParserState::EnumStartScope;
         }
 
         if(type == lexer::TokenType::multiline_comment)
         {
-            detail::appendNode<ast::nodes::MultilineComment>(nodeStack, token);
+            detail::appendNode<ast::nodes::MultilineComment>(context, nodeStack, token);
             return ParserState::EnumStartScope;
         }
 
@@ -88,7 +91,7 @@ namespace swizzle { namespace parser { namespace states {
             if(detail::nodeStackTopIs<ast::nodes::Enum>(nodeStack))
             {
                 auto& top = static_cast<ast::nodes::Enum&>(*nodeStack.top());
-                const auto node = detail::appendNode<ast::nodes::EnumField>(nodeStack, token, top.underlying());
+                const auto node = detail::appendNode<ast::nodes::EnumField>(context, nodeStack, token, top.underlying());
 
                 detail::attachAttributes(attributeStack, node);
                 nodeStack.push(node);
@@ -103,11 +106,11 @@ namespace swizzle { namespace parser { namespace states {
         {
             if(detail::nodeStackTopIs<ast::nodes::Enum>(nodeStack))
             {
-                auto hasNonCommentChildren = ast::Matcher().hasChildNotOf<ast::nodes::Comment, ast::nodes::MultilineComment>();
+                auto hasNonCommentChildren = ast::CompiledMatcher<>().hasChildNotOf<ast::nodes::Comment, ast::nodes::MultilineComment>();
                 if(!hasNonCommentChildren(nodeStack.top()))
                 {
                     auto& top = static_cast<ast::nodes::Enum&>(*nodeStack.top());
-                    throw SyntaxError("Enum must have fields", "no fields declared in '" + top.name() + "'", token.fileInfo());
+                    throw SyntaxError("Enum must have fields", "no fields declared in '" + top.name().to_string() + "'", token.fileInfo());
                 }
 
                 context.ClearEnumValueAllocations();
@@ -12,7 +12,7 @@
 
 namespace swizzle { namespace parser { namespace states {
 
-    ParserState ExternValueState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack&, TokenStack& tokenStack, ParserStateContext&)
+    ParserState ExternValueState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack&, TokenStack& tokenStack, ParserStateContext& context)
     {
         const auto type = token.token().type();
 
@@ -26,7 +26,7 @@ namespace swizzle { namespace parser { namespace states {
             auto externType = detail::createType(tokenStack);
             utils::clear(tokenStack);
 
-            detail::appendNode<ast::nodes::Extern>(nodeStack, externType);
+            detail::appendNode<ast::nodes::Extern>(context, nodeStack, externType);
             return ParserState::Init;
         }
 
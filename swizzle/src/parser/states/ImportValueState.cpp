@@ -12,7 +12,7 @@
 
 namespace swizzle { namespace parser { namespace states {
 
-    ParserState ImportValueState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack&, TokenStack& tokenStack, ParserStateContext&)
+    ParserState ImportValueState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack&, TokenStack& tokenStack, ParserStateContext& context)
     {
         const auto type = token.token().type();
 
@@ -24,9 +24,9 @@ namespace swizzle { namespace parser { namespace states {
         if(type == lexer::TokenType::end_statement)
         {
             const boost::filesystem::path import = detail::createImportPath(tokenStack);
-            detail::validateImportPath(import);
+            detail::validateImportPath(context.ImportRoot / import);
 
-            detail::appendNode<ast::nodes::Import>(nodeStack, token, import);
+            detail::appendNode<ast::nodes::Import>(context, nodeStack, token, import);
 
             return ParserState::Init;
         }
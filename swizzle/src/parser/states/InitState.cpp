@@ -13,19 +13,19 @@
 
 namespace swizzle { namespace parser { namespace states {
 
-    ParserState InitState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack&, TokenStack&, ParserStateContext&)
+    ParserState InitState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack&, TokenStack&, ParserStateContext& context)
     {
         const auto type = token.token().type();
 
         if(type == lexer::TokenType::comment)
         {
-            detail::appendNode<ast::nodes::Comment>(nodeStack, token);
+            detail::appendNode<ast::nodes::Comment>(context, nodeStack, token);
             return ParserState::Init;
         }
 
         if(type == lexer::TokenType::multiline_comment)
         {
-            detail::appendNode<ast::nodes::MultilineComment>(nodeStack, token);
+            detail::appendNode<ast::nodes::MultilineComment>(context, nodeStack, token);
             return ParserState::Init;
         }
 
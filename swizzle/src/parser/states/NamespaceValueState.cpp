@@ -25,7 +25,7 @@ namespace swizzle { namespace parser { namespace states {
         {
             const auto nameSpace = detail::createNamespace(tokenStack);
 
-            detail::appendNode<ast::nodes::Namespace>(nodeStack, nameSpace);
+            detail::appendNode<ast::nodes::Namespace>(context, nodeStack, nameSpace);
             context.CurrentNamespace = nameSpace.token().value().to_string();
 
             return ParserState::TranslationUnitMain;
@@ -23,12 +23,12 @@ namespace swizzle { namespace parser { namespace states {
             }
 
             const auto& info = tokenStack.top();
-            const auto node = detail::appendNode<ast::nodes::Bitfield>(nodeStack, info, token, context.CurrentNamespace);
+            const auto node = detail::appendNode<ast::nodes::Bitfield>(context, nodeStack, info, token, context.CurrentNamespace);
 
             detail::attachAttributes(attributeStack, node);
 
             const auto& bf = static_cast<ast::nodes::Bitfield&>(*node);
-            context.TypeCache[bf.name()] = node;
+            context.TypeCache[bf.name().to_string()] = node.get();
 
             nodeStack.push(node);
             tokenStack.pop();
@@ -23,12 +23,12 @@ namespace swizzle { namespace parser { namespace states {
             }
 
             const auto& info = tokenStack.top();
-            const auto node = detail::appendNode<ast::nodes::Enum>(nodeStack, info, token, context.CurrentNamespace);
+            const auto node = detail::appendNode<ast::nodes::Enum>(context, nodeStack, info, token, context.CurrentNamespace);
 
             detail::attachAttributes(attributeStack, node);
 
             const auto& en = static_cast<ast::nodes::Enum&>(*node);
-            context.TypeCache[en.name()] = node;
+            context.TypeCache[en.name().to_string()] = node.get();
 
             nodeStack.push(node);
             tokenStack.pop();
@@ -24,12 +24,12 @@ namespace swizzle { namespace parser { namespace states {
             }
 
             auto& structKeyword = tokenStack.top();
-            auto node = detail::appendNode<ast::nodes::Struct>(nodeStack, structKeyword, token, context.CurrentNamespace);
+            auto node = detail::appendNode<ast::nodes::Struct>(context, nodeStack, structKeyword, token, context.CurrentNamespace);
 
             detail::attachAttributes(attributeStack, node);
 
             const auto structNode = static_cast<ast::nodes::Struct&>(*node);
-            context.TypeCache[structNode.name()] = node;
+            context.TypeCache[structNode.name().to_string()] = node.get();
 
             nodeStack.push(node);
             tokenStack.pop();
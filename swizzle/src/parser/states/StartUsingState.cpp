@@ -11,7 +11,7 @@
 
 namespace swizzle { namespace parser { namespace states {
 
-    ParserState StartUsingState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack& attributeStack, TokenStack& tokenStack, ParserStateContext&)
+    ParserState StartUsingState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack& attributeStack, TokenStack& tokenStack, ParserStateContext& context)
     {
         const auto type = token.token().type();
 
@@ -23,7 +23,7 @@ namespace swizzle { namespace parser { namespace states {
             }
 
             const auto& info = tokenStack.top();
-            const auto node = detail::appendNode<ast::nodes::TypeAlias>(nodeStack, info, token);
+            const auto node = detail::appendNode<ast::nodes::TypeAlias>(context, nodeStack, info, token);
 
             detail::attachAttributes(attributeStack, node);
 
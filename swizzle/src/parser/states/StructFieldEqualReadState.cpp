@@ -17,7 +17,7 @@
 
 namespace swizzle { namespace parser { namespace states {
 
-    ParserState StructFieldEqualReadState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack&, TokenStack&, ParserStateContext&)
+    ParserState StructFieldEqualReadState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack&, TokenStack&, ParserStateContext& context)
     {
         const auto type = token.token().type();
 
@@ -42,7 +42,7 @@ namespace swizzle { namespace parser { namespace states {
                     throw SyntaxError("Numeric literal cannot be assigned to array type, use initialization list instead.", token);
                 }
 
-                detail::appendNode<ast::nodes::DefaultValue>(nodeStack, token, structField.type());
+                detail::appendNode<ast::nodes::DefaultValue>(context, nodeStack, token, structField.type());
                 types::setValue(structField.type(), token.token().value(), "Attempting to assign numeric literal to unsupported type");
 
                 return ParserState::StructFieldValueRead;
@@ -67,7 +67,7 @@ namespace swizzle { namespace parser { namespace states {
                     throw SyntaxError("Numeric literal cannot be assigned to array type, use initialization list instead.", token);
                 }
 
-                detail::appendNode<ast::nodes::DefaultValue>(nodeStack, token, structField.type());
+                detail::appendNode<ast::nodes::DefaultValue>(context, nodeStack, token, structField.type());
                 types::setValue(structField.type(), token.token().value(), types::isHex, "Attempting to assign hex literal to unsupported type");
 
                 return ParserState::StructFieldValueRead;
@@ -92,7 +92,7 @@ namespace swizzle { namespace parser { namespace states {
                     throw SyntaxError("Numeric literal cannot be assigned to array type, use initialization list instead.", token);
                 }
 
-                detail::appendNode<ast::nodes::DefaultValue>(nodeStack, token, structField.type());
+                detail::appendNode<ast::nodes::DefaultValue>(context, nodeStack, token, structField.type());
                 return ParserState::StructFieldValueRead;
             }
 
@@ -116,7 +116,7 @@ namespace swizzle { namespace parser { namespace states {
                 }
 
                 const auto storageLength = structField.arraySize();
-                detail::appendNode<ast::nodes::DefaultStringValue>(nodeStack, token, structField.type(), storageLength);
+                detail::appendNode<ast::nodes::DefaultStringValue>(context, nodeStack, token, structField.type(), storageLength);
 
                 if((storageLength < 0) || (static_cast<std::size_t>(storageLength) < token.token().value().length() - 2))
                 {
@@ -28,6 +28,36 @@ namespace swizzle { namespace parser { namespace states {
             }
             nodeStack.push(node);
         }
+
+        // set the type of @field, resolving user types to their declaration.
+        // Returns false if @value is not a built in or declared type.
+        bool resolveType(ast::nodes::StructField& field, const boost::string_view& value, const ParserStateContext& context)
+        {
+            if(types::IsIntegerType(value) || types::IsFloatType(value))
+            {
+                field.type(value);
+                return true;
+            }
+
+            auto iter = context.TypeCache.find(value.to_string());
+            if(iter != context.TypeCache.cend())
+            {
+                field.type(value);
+                field.typeDeclaration(iter->second);
+                return true;
+            }
+
+            const auto typeWithNamespace = context.CurrentNamespace + "::" + value.to_string();
+            iter = context.TypeCache.find(typeWithNamespace);
+            if(iter != context.TypeCache.cend())
+            {
+                field.type(typeWithNamespace);
+                field.typeDeclaration(iter->second);
+                return true;
+            }
+
+            return false;
+        }
     }
 
     ParserState StructFieldNamespaceOrTypeState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack&, TokenStack& tokenStack, ParserStateContext& context)
@@ -58,25 +88,8 @@ namespace swizzle { namespace parser { namespace states {
                 utils::clear(tokenStack);
 
                 auto& top = static_cast<ast::nodes::StructField&>(*sf);
-                const auto& value = t.token().value();
-
-                if(types::IsIntegerType(value) || types::IsFloatType(value))
+                if(resolveType(top, t.token().value(), context))
                 {
-                    top.type(value.to_string());
-                    return ParserState::StructStartArray;
-                }
-
-                if(context.TypeCache.find(value.to_string()) != context.TypeCache.cend())
-                {
-                    top.type(value.to_string());
-                    return ParserState::StructStartArray;
-
-                }
-
-                const auto typeWithNamespace = context.CurrentNamespace + "::" + value.to_string();
-                if(context.TypeCache.find(typeWithNamespace) != context.TypeCache.cend())
-                {
-                    top.type(typeWithNamespace);
                     return ParserState::StructStartArray;
                 }
 
@@ -104,24 +117,8 @@ namespace swizzle { namespace parser { namespace states {
                 const auto t = detail::createType(tokenStack);
                 utils::clear(tokenStack);
 
-                const auto& value = t.token().value();
-
-                if(types::IsIntegerType(value) || types::IsFloatType(value))
-                {
-                    top.type(value.to_string());
-                    return ParserState::StructFieldName;
-                }
-
-                if(context.TypeCache.find(value.to_string()) != context.TypeCache.cend())
-                {
-                    top.type(value.to_string());
-                    return ParserState::StructFieldName;
-                }
-
-                const auto typeWithNamespace = context.CurrentNamespace + "::" + value.to_string();
-                if(context.TypeCache.find(typeWithNamespace) != context.TypeCache.cend())
+                if(resolveType(top, t.token().value(), context))
                 {
-                    top.type(typeWithNamespace);
                     return ParserState::StructFieldName;
                 }
 
@@ -1,6 +1,6 @@
 #include <swizzle/parser/states/StructStartScopeState.hpp>
 
-#include <swizzle/ast/Matcher.hpp>
+#include <swizzle/ast/CompiledMatcher.hpp>
 #include <swizzle/ast/nodes/Attribute.hpp>
 #include <swizzle/ast/nodes/AttributeBlock.hpp>
 #include <swizzle/ast/nodes/CharLiteral.hpp>
@@ -26,6 +26,27 @@
 
 namespace swizzle { namespace parser { namespace states {
 
+    namespace {
+
+        // a field belongs to the struct, not to the label ("1:") read before
+        // it, StructFieldNamespaceOrTypeState moves the label into the field
+        ast::Node::smartptr appendField(ParserStateContext& context, NodeStack& nodeStack)
+        {
+            if(!detail::nodeStackTopIs<ast::nodes::FieldLabel>(nodeStack))
+            {
+                return detail::appendNode<ast::nodes::StructField>(context, nodeStack);
+            }
+
+            auto label = nodeStack.top();
+            nodeStack.pop();
+
+            auto field = detail::appendNode<ast::nodes::StructField>(context, nodeStack);
+            nodeStack.push(label);
+
+            return field;
+        }
+    }
+
     ParserState StructStartScopeState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack& attributeStack, TokenStack& tokenStack, ParserStateContext& context)
     {
         const auto type = token.token().type();
@@ -40,7 +61,7 @@ namespace swizzle { namespace parser { namespace states {
             if(type == lexer::TokenType::numeric_literal)
             {
                 equalRead_ = false;
-                detail::appendNode<ast::nodes::NumericLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::NumericLiteral>(context, attributeStack, token);
 
                 return ParserState::StructStartScope;
             }
@@ -48,7 +69,7 @@ namespace swizzle { namespace parser { namespace states {
             if(type == lexer::TokenType::hex_literal)
             {
                 equalRead_ = false;
-                detail::appendNode<ast::nodes::HexLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::HexLiteral>(context, attributeStack, token);
 
                 return ParserState::StructStartScope;
             }
@@ -56,7 +77,7 @@ namespace swizzle { namespace parser { namespace states {
             if(type == lexer::TokenType::char_literal)
             {
                 equalRead_ = false;
-                detail::appendNode<ast::nodes::CharLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::CharLiteral>(context, attributeStack, token);
 
                 return ParserState::StructStartScope;
             }
@@ -64,7 +85,7 @@ namespace swizzle { namespace parser { namespace states {
             if(type == lexer::TokenType::string_literal)
             {
                 equalRead_ = false;
-                detail::appendNode<ast::nodes::StringLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::StringLiteral>(context, attributeStack, token);
 
                 return ParserState::StructStartScope;
             }
@@ -85,7 +106,10 @@ namespace swizzle { namespace parser { namespace states {
                 }
 
                 // we want to attach this to the field
-                nodeStack.push(new ast::nodes::FieldLabel(token));
+                ast::Node::smartptr label = new ast::nodes::FieldLabel(token);
+                context.IndexNode(label);
+
+                nodeStack.push(label);
                 return ParserState::StructFieldLabel;
             }
 
@@ -93,26 +117,29 @@ namespace swizzle { namespace parser { namespace states {
             {
                 if(!attributeStack.empty())
                 {
-                    detail::appendNode<ast::nodes::AttributeBlock>(attributeStack, token);
+                    detail::appendNode<ast::nodes::AttributeBlock>(context, attributeStack, token);
                     return ParserState::StructStartScope;
                 }
             }
 
             if(type == lexer::TokenType::attribute)
             {
-                attributeStack.push(new ast::nodes::Attribute(token));
+                ast::Node::smartptr attribute = new ast::nodes::Attribute(token);
+                context.IndexNode(attribute);
+
+                attributeStack.push(attribute);
                 return ParserState::StructStartScope;
             }
 
             if(type == lexer::TokenType::comment)
             {
-                detail::appendNode<ast::nodes::Comment>(nodeStack, token);
+                detail::appendNode<ast::nodes::Comment>(context, nodeStack, token);
                 return ParserState::StructStartScope;
             }
 
             if(type == lexer::TokenType::multiline_comment)
             {
-                detail::appendNode<ast::nodes::MultilineComment>(nodeStack, token);
+                detail::appendNode<ast::nodes::MultilineComment>(context, nodeStack, token);
                 return ParserState::StructStartScope;
             }
 
@@ -121,7 +148,7 @@ namespace swizzle { namespace parser { namespace states {
                 const auto& value = token.token().value();
                 if(types::IsIntegerType(value) || types::IsFloatType(value))
                 {
-                    auto node = detail::appendNode<ast::nodes::StructField>(nodeStack);
+                    auto node = appendField(context, nodeStack);
                     nodeStack.push(node);
                     tokenStack.push(token);
 
@@ -130,7 +157,7 @@ namespace swizzle { namespace parser { namespace states {
 
                 if(value == "variable_block")
                 {
-                    auto node = detail::appendNode<ast::nodes::VariableBlock>(nodeStack, token);
+                    auto node = detail::appendNode<ast::nodes::VariableBlock>(context, nodeStack, token);
                     nodeStack.push(node);
 
                     return ParserState::StructStartVariableBlock;
@@ -149,7 +176,7 @@ namespace swizzle { namespace parser { namespace states {
                     return ParserState::StructFieldName;
                 }
 
-                auto node = detail::appendNode<ast::nodes::StructField>(nodeStack);
+                auto node = appendField(context, nodeStack);
                 nodeStack.push(node);
                 tokenStack.push(token);
 
@@ -170,11 +197,11 @@ namespace swizzle { namespace parser { namespace states {
             {
                 if(detail::nodeStackTopIs<ast::nodes::Struct>(nodeStack))
                 {
-                    auto hasNonCommentChildren = ast::Matcher().hasChildNotOf<ast::nodes::Comment, ast::nodes::MultilineComment>();
+                    auto hasNonCommentChildren = ast::CompiledMatcher<>().hasChildNotOf<ast::nodes::Comment, ast::nodes::MultilineComment>();
                     if(!hasNonCommentChildren(nodeStack.top()))
                     {
                         const auto& top = static_cast<ast::nodes::Struct&>(*nodeStack.top());
-                        throw SyntaxError("Enum must have fields", "no fields declared in '" + top.name() + "'", token.fileInfo());
+                        throw SyntaxError("Enum must have fields", "no fields declared in '" + top.name().to_string() + "'", token.fileInfo());
                     }
 
                     nodeStack.pop();
@@ -1,7 +1,7 @@
 #include <swizzle/parser/states/StructVariableBlockBeginCasesState.hpp>
 
 #include <swizzle/Exceptions.hpp>
-#include <swizzle/ast/Matcher.hpp>
+#include <swizzle/ast/CompiledMatcher.hpp>
 #include <swizzle/ast/nodes/Comment.hpp>
 #include <swizzle/ast/nodes/MultilineComment.hpp>
 #include <swizzle/ast/nodes/VariableBlockCase.hpp>
@@ -13,25 +13,25 @@
 
 namespace swizzle { namespace parser { namespace states {
 
-    ParserState StructVariableBlockBeginCasesState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack&, TokenStack&, ParserStateContext&)
+    ParserState StructVariableBlockBeginCasesState::consume(const lexer::TokenInfo& token, NodeStack& nodeStack, NodeStack&, TokenStack&, ParserStateContext& context)
     {
         const auto type = token.token().type();
 
         if(type == lexer::TokenType::comment)
         {
-            detail::appendNode<ast::nodes::Comment>(nodeStack, token);
+            detail::appendNode<ast::nodes::Comment>(context, nodeStack, token);
             return ParserState::StructVariableBlockBeginCases;
         }
 
         if(type == lexer::TokenType::multiline_comment)
         {
-            detail::appendNode<ast::nodes::MultilineComment>(nodeStack, token);
+            detail::appendNode<ast::nodes::MultilineComment>(context, nodeStack, token);
             return ParserState::StructVariableBlockBeginCases;
         }
 
         if((type == lexer::TokenType::keyword) && (token.token().value() == "case"))
         {
-            auto node = detail::appendNode<ast::nodes::VariableBlockCase>(nodeStack);
+            auto node = detail::appendNode<ast::nodes::VariableBlockCase>(context, nodeStack);
             nodeStack.push(node);
 
             return ParserState::StructVariableBlockCaseValue;
@@ -41,7 +41,7 @@ namespace swizzle { namespace parser { namespace states {
         {
             const auto& top = nodeStack.top();
 
-            auto hasNonCommentChildren = ast::Matcher().hasChildNotOf<ast::nodes::Comment, ast::nodes::MultilineComment>();
+            auto hasNonCommentChildren = ast::CompiledMatcher<>().hasChildNotOf<ast::nodes::Comment, ast::nodes::MultilineComment>();
             if(!hasNonCommentChildren(top))
             {
                 throw SyntaxError("Expected variable block cases", " empty variable block", token.fileInfo());
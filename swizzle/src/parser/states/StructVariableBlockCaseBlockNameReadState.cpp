@@ -38,7 +38,7 @@ namespace swizzle { namespace parser { namespace states {
                 throw SyntaxError("Variable block case type must be defined, ", structTypeString + " not defined", token.fileInfo());
             }
 
-            const auto isStruct = dynamic_cast<ast::nodes::Struct*>(iter->second.get());
+            const auto isStruct = dynamic_cast<ast::nodes::Struct*>(iter->second);
             if(!isStruct)
             {
                 throw SyntaxError("Variable block case type must be a struct, ", structTypeString + " is not a struct", token.fileInfo());
@@ -49,6 +49,7 @@ namespace swizzle { namespace parser { namespace states {
             {
                 auto& blockCase = static_cast<ast::nodes::VariableBlockCase&>(*nodeStack.top());
                 blockCase.type(structType);
+                blockCase.typeDeclaration(iter->second);
 
                 nodeStack.pop();
                 utils::clear(tokenStack);
@@ -36,50 +36,53 @@ namespace swizzle { namespace parser { namespace states {
 
             if(type == lexer::TokenType::char_literal)
             {
-                detail::appendNode<ast::nodes::CharLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::CharLiteral>(context, attributeStack, token);
                 return ParserState::TranslationUnitMain;
             }
 
             if(type == lexer::TokenType::string_literal)
             {
-                detail::appendNode<ast::nodes::StringLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::StringLiteral>(context, attributeStack, token);
                 return ParserState::TranslationUnitMain;
             }
 
             if(type == lexer::TokenType::hex_literal)
             {
-                detail::appendNode<ast::nodes::HexLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::HexLiteral>(context, attributeStack, token);
                 return ParserState::TranslationUnitMain;
             }
 
             if(type == lexer::TokenType::numeric_literal)
             {
-                detail::appendNode<ast::nodes::NumericLiteral>(attributeStack, token);
+                detail::appendNode<ast::nodes::NumericLiteral>(context, attributeStack, token);
                 return ParserState::TranslationUnitMain;
             }
 
             if(type == lexer::TokenType::attribute_block)
             {
-                detail::appendNode<ast::nodes::AttributeBlock>(attributeStack, token);
+                detail::appendNode<ast::nodes::AttributeBlock>(context, attributeStack, token);
                 return ParserState::TranslationUnitMain;
             }
         }
 
         if(type == lexer::TokenType::attribute)
         {
-            attributeStack.push(new ast::nodes::Attribute(token));
+            ast::Node::smartptr attribute = new ast::nodes::Attribute(token);
+            context.IndexNode(attribute);
+
+            attributeStack.push(attribute);
             return ParserState::TranslationUnitMain;
         }
 
         if(type == lexer::TokenType::comment)
         {
-            detail::appendNode<ast::nodes::Comment>(nodeStack, token);
+            detail::appendNode<ast::nodes::Comment>(context, nodeStack, token);
             return ParserState::TranslationUnitMain;
         }
 
         if(type == lexer::TokenType::multiline_comment)
         {
-            detail::appendNode<ast::nodes::MultilineComment>(nodeStack, token);
+            detail::appendNode<ast::nodes::MultilineComment>(context, nodeStack, token);
             return ParserState::TranslationUnitMain;
         }
 
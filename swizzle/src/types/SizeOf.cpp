@@ -0,0 +1,30 @@
+#include <swizzle/types/SizeOf.hpp>
+
+#include <limits>
+
+namespace swizzle { namespace types {
+
+    std::size_t SizeOf(const boost::string_view& type)
+    {
+        if((type == "u8") || (type == "i8")) return 1;
+        if((type == "u16") || (type == "i16")) return 2;
+        if((type == "u32") || (type == "i32") || (type == "f32")) return 4;
+        if((type == "u64") || (type == "i64") || (type == "f64")) return 8;
+
+        return 0;
+    }
+
+    std::uint64_t MaxValueOf(const boost::string_view& type)
+    {
+        if(type == "u8") return std::numeric_limits<std::uint8_t>::max();
+        if(type == "i8") return std::numeric_limits<std::int8_t>::max();
+        if(type == "u16") return std::numeric_limits<std::uint16_t>::max();
+        if(type == "i16") return std::numeric_limits<std::int16_t>::max();
+        if(type == "u32") return std::numeric_limits<std::uint32_t>::max();
+        if(type == "i32") return std::numeric_limits<std::int32_t>::max();
+        if(type == "u64") return std::numeric_limits<std::uint64_t>::max();
+        if(type == "i64") return std::numeric_limits<std::int64_t>::max();
+
+        return 0;
+    }
+}}
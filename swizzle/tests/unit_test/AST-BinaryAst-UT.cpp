@@ -0,0 +1,203 @@
+#include "./ut_support/UnitTestSupport.hpp"
+#include "./ut_support/TemporaryDirectory.hpp"
+
+#include <swizzle/Exceptions.hpp>
+#include <swizzle/ast/binary/BinaryAst.hpp>
+#include <swizzle/ast/binary/MappedBinaryAst.hpp>
+#include <swizzle/ast/binary/Serialize.hpp>
+
+#include <swizzle/lexer/Tokenizer.hpp>
+#include <swizzle/parser/Parser.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/utility/string_view.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+    using namespace swizzle::ast;
+    using namespace swizzle::ast::binary;
+    using namespace swizzle::lexer;
+    using namespace swizzle::parser;
+
+    struct CreateTokenCallback
+    {
+        CreateTokenCallback(std::deque<TokenInfo>& tokens)
+            : tokens_(tokens)
+        {
+        }
+
+        void operator()(const TokenInfo& token)
+        {
+            tokens_.push_back(token);
+        }
+
+    private:
+        std::deque<TokenInfo>& tokens_;
+    };
+
+    struct BinaryAstFixture
+    {
+        BinaryAstFixture()
+        {
+            for(std::size_t position = 0, end = sv.length(); position < end; ++position)
+            {
+                tokenizer.consume(sv, position);
+            }
+
+            tokenizer.flush();
+
+            for(const auto& token : tokens)
+            {
+                parser.consume(token);
+            }
+
+            parser.finalize();
+        }
+
+        // the binary tree must have the same shape and kinds as @node
+        bool sameShape(Node& node, const BinaryNode& binary)
+        {
+            if((node.kind() != binary.kind()) || (node.children().size() != binary.childCount()))
+            {
+                return false;
+            }
+
+            for(std::size_t i = 0, end = binary.childCount(); i < end; ++i)
+            {
+                if(!sameShape(*node.children()[i], binary.child(i)))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // first node of @kind, breadth first
+        BinaryNode find(const BinaryAst& ast, const NodeKind kind)
+        {
+            for(std::uint32_t i = 0, end = static_cast<std::uint32_t>(ast.size()); i < end; ++i)
+            {
+                if(ast.node(i).kind() == kind)
+                {
+                    return ast.node(i);
+                }
+            }
+
+            return ast.root();
+        }
+
+        const boost::string_view sv = boost::string_view(
+            "namespace foo;" "\n"
+            "enum Metal : u8 {" "\n"
+            "\t" "iron," "\n"
+            "\t" "copper = 5," "\n"
+            "}" "\n"
+            "bitfield Flags : u8 {" "\n"
+            "\t" "f1 : 0," "\n"
+            "\t" "f2 : 1..3," "\n"
+            "}" "\n"
+            "struct First {" "\n"
+            "\t" "const u8 count;" "\n"
+            "\t" "Metal metal;" "\n"
+            "\t" "u8[10] name;" "\n"
+            "\t" "u16[count] values;" "\n"
+            "}"
+        );
+
+        std::deque<TokenInfo> tokens;
+        CreateTokenCallback callback = CreateTokenCallback(tokens);
+        Tokenizer<CreateTokenCallback> tokenizer = Tokenizer<CreateTokenCallback>("test.swizzle", callback);
+
+        Parser parser;
+    };
+
+    TEST_FIXTURE(BinaryAstFixture, verifyRoundTripShape)
+    {
+        const auto buffer = serialize(parser.ast());
+        const BinaryAst ast(buffer.data(), buffer.size());
+
+        CHECK_EQUAL("test.swizzle", ast.filename());
+        CHECK_EQUAL(NodeKind::Node, ast.root().kind());
+        CHECK(sameShape(*parser.ast().root(), ast.root()));
+    }
+
+    TEST_FIXTURE(BinaryAstFixture, verifyNodeFields)
+    {
+        const auto buffer = serialize(parser.ast());
+        const BinaryAst ast(buffer.data(), buffer.size());
+
+        const auto metal = find(ast, NodeKind::Enum);
+        CHECK_EQUAL("foo::Metal", metal.text());
+        CHECK_EQUAL("u8", metal.type());
+        CHECK_EQUAL(2U, metal.line());
+
+        REQUIRE CHECK_EQUAL(2U, metal.childCount());
+        CHECK_EQUAL("copper", metal.child(1).text());
+        CHECK_EQUAL(5, metal.child(1).value());
+
+        const auto flags = find(ast, NodeKind::Bitfield);
+        REQUIRE CHECK_EQUAL(2U, flags.childCount());
+        CHECK_EQUAL("f2", flags.child(1).text());
+        CHECK_EQUAL(1, flags.child(1).value());
+        CHECK_EQUAL(3, flags.child(1).value2());
+
+        const auto first = find(ast, NodeKind::Struct);
+        CHECK_EQUAL("foo::First", first.text());
+        REQUIRE CHECK_EQUAL(4U, first.childCount());
+
+        CHECK_EQUAL("count", first.child(0).text());
+        CHECK_EQUAL(11U, first.child(0).line());
+
+        CHECK_EQUAL("foo::Metal", first.child(1).type());
+
+        const auto name = first.child(2);
+        CHECK(name.isArray());
+        CHECK_EQUAL(10, name.value());
+
+        const auto values = first.child(3);
+        CHECK(values.isVector());
+        CHECK_EQUAL("u16", values.type());
+        CHECK_EQUAL("count", values.aux());
+    }
+
+    TEST_FIXTURE(BinaryAstFixture, verifyRejectsInvalidBuffers)
+    {
+        auto buffer = serialize(parser.ast());
+
+        CHECK_THROW(BinaryAst(buffer.data(), sizeof(Header) - 1), swizzle::InvalidBinaryAst);
+        CHECK_THROW(BinaryAst(buffer.data(), buffer.size() - 1), swizzle::InvalidBinaryAst);
+
+        auto badMagic = buffer;
+        badMagic[0] = 'X';
+        CHECK_THROW(BinaryAst(badMagic.data(), badMagic.size()), swizzle::InvalidBinaryAst);
+
+        // point the root's children at itself
+        auto badChild = buffer;
+        auto& root = *reinterpret_cast<NodeRecord*>(badChild.data() + sizeof(Header));
+        root.firstChild = 0;
+        CHECK_THROW(BinaryAst(badChild.data(), badChild.size()), swizzle::InvalidBinaryAst);
+    }
+
+    TEST_FIXTURE(BinaryAstFixture, verifyMappedFile)
+    {
+        const TemporaryDirectory directory;
+        const auto path = directory.root / "ast.swzast";
+
+        {
+            std::ofstream os(path.string(), std::ios::binary);
+            serialize(parser.ast(), os);
+        }
+
+        {
+            const MappedBinaryAst mapped(path);
+            CHECK(sameShape(*parser.ast().root(), mapped.ast().root()));
+            CHECK_EQUAL("foo::First", find(mapped.ast(), NodeKind::Struct).text());
+        }
+    }
+}
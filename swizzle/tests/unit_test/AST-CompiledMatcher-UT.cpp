@@ -0,0 +1,152 @@
+#include "./ut_support/UnitTestSupport.hpp"
+
+#include <swizzle/ast/AbstractSyntaxTree.hpp>
+#include <swizzle/ast/CompiledMatcher.hpp>
+#include <swizzle/ast/Node.hpp>
+#include <swizzle/ast/nodes/Comment.hpp>
+#include <swizzle/ast/nodes/MultilineComment.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/lexer/TokenInfo.hpp>
+#include <swizzle/parser/detail/AppendNode.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace {
+
+    using namespace swizzle::ast;
+    using namespace swizzle::lexer;
+    using namespace swizzle::parser;
+
+    struct CompiledMatcherFixture
+    {
+        CompiledMatcherFixture()
+        {
+            nodeStack.emplace(ast.root());
+
+            detail::appendNode<nodes::Comment>(nodeStack, comment);
+
+            auto node = detail::appendNode<nodes::Struct>(nodeStack, keyword, name, "my_namespace");
+            nodeStack.push(node);
+
+            detail::appendNode<nodes::Comment>(nodeStack, comment);
+
+            node = detail::appendNode<nodes::StructField>(nodeStack);
+            static_cast<nodes::StructField&>(*node).name(TokenInfo(Token("field1", 0, 6, TokenType::string), FileInfo("test.swizzle")));
+
+            node = detail::appendNode<nodes::StructField>(nodeStack);
+            static_cast<nodes::StructField&>(*node).name(TokenInfo(Token("field2", 0, 6, TokenType::string), FileInfo("test.swizzle")));
+
+            nodeStack.pop();
+        }
+
+        const TokenInfo comment = TokenInfo(Token("// comment", 0, 10, TokenType::comment), FileInfo("test.swizzle"));
+        const TokenInfo keyword = TokenInfo(Token("struct", 0, 6, TokenType::keyword), FileInfo("test.swizzle"));
+        const TokenInfo name = TokenInfo(Token("MyStruct", 0, 8, TokenType::string), FileInfo("test.swizzle"));
+
+        AbstractSyntaxTree ast;
+        NodeStack nodeStack;
+    };
+
+    TEST_FIXTURE(CompiledMatcherFixture, verifyIsTypeOf)
+    {
+        auto m = CompiledMatcher<>().isTypeOf<nodes::Comment, nodes::MultilineComment>();
+
+        const auto& children = ast.root()->children();
+        CHECK(m(children[0]));
+        CHECK(!m(children[1]));
+        CHECK(!m(ast));
+
+        auto n = CompiledMatcher<>().isNotTypeOf<nodes::Comment, nodes::MultilineComment>();
+        CHECK(!n(children[0]));
+        CHECK(n(children[1]));
+    }
+
+    TEST_FIXTURE(CompiledMatcherFixture, verifyHasChildNotOf)
+    {
+        auto m = CompiledMatcher<>().hasChildNotOf<nodes::Comment, nodes::MultilineComment>();
+        CHECK(m(ast));
+
+        auto node = ast.root()->children()[0];
+        CHECK(!m(node));
+    }
+
+    TEST_FIXTURE(CompiledMatcherFixture, verifyBoundSlots)
+    {
+        auto m = CompiledMatcher<>().isTypeOf<nodes::Struct>().bind().hasFieldNamed("field2").bind();
+
+        static_assert(std::is_same<decltype(m.bound<0>()), nodes::Struct* const&>::value, "single type binds a typed pointer");
+        static_assert(std::is_same<decltype(m.bound<1>()), Node* const&>::value, "hasFieldNamed binds a Node pointer");
+
+        const auto& structure = ast.root()->children()[1];
+        REQUIRE CHECK(m(structure));
+
+        CHECK_EQUAL(structure.get(), m.bound<0>());
+        CHECK_EQUAL("my_namespace::MyStruct", m.bound<0>()->name());
+
+        REQUIRE CHECK(m.bound<1>() != nullptr);
+        CHECK_EQUAL(structure->children()[2].get(), m.bound<1>());
+
+        auto none = CompiledMatcher<>().isTypeOf<nodes::Struct>().hasFieldNamed("field3");
+        CHECK(!none(structure));
+    }
+
+    TEST_FIXTURE(CompiledMatcherFixture, verifyGetChildrenOf)
+    {
+        auto m = CompiledMatcher<>().isTypeOf<nodes::Struct>().getChildrenOf<nodes::StructField>().bind();
+        REQUIRE CHECK(m(ast.root()->children()[1]));
+
+        const auto& fields = m.bound<0>();
+        CHECK_EQUAL(2U, fields.size());
+
+        std::size_t count = 0;
+        for(nodes::StructField* field : fields)
+        {
+            CHECK_EQUAL(count == 0 ? "field1" : "field2", field->name().token().to_string());
+            count++;
+        }
+
+        CHECK_EQUAL(2U, count);
+
+        auto none = CompiledMatcher<>().getChildrenOf<nodes::MultilineComment>();
+        CHECK(!none(ast));
+    }
+
+    TEST_FIXTURE(CompiledMatcherFixture, verifyFindAllWalksUnindexedTree)
+    {
+        CHECK_EQUAL(0U, ast.index().size());
+
+        std::size_t found = 0;
+        auto m = CompiledMatcher<>().isTypeOf<nodes::StructField>().bind();
+
+        const auto count = m.findAll(ast, [&found](const decltype(m)& matcher) {
+            CHECK(matcher.bound<0>() != nullptr);
+            found++;
+        });
+
+        CHECK_EQUAL(2U, count);
+        CHECK_EQUAL(2U, found);
+    }
+
+    TEST_FIXTURE(CompiledMatcherFixture, verifyFindAllUsesIndex)
+    {
+        // only the second field is indexed, the query must come from the index
+        const auto& fields = ast.root()->children()[1]->children();
+        ast.index().insert(fields[2]);
+
+        Node* found = nullptr;
+        auto m = CompiledMatcher<>().isTypeOf<nodes::StructField>().bind();
+
+        const auto count = m.findAll(ast, [&found](const decltype(m)& matcher) {
+            found = matcher.bound<0>();
+        });
+
+        CHECK_EQUAL(1U, count);
+        CHECK_EQUAL(fields[2].get(), found);
+
+        // a leading hasChild is not indexable, so the tree is walked
+        auto all = CompiledMatcher<>().hasChild();
+        CHECK_EQUAL(2U, all.findAll(ast, [](const decltype(all)&) {}));
+    }
+}
@@ -185,4 +185,33 @@ namespace {
         auto node = detail::appendNode<nodes::Struct>(nodeStack, info, TokenInfo(Token("MyStruct", 0, 8, TokenType::string), FileInfo("test.swizzle")), "my_namespace");
         CHECK(!m(node));
     }
+
+    TEST_FIXTURE(StructHasMemberNamedFixture, verifyFindAllWalksUnindexedTree)
+    {
+        CHECK_EQUAL(0U, ast.index().size());
+
+        const auto fields = Matcher().isTypeOf<nodes::StructField>().findAll(ast);
+        CHECK_EQUAL(3U, fields.size());
+
+        const auto structs = Matcher().isTypeOf<nodes::Struct>().hasFieldNamed("field2").findAll(ast);
+        CHECK_EQUAL(1U, structs.size());
+
+        const auto none = Matcher().isTypeOf<nodes::Struct>().hasFieldNamed("field4").findAll(ast);
+        CHECK_EQUAL(0U, none.size());
+    }
+
+    TEST_FIXTURE(StructHasMemberNamedFixture, verifyFindAllUsesIndex)
+    {
+        // only the second field is indexed, the query must come from the index
+        const auto& fields = ast.root()->children()[0]->children();
+        ast.index().insert(fields[1]);
+
+        const auto found = Matcher().isTypeOf<nodes::StructField>().findAll(ast);
+        REQUIRE CHECK_EQUAL(1U, found.size());
+        CHECK_EQUAL(fields[1].get(), found[0].get());
+
+        // isTypeOf<Node> has no NodeKind, so the tree is walked
+        const auto all = Matcher().isTypeOf<Node>().findAll(ast);
+        CHECK_EQUAL(5U, all.size());
+    }
 }
@@ -0,0 +1,118 @@
+#include "./ut_support/UnitTestSupport.hpp"
+
+#include <swizzle/ast/AbstractSyntaxTree.hpp>
+#include <swizzle/ast/StaticVisitor.hpp>
+#include <swizzle/ast/nodes/Comment.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/VariableBlockCase.hpp>
+
+#include <swizzle/lexer/TokenInfo.hpp>
+#include <swizzle/parser/detail/AppendNode.hpp>
+#include <swizzle/parser/NodeStack.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <string>
+
+namespace {
+
+    using namespace swizzle::ast;
+    using namespace swizzle::lexer;
+    using namespace swizzle::parser;
+
+    class StructVisitor : public StaticVisitor<StructVisitor>
+    {
+    public:
+        void operator()(nodes::Struct& node) { structs.push_back(node.name().to_string()); }
+        void operator()(nodes::StructField&) { structField++; }
+
+    public:
+        std::deque<std::string> structs;
+        std::size_t structField = 0;
+    };
+
+    class CatchAllVisitor : public StaticVisitor<CatchAllVisitor>
+    {
+    public:
+        void operator()(Node&) { node++; }
+        void operator()(nodes::Comment&) { comment++; }
+
+    public:
+        std::size_t node = 0;
+        std::size_t comment = 0;
+    };
+
+    struct StaticVisitorFixture
+    {
+        StaticVisitorFixture()
+        {
+            nodeStack.push(ast.root());
+
+            detail::appendNode<nodes::Comment>(nodeStack, comment);
+
+            auto node = detail::appendNode<nodes::Struct>(nodeStack, keyword, name, "my_namespace");
+            nodeStack.push(node);
+
+            detail::appendNode<nodes::Comment>(nodeStack, comment);
+            detail::appendNode<nodes::StructField>(nodeStack);
+            detail::appendNode<nodes::StructField>(nodeStack);
+            nodeStack.pop();
+
+            detail::appendNode<nodes::Struct>(nodeStack, keyword, name2, "my_namespace");
+            detail::appendNode<nodes::VariableBlockCase>(nodeStack);
+        }
+
+        const TokenInfo comment = TokenInfo(Token("// comment", 0, 10, TokenType::comment), FileInfo("test.swizzle"));
+        const TokenInfo keyword = TokenInfo(Token("struct", 0, 6, TokenType::keyword), FileInfo("test.swizzle"));
+        const TokenInfo name = TokenInfo(Token("MyStruct", 0, 8, TokenType::string), FileInfo("test.swizzle"));
+        const TokenInfo name2 = TokenInfo(Token("MyOtherStruct", 0, 13, TokenType::string), FileInfo("test.swizzle"));
+
+        AbstractSyntaxTree ast;
+        NodeStack nodeStack;
+    };
+
+    TEST_FIXTURE(StaticVisitorFixture, verifyNodeKinds)
+    {
+        CHECK_EQUAL(NodeKind::Node, ast.root()->kind());
+
+        const auto& children = ast.root()->children();
+        REQUIRE CHECK_EQUAL(4U, children.size());
+
+        CHECK_EQUAL(NodeKind::Comment, children[0]->kind());
+        CHECK_EQUAL(NodeKind::Struct, children[1]->kind());
+        CHECK_EQUAL(NodeKind::Struct, children[2]->kind());
+        CHECK_EQUAL(NodeKind::VariableBlockCase, children[3]->kind());
+    }
+
+    TEST_FIXTURE(StaticVisitorFixture, verifyVisitOnlyHandledKinds)
+    {
+        StructVisitor visitor;
+        visitor.visit(ast);
+
+        REQUIRE CHECK_EQUAL(2U, visitor.structs.size());
+        CHECK_EQUAL("my_namespace::MyStruct", visitor.structs[0]);
+        CHECK_EQUAL("my_namespace::MyOtherStruct", visitor.structs[1]);
+
+        CHECK_EQUAL(2U, visitor.structField);
+    }
+
+    TEST_FIXTURE(StaticVisitorFixture, verifyOverloadResolution)
+    {
+        CatchAllVisitor visitor;
+        visitor.visit(ast);
+
+        // root, 2 structs, 2 struct fields and the variable block case
+        CHECK_EQUAL(6U, visitor.node);
+        CHECK_EQUAL(2U, visitor.comment);
+    }
+
+    TEST_FIXTURE(StaticVisitorFixture, verifyDispatchDoesNotDescend)
+    {
+        StructVisitor visitor;
+        visitor.dispatch(*ast.root()->children()[1]);
+
+        CHECK_EQUAL(1U, visitor.structs.size());
+        CHECK_EQUAL(0U, visitor.structField);
+    }
+}
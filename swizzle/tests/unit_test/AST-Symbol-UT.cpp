@@ -0,0 +1,54 @@
+#include "./ut_support/UnitTestSupport.hpp"
+
+#include <swizzle/ast/Symbol.hpp>
+
+#include <string>
+
+namespace {
+
+    using namespace swizzle::ast;
+
+    TEST(verifyDefaultIsEmpty)
+    {
+        const Symbol symbol;
+        CHECK(symbol.empty());
+        CHECK(symbol == Symbol::intern(""));
+    }
+
+    TEST(verifyInternReturnsSameHandle)
+    {
+        const std::string value = "foo::MyStruct";
+
+        const auto a = Symbol::intern("foo::MyStruct");
+        const auto b = Symbol::intern(value);
+        const auto c = Symbol::intern("foo::MyOtherStruct");
+
+        CHECK(a == b);
+        CHECK(a != c);
+        CHECK_EQUAL(a.hash(), b.hash());
+
+        // the handle does not view the caller's storage
+        CHECK(a.view().data() != value.data());
+        CHECK_EQUAL("foo::MyStruct", a.view());
+        CHECK_EQUAL(value, a.str());
+    }
+
+    TEST(verifyLastSymbolFreesString)
+    {
+        const auto before = Symbol::poolSize();
+
+        {
+            const auto a = Symbol::intern("foo::Transient");
+            CHECK_EQUAL(before + 1, Symbol::poolSize());
+
+            auto b = Symbol::intern("foo::Transient");
+            const auto c = b;
+            b = Symbol();
+
+            CHECK(a == c);
+            CHECK_EQUAL(before + 1, Symbol::poolSize());
+        }
+
+        CHECK_EQUAL(before, Symbol::poolSize());
+    }
+}
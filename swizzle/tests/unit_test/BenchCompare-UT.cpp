@@ -0,0 +1,109 @@
+#include "./ut_support/UnitTestSupport.hpp"
+
+#include <swizzle/bench/Compare.hpp>
+#include <swizzle/bench/Results.hpp>
+#include <swizzle/bench/Statistics.hpp>
+#include <swizzle/Exceptions.hpp>
+
+#include <cmath>
+#include <sstream>
+
+namespace {
+
+    using namespace swizzle;
+    using namespace swizzle::bench;
+
+    Results results(const std::string& benchmark, const std::vector<double>& samples, const std::string& build = "gcc, optimized", const SchemaOptions& schema = SchemaOptions())
+    {
+        Results r(build, schema);
+        for(const auto sample : samples)
+        {
+            r.add(benchmark, sample);
+        }
+
+        return r;
+    }
+
+    TEST(verifyMedianInterval)
+    {
+        const auto small = medianInterval({ 5, 1, 3 });
+        CHECK_EQUAL(1, small.Low);
+        CHECK_EQUAL(5, small.High);
+
+        // ranks 2 and 9 of 10
+        const auto interval = medianInterval({ 10, 1, 9, 2, 8, 3, 7, 4, 6, 5 });
+        CHECK_EQUAL(2, interval.Low);
+        CHECK_EQUAL(9, interval.High);
+    }
+
+    TEST(verifyResultsRoundTrip)
+    {
+        SchemaOptions schema;
+        schema.Files = 16;
+        schema.ImportFanOut = 2;
+        schema.Seed = 7;
+
+        auto written = results("lexer_mb_per_second", { 1.5, 2.5 }, "clang 10.0.0, optimized, NDEBUG", schema);
+        written.add("ast_bytes_per_node", 100);
+
+        std::stringstream json;
+        written.printJson(json);
+
+        const auto read = readResults(json);
+        CHECK(written.samples() == read.samples());
+        CHECK_EQUAL(written.build(), read.build());
+        CHECK(written.schema() == read.schema());
+    }
+
+    TEST(verifyMedianOnlyResults)
+    {
+        std::istringstream json("{ \"benchmarks\": { \"a_per_second\": { \"median\": 4 } } }");
+
+        const auto read = readResults(json);
+        CHECK_EQUAL(1U, read.samples().at("a_per_second").size());
+        CHECK_EQUAL(4, read.samples().at("a_per_second").front());
+    }
+
+    TEST(verifyMalformedResultsThrow)
+    {
+        std::istringstream truncated("{ \"benchmarks\": { \"a\": { \"median\": ");
+        CHECK_THROW(readResults(truncated), InvalidBenchmarkResults);
+
+        std::istringstream missing("{ \"schema\": {} }");
+        CHECK_THROW(readResults(missing), InvalidBenchmarkResults);
+    }
+
+    TEST(verifyRegression)
+    {
+        const auto baseline = results("parser_tokens_per_second", { 100, 100, 100 });
+
+        const auto noise = compare(baseline, results("parser_tokens_per_second", { 85, 92, 95 }), 0.10);
+        CHECK_EQUAL(1U, noise.size());
+        CHECK(!regressed(noise));
+
+        const auto slower = compare(baseline, results("parser_tokens_per_second", { 70, 75, 80 }), 0.10);
+        CHECK(regressed(slower));
+        CHECK(std::abs(slower.front().Change + 0.25) < 1e-9);
+    }
+
+    TEST(verifyIncomparableBaselineRefused)
+    {
+        const auto current = results("parser_tokens_per_second", { 100 });
+
+        CHECK_THROW(compare(results("parser_tokens_per_second", { 100 }, "gcc, unoptimized"), current, 0.10), IncomparableBenchmarkResults);
+
+        SchemaOptions larger;
+        larger.Files = 16;
+        CHECK_THROW(compare(results("parser_tokens_per_second", { 100 }, "gcc, optimized", larger), current, 0.10), IncomparableBenchmarkResults);
+
+        // recorded before results carried their build
+        std::istringstream json("{ \"schema\": { \"files\": 1 }, \"benchmarks\": { \"parser_tokens_per_second\": { \"median\": 100 } } }");
+        CHECK_THROW(compare(readResults(json), current, 0.10), IncomparableBenchmarkResults);
+    }
+
+    TEST(verifyOnlyThroughputCompared)
+    {
+        const auto baseline = results("ast_bytes_per_node", { 100 });
+        CHECK(compare(baseline, results("ast_bytes_per_node", { 500 }), 0.10).empty());
+    }
+}
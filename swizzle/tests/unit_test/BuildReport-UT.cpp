@@ -0,0 +1,87 @@
+#include "./ut_support/UnitTestSupport.hpp"
+#include "./ut_support/TemporaryDirectory.hpp"
+
+#include <swizzle/driver/BuildReport.hpp>
+#include <swizzle/driver/Driver.hpp>
+#include <swizzle/driver/PhaseTimer.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <sstream>
+#include <string>
+
+namespace {
+
+    using namespace swizzle::ast;
+    using namespace swizzle::driver;
+
+    struct BuildReportFixture : public TemporaryDirectory
+    {
+        BuildReportFixture()
+        {
+            write("foo/Base.swizzle", "namespace foo;\nstruct Base {\n\tu8 a;\n\tu16 b;\n}\n");
+
+            DriverOptions options;
+            options.ImportRoot = root;
+
+            const auto modules = Driver(options).compile({ root / "foo/Base.swizzle" });
+            for(const auto& module : modules)
+            {
+                report.add(*module.second);
+            }
+        }
+
+        BuildReport report;
+    };
+
+    TEST_FIXTURE(BuildReportFixture, verifyCounts)
+    {
+        CHECK_EQUAL(1U, report.files());
+        CHECK(report.tokens() > 0);
+        CHECK_EQUAL(1U, report.nodes(NodeKind::Struct));
+        CHECK_EQUAL(2U, report.nodes(NodeKind::StructField));
+        CHECK(report.phase(Phase::Lex).WallSeconds > 0);
+        CHECK(report.phase(Phase::Parse).WallSeconds > 0);
+    }
+
+    TEST_FIXTURE(BuildReportFixture, verifyTable)
+    {
+        std::ostringstream os;
+        report.print(os, BuildReport::Sections());
+
+        CHECK(os.str().find("Time report") != std::string::npos);
+        CHECK(os.str().find("StructField") != std::string::npos);
+    }
+
+    TEST_FIXTURE(BuildReportFixture, verifyJsonSections)
+    {
+        BuildReport::Sections sections;
+        sections.Memory = false;
+
+        std::ostringstream os;
+        report.printJson(os, sections);
+
+        CHECK(os.str().find("\"tokens_per_second\"") != std::string::npos);
+        CHECK(os.str().find("\"wall_seconds\"") != std::string::npos);
+        CHECK(os.str().find("\"node_kinds\"") == std::string::npos);
+    }
+
+    TEST(verifyPhaseTimerAccumulates)
+    {
+        PhaseStats stats;
+
+        {
+            PhaseTimer timer(stats);
+        }
+
+        const auto first = stats.WallSeconds;
+        CHECK(first >= 0);
+
+        {
+            PhaseTimer timer(stats);
+            std::string s(1024, 'x');
+        }
+
+        CHECK(stats.WallSeconds >= first);
+    }
+}
@@ -0,0 +1,151 @@
+#include "./ut_support/UnitTestSupport.hpp"
+#include "./ut_support/TemporaryDirectory.hpp"
+
+#include <swizzle/ast/Symbol.hpp>
+#include <swizzle/driver/CompileServer.hpp>
+
+#include <boost/asio.hpp>
+#include <boost/filesystem.hpp>
+
+#include <chrono>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+    using namespace swizzle::driver;
+
+    struct CompileServerFixture : public TemporaryDirectory
+    {
+        CompileServerFixture()
+            : socket(root / "swizzle.sock")
+        {
+            options.ImportRoot = root;
+            options.CacheSize = 16;
+
+            write("foo/Base.swizzle", "namespace foo;\nstruct Base {\n\tu8 a;\n}\n");
+            write("foo/Bad.swizzle", "namespace foo;\nstruct Bad {\n\tfoo::Missing a;\n}\n");
+
+            server.reset(new CompileServer(options, socket, std::chrono::milliseconds(200)));
+            thread = std::thread([this]{ server->run(); });
+        }
+
+        ~CompileServerFixture()
+        {
+            sendShutdown(socket);
+            thread.join();
+            server.reset();
+        }
+
+        const boost::filesystem::path socket;
+
+        DriverOptions options;
+        std::unique_ptr<CompileServer> server;
+        std::thread thread;
+    };
+
+    TEST_FIXTURE(CompileServerFixture, verifyCompile)
+    {
+        Command command;
+        command.Files = { root / "foo/Base.swizzle" };
+        command.EmitAst = root / "out";
+
+        std::ostringstream errors;
+        CHECK(sendCommand(socket, command, errors));
+        CHECK_EQUAL("", errors.str());
+        CHECK(boost::filesystem::exists(root / "out/foo/Base.swzast"));
+
+        // second request is served from the warm cache
+        CHECK(sendCommand(socket, command, errors));
+        CHECK_EQUAL(1U, server->driver().cache().size());
+    }
+
+    TEST_FIXTURE(CompileServerFixture, verifyOnlyChangedModulesEmitted)
+    {
+        write("foo/Derived.swizzle", "import foo::Base;\nnamespace foo;\nstruct Derived {\n\tfoo::Base base;\n}\n");
+
+        Command command;
+        command.Files = { root / "foo/Derived.swizzle" };
+        command.EmitAst = root / "out";
+
+        std::ostringstream errors;
+        REQUIRE CHECK(sendCommand(socket, command, errors));
+
+        // Derived is reused from the cache, its output is left as it is
+        write("out/foo/Derived.swzast", "unchanged");
+        write("foo/Base.swizzle", "namespace foo;\n// the base\nstruct Base {\n\tu8 a;\n}\n");
+
+        CHECK(sendCommand(socket, command, errors));
+        CHECK_EQUAL("", errors.str());
+
+        boost::filesystem::ifstream is(root / "out/foo/Derived.swzast");
+        CHECK_EQUAL("unchanged", std::string(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()));
+        CHECK(boost::filesystem::exists(root / "out/foo/Base.swzast"));
+    }
+
+    TEST_FIXTURE(CompileServerFixture, verifyErrorsReported)
+    {
+        Command command;
+        command.Files = { root / "foo/Bad.swizzle" };
+
+        std::ostringstream errors;
+        CHECK(!sendCommand(socket, command, errors));
+        CHECK(errors.str().find("foo/Bad.swizzle") != std::string::npos);
+    }
+
+    TEST_FIXTURE(CompileServerFixture, verifySecondServerRefused)
+    {
+        CHECK_THROW(CompileServer(options, socket), std::runtime_error);
+    }
+
+    TEST_FIXTURE(CompileServerFixture, verifyEvictedModulesFreeTheirNames)
+    {
+        const auto before = swizzle::ast::Symbol::poolSize();
+        const std::size_t files = 4 * options.CacheSize;
+
+        for(std::size_t i = 0; i < files; ++i)
+        {
+            const auto name = "S" + std::to_string(i);
+            write("foo/" + name + ".swizzle", "namespace foo;\nstruct " + name + " {\n\tu8 a;\n}\n");
+
+            Command command;
+            command.Files = { root / "foo" / (name + ".swizzle") };
+
+            std::ostringstream errors;
+            REQUIRE CHECK(sendCommand(socket, command, errors));
+        }
+
+        // only the names of the modules still cached stay interned
+        CHECK_EQUAL(options.CacheSize, server->driver().cache().size());
+        CHECK(swizzle::ast::Symbol::poolSize() <= before + 2 * options.CacheSize);
+    }
+
+    TEST_FIXTURE(CompileServerFixture, verifyStalledClientDoesNotBlockOthers)
+    {
+        using Protocol = boost::asio::local::stream_protocol;
+
+        // connects and never finishes its request
+        boost::asio::io_context io;
+        Protocol::socket stalled(io);
+        stalled.connect(Protocol::endpoint(socket.string()));
+        boost::asio::write(stalled, boost::asio::buffer(std::string("compile\n")));
+
+        Command command;
+        command.Files = { root / "foo/Base.swizzle" };
+        command.EmitAst = root / "out";
+
+        std::ostringstream errors;
+        CHECK(sendCommand(socket, command, errors));
+        CHECK(boost::filesystem::exists(root / "out/foo/Base.swzast"));
+
+        // dropped once the request timeout passes, without a response
+        boost::asio::streambuf buffer;
+        boost::system::error_code ec;
+        boost::asio::read(stalled, buffer, ec);
+
+        CHECK(ec == boost::asio::error::eof);
+        CHECK_EQUAL(0U, buffer.size());
+    }
+}
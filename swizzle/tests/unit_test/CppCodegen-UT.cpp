@@ -0,0 +1,390 @@
+#include "./ut_support/UnitTestSupport.hpp"
+
+#include <swizzle/Exceptions.hpp>
+#include <swizzle/ast/Layout.hpp>
+#include <swizzle/codegen/Cpp.hpp>
+#include <swizzle/codegen/detail/CppNames.hpp>
+
+#include <swizzle/lexer/Tokenizer.hpp>
+#include <swizzle/parser/Parser.hpp>
+
+#include <boost/utility/string_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using namespace swizzle::lexer;
+    using namespace swizzle::parser;
+
+    struct CreateTokenCallback
+    {
+        CreateTokenCallback(std::deque<TokenInfo>& tokens)
+            : tokens_(tokens)
+        {
+        }
+
+        void operator()(const TokenInfo& token)
+        {
+            tokens_.push_back(token);
+        }
+
+    private:
+        std::deque<TokenInfo>& tokens_;
+    };
+
+    struct CppCodegenFixture
+    {
+        std::string generate(const boost::string_view& source)
+        {
+            std::deque<TokenInfo> tokens;
+            CreateTokenCallback callback(tokens);
+            Tokenizer<CreateTokenCallback> tokenizer("test.swizzle", callback);
+
+            for(std::size_t position = 0, end = source.length(); position < end; ++position)
+            {
+                tokenizer.consume(source, position);
+            }
+
+            tokenizer.flush();
+
+            for(const auto& token : tokens)
+            {
+                parser.consume(token);
+            }
+
+            parser.finalize();
+            swizzle::ast::computeLayout(parser.ast());
+
+            return swizzle::codegen::generateCpp(parser.ast());
+        }
+
+        static bool contains(const std::string& code, const std::string& text)
+        {
+            return code.find(text) != std::string::npos;
+        }
+
+        Parser parser;
+    };
+
+    TEST(verifyHeaderName)
+    {
+        CHECK_EQUAL("foo/Bar.hpp", swizzle::codegen::cppHeaderName("foo/Bar.swizzle"));
+        CHECK_EQUAL("Bar.hpp", swizzle::codegen::cppHeaderName("/schemas/foo/Bar.swizzle"));
+    }
+
+    TEST(verifyReservedNames)
+    {
+        using swizzle::codegen::detail::cppIdentifier;
+
+        // from either end of the sorted list and between
+        for(const auto name : { "FixedPrefix", "alignas", "and", "char16_t", "const_cast", "nullptr", "static_cast", "thread_local", "wireSize", "xor", "xor_eq" })
+        {
+            CHECK_EQUAL(std::string(name) + "_", cppIdentifier(name));
+        }
+
+        CHECK_EQUAL("price", cppIdentifier("price"));
+        CHECK_EQUAL("Static", cppIdentifier("Static"));
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyFixedSizeStruct)
+    {
+        const auto code = generate(
+            "namespace foo::bar;\n"
+            "enum Side : u8 { buy, sell = 3, }\n"
+            "@big_endian\n"
+            "struct Header {\n"
+            "\tu16 length;\n"
+            "\tSide side;\n"
+            "\t@little_endian\n"
+            "\tu32 sequence;\n"
+            "\tu8[4] read;\n"
+            "}\n");
+
+        CHECK(contains(code, "#include <swizzle/runtime/ByteOrder.hpp>"));
+        CHECK(contains(code, "namespace foo { namespace bar {"));
+        CHECK(contains(code, "enum class Side : std::uint8_t"));
+        CHECK(contains(code, "sell = 3,"));
+        CHECK(contains(code, "std::array<std::uint8_t, 4> read_ {};"));
+
+        CHECK(contains(code, "class HeaderView"));
+        CHECK(contains(code, "static constexpr std::size_t Size = 11;"));
+        CHECK(contains(code, "inline const char* decode(const char* data, const char* end, Header& out)"));
+        CHECK(contains(code, "if(end - data < 11) return nullptr;"));
+
+        CHECK(contains(code, "::swizzle::runtime::load<std::uint16_t, ::swizzle::runtime::ByteOrder::Big>(data_ + 0)"));
+        CHECK(contains(code, "::swizzle::runtime::load<::foo::bar::Side, ::swizzle::runtime::ByteOrder::Big>(data_ + 2)"));
+        CHECK(contains(code, "::swizzle::runtime::load<std::uint32_t, ::swizzle::runtime::ByteOrder::Little>(data_ + 3)"));
+        CHECK(contains(code, "read_() const"));
+
+        // no @columns
+        CHECK(!contains(code, "#include <swizzle/runtime/Columns.hpp>"));
+        CHECK(!contains(code, "HeaderColumns"));
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyVariableSizeStruct)
+    {
+        const auto code = generate(
+            "namespace foo;\n"
+            "struct Small { u8 a; }\n"
+            "struct Large { u64 a; u64 b; }\n"
+            "struct Message {\n"
+            "\tu8 count;\n"
+            "\tu16[count] values;\n"
+            "\tu32 after;\n"
+            "\tvariable_block : count {\n"
+            "\t\tcase 0 : Small,\n"
+            "\t\tcase 1 : Large,\n"
+            "\t}\n"
+            "}\n");
+
+        CHECK(contains(code, "class MessageView"));
+        CHECK(contains(code, "static constexpr std::size_t FixedPrefix = 1;"));
+        CHECK(contains(code, "static constexpr std::size_t MinSize = 6;"));
+
+        CHECK(contains(code, "::swizzle::runtime::FixedRange<::swizzle::runtime::Scalar<std::uint16_t, ::swizzle::runtime::ByteOrder::Little>> values() const"));
+        CHECK(contains(code, "std::size_t offset_after() const"));
+        CHECK(contains(code, "bool isLarge() const"));
+        CHECK(contains(code, "::foo::LargeView asLarge() const"));
+
+        // vectors go to the arena decode() is given, if any
+        CHECK(contains(code, "::swizzle::runtime::ArenaVector<std::uint16_t> values;"));
+        CHECK(contains(code, "inline const char* decode(const char* data, const char* end, Message& out, ::swizzle::runtime::Arena* arena)"));
+        CHECK(contains(code, "::swizzle::runtime::resize(out.values, count, arena);"));
+        CHECK(contains(code, "case 1: data = decode(data, end, out.largeCase, arena); break;"));
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyEncoder)
+    {
+        const auto code = generate(
+            "namespace foo;\n"
+            "struct Header { u8 type; u16 count; }\n"
+            "struct Fixed { u32 a; u8[4] symbol; }\n"
+            "struct Message {\n"
+            "\tHeader header;\n"
+            "\tu8 size;\n"
+            "\tu16[size] values;\n"
+            "\tu32[header.count] ids;\n"
+            "\tu8[size] flags;\n"
+            "}\n");
+
+        CHECK(contains(code, "inline std::size_t size(const Fixed&)\n    {\n        return 8;\n"));
+        CHECK(contains(code, "inline char* encode(const Fixed& value, char* out)"));
+        CHECK(contains(code, "std::memcpy(out + 4, value.symbol.data(), 4);"));
+
+        CHECK(contains(code, "std::size_t size_ = 4;"));
+        CHECK(contains(code, "size_ += value.values.size() * 2;"));
+
+        // vector sizes come from the vectors, nested ones are patched in place
+        CHECK(contains(code, "(out + 3, static_cast<std::uint8_t>(value.values.size()));"));
+        CHECK(contains(code, "(start + 1, static_cast<std::uint16_t>(value.ids.size()));"));
+
+        // sizes that don't fit their size member, or disagree on a shared one, fail the encode
+        CHECK(contains(code, "if(!::swizzle::runtime::fits<std::uint8_t>(value.values.size())) return nullptr;"));
+        CHECK(contains(code, "if(!::swizzle::runtime::fits<std::uint16_t>(value.ids.size())) return nullptr;"));
+        CHECK(contains(code, "if(value.flags.size() != value.values.size()) return nullptr;"));
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyScalarRuns)
+    {
+        const auto code = generate(
+            "namespace foo;\n"
+            "@big_endian\n"
+            "struct Message {\n"
+            "\tu16[2] small;\n"
+            "\tu32[8] large;\n"
+            "\tu8 count;\n"
+            "\tu64[count] values;\n"
+            "}\n");
+
+        // arrays shorter than a vector register stay a loop
+        CHECK(contains(code, "out.small[i] = ::swizzle::runtime::load<std::uint16_t, ::swizzle::runtime::ByteOrder::Big>(data + 0 + i * 2);"));
+
+        CHECK(contains(code, "::swizzle::runtime::loadRun<std::uint32_t, ::swizzle::runtime::ByteOrder::Big>(data + 4, 8, out.large.data());"));
+        CHECK(contains(code, "::swizzle::runtime::loadRun<std::uint64_t, ::swizzle::runtime::ByteOrder::Big>(data, count, out.values.data());"));
+        CHECK(contains(code, "::swizzle::runtime::storeRun<std::uint32_t, ::swizzle::runtime::ByteOrder::Big>(out + 4, value.large.data(), 8);"));
+        CHECK(contains(code, "::swizzle::runtime::storeRun<std::uint64_t, ::swizzle::runtime::ByteOrder::Big>(out, value.values.data(), value.values.size());"));
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyMetadata)
+    {
+        const auto code = generate(
+            "namespace foo;\n"
+            "@doc{\"side\"}\n"
+            "enum Side : u8 { buy, sell, }\n"
+            "bitfield Flags : u16 { a : 0, b : 1..3, }\n"
+            "@big_endian\n"
+            "struct Message {\n"
+            "\t1: u8 type;\n"
+            "\t@little_endian\n"
+            "\tu32 sequence;\n"
+            "\tu8 count;\n"
+            "\tu16[count] values;\n"
+            "}\n");
+
+        CHECK(contains(code, "struct SideMetadata"));
+        CHECK(contains(code, "SideMetadata metadata(const Side&);"));
+        CHECK(contains(code, "{ \"@doc\", \"{\\\"side\\\"}\" },"));
+        CHECK(contains(code, "{ \"sell\", ::foo::Side::sell },"));
+        CHECK(contains(code, "{ \"b\", 1, 3, 0xeULL },"));
+
+        CHECK(contains(code, "static constexpr ::swizzle::runtime::Name name() { return \"foo::Message\"; }"));
+        CHECK(contains(code, "static constexpr std::size_t FieldCount = 4;"));
+        CHECK(contains(code, "{ \"type\", \"u8\", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Big, true, 0, 1, 1, 0, 0, ::swizzle::runtime::NoField, \"\", true, 1ULL, false, 1, 0 },"));
+        CHECK(contains(code, "{ \"sequence\", \"u32\", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Little, true, 1, 4, 4, 0, 0, ::swizzle::runtime::NoField, \"\", false, 0, false, 1, 1 },"));
+        CHECK(contains(code, "::swizzle::runtime::NoField, \"\", false, 0, false, 2, 0 },"));
+        CHECK(contains(code, "true, 6, 0, 510, 2, 0, 2, \"count\", false, 0, false, 2, 0 },"));
+        CHECK(contains(code, "static constexpr auto members() { return std::make_tuple(&Message::type, &Message::sequence, &Message::count, &Message::values); }"));
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyEnumNames)
+    {
+        const auto code = generate(
+            "namespace foo;\n"
+            "enum Side : u8 { buy = 1, sell = 3, }\n"
+            "enum Venue : u16 { a = 1, b = 100, c = 1000, d = 20000, }\n");
+
+        // dense values index an array, sparse ones are hashed
+        CHECK(contains(code, "inline ::swizzle::runtime::Name to_string(const Side value)"));
+        CHECK(contains(code, "\"buy\", \"\", \"sell\","));
+        CHECK(contains(code, "const auto slot = static_cast<std::uint64_t>(static_cast<std::uint8_t>(value)) - 1ULL;"));
+        CHECK(contains(code, "inline ::swizzle::runtime::Name to_string(const Venue value)"));
+        CHECK(contains(code, "return (Keys[slot] == key) ? Names[slot] : ::swizzle::runtime::Name();"));
+
+        CHECK(contains(code, "inline bool from_string(const char* name, const std::size_t size, Side& out)"));
+        CHECK(contains(code, "inline bool from_string(const std::string& name, Venue& out)"));
+        CHECK(contains(code, "(::swizzle::runtime::hashName(name, size) * "));
+    }
+
+    std::string variableBlock(const std::string& type, const std::vector<std::string>& values)
+    {
+        std::string source = "namespace foo;\nstruct A { u8 a; }\nstruct M {\n\t" + type + " type;\n\tvariable_block : type {\n";
+        for(const auto& value : values)
+        {
+            source += "\t\tcase " + value + " : A,\n";
+        }
+
+        return source + "\t}\n}\n";
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyFewCasesStayASwitch)
+    {
+        const auto code = generate(variableBlock("u8", { "1", "7", "9" }));
+
+        CHECK(contains(code, "switch(out.type)"));
+        CHECK(contains(code, "case 7: data = decode(data, end, out.aCase, arena); break;"));
+        CHECK(!contains(code, "mVariableBlockCase"));
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyRepeatedCaseValuesAreRejected)
+    {
+        CHECK_THROW(generate(variableBlock("u8", { "1", "7", "1" })), swizzle::SyntaxError);
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyEqualCaseValuesAreRejected)
+    {
+        CHECK_THROW(generate(variableBlock("u8", { "65", "'A'" })), swizzle::SyntaxError);
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyDenseCasesUseATable)
+    {
+        const auto code = generate(variableBlock("u8", { "'A'", "'B'", "'D'", "'E'", "'F'" }));
+
+        CHECK(contains(code, "inline std::size_t mVariableBlockCase(const std::uint8_t value)"));
+        CHECK(contains(code, "1, 2, 0, 3, 4, 5,"));
+        CHECK(contains(code, "static_cast<std::uint64_t>(value) - 65ULL;"));
+        CHECK(contains(code, "switch(mVariableBlockCase(static_cast<std::uint8_t>(out.type)))"));
+        CHECK(contains(code, "case 3: data = decode(data, end, out.aCase, arena); break;"));
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifySparseCasesUseAPerfectHash)
+    {
+        const auto code = generate(variableBlock("u16", { "1", "0x100", "1000", "20000", "40000", "65535" }));
+
+        CHECK(contains(code, "inline std::size_t mVariableBlockCase(const std::uint16_t value)"));
+        CHECK(contains(code, "return (Keys[slot] == value) ? Cases[slot] : 0;"));
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyCasesWithoutPerfectHashAreSearched)
+    {
+        // more cases than fit a perfect hash table of the largest size
+        std::vector<std::string> values;
+        for(std::uint32_t i = 0, x = 1; i < 1000; ++i)
+        {
+            // xorshift32, distinct values without a pattern a hash could fit
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            values.push_back(std::to_string(x));
+        }
+
+        const auto code = generate(variableBlock("u32", values));
+
+        CHECK(contains(code, "std::lower_bound(Keys, Keys + 1000, value);"));
+        CHECK(contains(code, "static constexpr std::uint16_t Cases[1000]"));
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyColumns)
+    {
+        const auto code = generate(
+            "namespace foo;\n"
+            "struct Small { u8 a; }\n"
+            "@columns\n"
+            "@big_endian\n"
+            "struct Header { u8 type; u32 sequence; }\n"
+            "@columns\n"
+            "struct Message {\n"
+            "\tHeader header;\n"
+            "\tu64 id;\n"
+            "\tu16[header.type] values;\n"
+            "\tvariable_block : header.type {\n"
+            "\t\tcase 1 : Small,\n"
+            "\t}\n"
+            "}\n");
+
+        // only for structs marked @columns
+        CHECK(contains(code, "#include <swizzle/runtime/Columns.hpp>"));
+        CHECK(!contains(code, "struct SmallColumns"));
+
+        // nested fixed size structs are flattened, vectors and cases go to side columns
+        CHECK(contains(code, "std::vector<std::uint32_t> header_sequence;"));
+        CHECK(contains(code, "std::vector<std::size_t> values_begin;"));
+        CHECK(contains(code, "std::vector<::foo::Small> smallCase;"));
+        CHECK(contains(code, "std::vector<std::size_t> variableBlock_index;"));
+
+        CHECK(contains(code, "inline std::size_t decodeColumns(const char* const* messages, const std::size_t* lengths, const std::size_t count, MessageColumns& out)"));
+        CHECK(contains(code, "gatherIndirect<std::uint32_t, ::swizzle::runtime::ByteOrder::Big>(messages + begin_, 1, rows_, out.header_sequence.data() + base_ + begin_);"));
+        CHECK(contains(code, "gatherIndirect<std::uint64_t, ::swizzle::runtime::ByteOrder::Little>(messages + begin_, 5, rows_, out.id.data() + base_ + begin_);"));
+        CHECK(contains(code, "const auto count_ = static_cast<std::size_t>(out.header_type[row_]);"));
+
+        // presized for the batch, cases reserved for it
+        CHECK(contains(code, "out.header_sequence.resize(base_ + count);"));
+        CHECK(contains(code, "out.smallCase.reserve(out.smallCase.size() + count);"));
+        CHECK(contains(code, "while((valid_ < last_) && MessageView(messages[valid_], lengths[valid_]).isValid()) ++valid_;"));
+
+        // packed records only for fixed size structs
+        CHECK(contains(code, "inline std::size_t decodeColumns(const char* data, const std::size_t count, HeaderColumns& out)"));
+        CHECK(contains(code, "gatherStrided<std::uint32_t, ::swizzle::runtime::ByteOrder::Big>(data + begin_ * HeaderView::Size + 1, HeaderView::Size, rows_, out.sequence.data() + base_ + begin_);"));
+        CHECK(!contains(code, "decodeColumns(const char* data, const std::size_t count, MessageColumns& out)"));
+    }
+
+    TEST_FIXTURE(CppCodegenFixture, verifyBitfieldAccessors)
+    {
+        const auto code = generate(
+            "namespace foo;\n"
+            "bitfield Flags : u16 { a : 0, value : 1..3, c : 8..15, }\n");
+
+        CHECK(contains(code, "#include <swizzle/runtime/Bits.hpp>"));
+        CHECK(contains(code, "static constexpr std::uint16_t value_Mask() { return 0xe; }"));
+        CHECK(contains(code, "static constexpr unsigned cShift() { return 8; }"));
+        CHECK(contains(code, "constexpr std::uint16_t c() const { return static_cast<std::uint16_t>((value & cMask()) >> cShift()); }"));
+
+        // three fields of at most 8 bits: 8 bit lanes
+        CHECK(contains(code, "std::uint8_t value_;"));
+        CHECK(contains(code, "spreadBitsBmi2(values, count, 0xff0fULL, 0xff0701ULL, out);"));
+    }
+}
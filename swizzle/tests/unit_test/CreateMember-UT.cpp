@@ -88,7 +88,7 @@ namespace {
             field2.type("u32");
 
             // add the struct to the the type cache
-            context.TypeCache["my_namespace::MyStruct"] = nodeStack.top();
+            context.TypeCache["my_namespace::MyStruct"] = nodeStack.top().get();
             nodeStack.pop();
 
             const auto info2 = TokenInfo(Token("struct", 0, 6, TokenType::keyword), FileInfo("test.swizzle"));
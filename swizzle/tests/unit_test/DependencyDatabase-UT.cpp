@@ -0,0 +1,65 @@
+#include "./ut_support/UnitTestSupport.hpp"
+#include "./ut_support/TemporaryDirectory.hpp"
+
+#include <swizzle/driver/DependencyDatabase.hpp>
+
+#include <boost/filesystem.hpp>
+
+namespace {
+
+    using namespace swizzle::driver;
+
+    struct DependencyDatabaseFixture : public TemporaryDirectory
+    {
+        DependencyDatabaseFixture()
+            : file(root / "swizzle.deps")
+        {
+        }
+
+        const boost::filesystem::path file;
+        DependencyDatabase database;
+    };
+
+    TEST_FIXTURE(DependencyDatabaseFixture, verifyMissingFileIsEmpty)
+    {
+        database.load(file);
+        CHECK_EQUAL(0U, database.size());
+        CHECK(database.find("foo/Bar.swizzle") == nullptr);
+    }
+
+    TEST_FIXTURE(DependencyDatabaseFixture, verifyRoundTrip)
+    {
+        DependencyRecord record;
+        record.ContentHash = 0xfedcba9876543210ULL;
+        record.InterfaceHash = 42;
+        record.Imports = { "foo/Base.swizzle", "Top.swizzle" };
+
+        database.update("foo/Bar.swizzle", record);
+        database.update("Top.swizzle", DependencyRecord());
+        database.save(file);
+
+        DependencyDatabase loaded;
+        loaded.load(file);
+        REQUIRE CHECK_EQUAL(2U, loaded.size());
+
+        const auto found = loaded.find("foo/Bar.swizzle");
+        REQUIRE CHECK(found != nullptr);
+
+        CHECK_EQUAL(record.ContentHash, found->ContentHash);
+        CHECK_EQUAL(record.InterfaceHash, found->InterfaceHash);
+        REQUIRE CHECK_EQUAL(2U, found->Imports.size());
+        CHECK_EQUAL("foo/Base.swizzle", found->Imports[0].string());
+        CHECK_EQUAL("Top.swizzle", found->Imports[1].string());
+    }
+
+    TEST_FIXTURE(DependencyDatabaseFixture, verifyCorruptFileIsEmpty)
+    {
+        {
+            boost::filesystem::ofstream os(file);
+            os << "swizzle-deps 1\nmodule a.swizzle\ncontent not-hex\nend\n";
+        }
+
+        database.load(file);
+        CHECK_EQUAL(0U, database.size());
+    }
+}
@@ -0,0 +1,30 @@
+#include "./ut_support/UnitTestSupport.hpp"
+
+#include <swizzle/driver/Depfile.hpp>
+
+#include <algorithm>
+
+namespace {
+
+    using namespace swizzle::driver;
+
+    TEST(verifyMakeRule)
+    {
+        const auto rule = makeRule({ "out/Top.swzast" }, { "/src/Top.swizzle", "/src/foo/Base.swizzle" });
+        CHECK_EQUAL("out/Top.swzast: \\\n  /src/Top.swizzle \\\n  /src/foo/Base.swizzle\n", rule);
+    }
+
+    TEST(verifyMakeRuleEscapes)
+    {
+        const auto rule = makeRule({ "my out/a#1.swzast" }, { "/src/$dir/a.swizzle" });
+        CHECK_EQUAL("my\\ out/a\\#1.swzast: \\\n  /src/$$dir/a.swizzle\n", rule);
+    }
+
+    TEST(verifyTransitiveImportsOfUnknownModule)
+    {
+        const auto imports = transitiveImports(ModuleMap(), "Top.swizzle");
+
+        REQUIRE CHECK_EQUAL(1U, imports.size());
+        CHECK_EQUAL("Top.swizzle", imports[0].string());
+    }
+}
@@ -0,0 +1,334 @@
+#include "./ut_support/UnitTestSupport.hpp"
+#include "./ut_support/TemporaryDirectory.hpp"
+
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/driver/Depfile.hpp>
+#include <swizzle/driver/Driver.hpp>
+#include <swizzle/driver/ScanImports.hpp>
+
+#include <swizzle/lexer/Tokenizer.hpp>
+
+#include <boost/filesystem.hpp>
+#include <boost/utility/string_view.hpp>
+
+#include <deque>
+#include <memory>
+#include <string>
+
+namespace {
+
+    using namespace swizzle::ast;
+    using namespace swizzle::driver;
+    using namespace swizzle::lexer;
+
+    struct DriverFixture : public TemporaryDirectory
+    {
+        DriverFixture()
+        {
+            boost::filesystem::create_directories(root / "foo");
+            options.ImportRoot = root;
+            options.Threads = 4;
+        }
+
+        ModuleMap compile(const boost::filesystem::path& path)
+        {
+            Driver driver(options);
+            return driver.compile({ root / path });
+        }
+
+        DriverOptions options;
+    };
+
+    TEST_FIXTURE(DriverFixture, verifyImportedTypeResolves)
+    {
+        write("foo/Base.swizzle", "namespace foo;\nstruct Base {\n\tu8 a;\n}\n");
+        write("foo/Derived.swizzle", "import foo::Base;\nnamespace foo;\nstruct Derived {\n\tfoo::Base base;\n\tu16 b;\n}\n");
+
+        const auto modules = compile("foo/Derived.swizzle");
+        REQUIRE CHECK_EQUAL(2U, modules.size());
+
+        const auto& base = *modules.at("foo/Base.swizzle");
+        const auto& derived = *modules.at("foo/Derived.swizzle");
+
+        REQUIRE CHECK(!base.failed());
+        REQUIRE CHECK(!derived.failed());
+
+        const auto structs = base.ast().index().of<nodes::Struct>();
+        REQUIRE CHECK_EQUAL(1U, structs.size());
+
+        const auto fields = derived.ast().index().of<nodes::StructField>();
+        REQUIRE CHECK_EQUAL(2U, fields.size());
+
+        const auto& field = static_cast<const nodes::StructField&>(*fields[0]);
+        CHECK_EQUAL("foo::Base", field.type());
+        CHECK_EQUAL(structs[0].get(), field.typeDeclaration());
+    }
+
+    TEST_FIXTURE(DriverFixture, verifySharedImportParsedOnce)
+    {
+        write("foo/Base.swizzle", "namespace foo;\nstruct Base {\n\tu8 a;\n}\n");
+        write("foo/Left.swizzle", "import foo::Base;\nnamespace foo;\nstruct Left {\n\tfoo::Base base;\n}\n");
+        write("foo/Right.swizzle", "import foo::Base;\nnamespace foo;\nstruct Right {\n\tfoo::Base base;\n}\n");
+        write("foo/Top.swizzle", "import foo::Left;\nimport foo::Right;\nnamespace foo;\nstruct Top {\n\tfoo::Left left;\n\tfoo::Right right;\n}\n");
+
+        const auto modules = compile("foo/Top.swizzle");
+        REQUIRE CHECK_EQUAL(4U, modules.size());
+
+        for(const auto& module : modules)
+        {
+            CHECK(!module.second->failed());
+        }
+
+        CHECK_EQUAL(4U, transitiveImports(modules, "foo/Top.swizzle").size());
+        CHECK_EQUAL(2U, transitiveImports(modules, "foo/Left.swizzle").size());
+    }
+
+    TEST_FIXTURE(DriverFixture, verifyMissingImportFails)
+    {
+        write("foo/Derived.swizzle", "import foo::Missing;\nnamespace foo;\nstruct Derived {\n\tu8 a;\n}\n");
+
+        const auto modules = compile("foo/Derived.swizzle");
+        REQUIRE CHECK_EQUAL(2U, modules.size());
+
+        CHECK(modules.at("foo/Missing.swizzle")->failed());
+        CHECK(modules.at("foo/Derived.swizzle")->failed());
+    }
+
+    TEST_FIXTURE(DriverFixture, verifyImportCycleFails)
+    {
+        write("foo/A.swizzle", "import foo::B;\nnamespace foo;\nstruct A {\n\tu8 a;\n}\n");
+        write("foo/B.swizzle", "import foo::A;\nnamespace foo;\nstruct B {\n\tu8 b;\n}\n");
+
+        const auto modules = compile("foo/A.swizzle");
+        REQUIRE CHECK_EQUAL(2U, modules.size());
+
+        for(const auto& module : modules)
+        {
+            CHECK(module.second->failed());
+        }
+    }
+
+    struct IncrementalFixture : public DriverFixture
+    {
+        IncrementalFixture()
+        {
+            options.DependencyDatabase = root / "swizzle.deps";
+
+            write("foo/Base.swizzle", "namespace foo;\n// base\nenum Side : u8 {\n\tbuy,\n}\nstruct Base {\n\tu8 a;\n}\n");
+            write("foo/Derived.swizzle", "import foo::Base;\nnamespace foo;\nstruct Derived {\n\tfoo::Base base;\n}\n");
+
+            modules = compile("foo/Derived.swizzle");
+        }
+
+        const Module& module(const boost::filesystem::path& path)
+        {
+            return *modules.at(path);
+        }
+
+        ModuleMap modules;
+    };
+
+    TEST_FIXTURE(IncrementalFixture, verifyFirstBuildParsesEverything)
+    {
+        CHECK(module("foo/Base.swizzle").changed());
+        CHECK(module("foo/Base.swizzle").parsed());
+        CHECK(module("foo/Derived.swizzle").changed());
+        CHECK(module("foo/Derived.swizzle").parsed());
+        CHECK(boost::filesystem::exists(options.DependencyDatabase));
+    }
+
+    TEST_FIXTURE(IncrementalFixture, verifyUnchangedBuildParsesNothing)
+    {
+        modules = compile("foo/Derived.swizzle");
+        REQUIRE CHECK_EQUAL(2U, modules.size());
+
+        for(const auto& m : modules)
+        {
+            CHECK(!m.second->failed());
+            CHECK(!m.second->changed());
+            CHECK(!m.second->parsed());
+        }
+    }
+
+    TEST_FIXTURE(IncrementalFixture, verifyCommentEditDoesNotReparseImporters)
+    {
+        const std::string edits[] = {
+            "namespace foo;\n// the base\nenum Side : u8 {\n\tbuy,\n}\nstruct Base {\n\tu8 a;\n}\n",
+            "namespace foo;\n// the base\nenum Side : u8 {\n\tbuy,\n}\nstruct Base {\n\t// inside\n\tu8 a;\n}\n",
+            "namespace foo;\n// the base\nenum Side : u8 {\n\t// inside\n\tbuy,\n}\nstruct Base {\n\t// inside\n\tu8 a;\n}\n",
+        };
+
+        for(const auto& edit : edits)
+        {
+            write("foo/Base.swizzle", edit);
+            modules = compile("foo/Derived.swizzle");
+
+            CHECK(module("foo/Base.swizzle").changed());
+            CHECK(module("foo/Base.swizzle").parsed());
+            CHECK(!module("foo/Base.swizzle").interfaceChanged());
+
+            CHECK(!module("foo/Derived.swizzle").changed());
+            CHECK(!module("foo/Derived.swizzle").parsed());
+        }
+    }
+
+    TEST_FIXTURE(IncrementalFixture, verifyInterfaceEditReparsesImporters)
+    {
+        write("foo/Base.swizzle", "namespace foo;\n// base\nstruct Base {\n\tu8 a;\n\tu8 b;\n}\n");
+        modules = compile("foo/Derived.swizzle");
+
+        CHECK(module("foo/Base.swizzle").interfaceChanged());
+        CHECK(module("foo/Derived.swizzle").changed());
+        CHECK(module("foo/Derived.swizzle").parsed());
+        CHECK(!module("foo/Derived.swizzle").failed());
+    }
+
+    TEST_FIXTURE(IncrementalFixture, verifyChangedImporterParsesUnchangedImport)
+    {
+        write("foo/Derived.swizzle", "import foo::Base;\nnamespace foo;\nstruct Derived {\n\tfoo::Base base;\n\tu16 b;\n}\n");
+        modules = compile("foo/Derived.swizzle");
+
+        CHECK(!module("foo/Base.swizzle").changed());
+        CHECK(module("foo/Base.swizzle").parsed());
+
+        CHECK(module("foo/Derived.swizzle").changed());
+        CHECK(module("foo/Derived.swizzle").parsed());
+        CHECK(!module("foo/Derived.swizzle").failed());
+    }
+
+    struct CachedDriverFixture : public DriverFixture
+    {
+        CachedDriverFixture()
+        {
+            options.CacheSize = 16;
+            driver.reset(new Driver(options));
+
+            write("foo/Base.swizzle", "namespace foo;\n// base\nstruct Base {\n\tu8 a;\n}\n");
+            write("foo/Derived.swizzle", "import foo::Base;\nnamespace foo;\nstruct Derived {\n\tfoo::Base base;\n}\n");
+
+            first = driver->compile({ root / "foo/Derived.swizzle" });
+        }
+
+        std::unique_ptr<Driver> driver;
+        ModuleMap first;
+    };
+
+    TEST_FIXTURE(CachedDriverFixture, verifyUnchangedModulesReused)
+    {
+        const auto second = driver->compile({ root / "foo/Derived.swizzle" });
+
+        CHECK_EQUAL(first.at("foo/Base.swizzle"), second.at("foo/Base.swizzle"));
+        CHECK_EQUAL(first.at("foo/Derived.swizzle"), second.at("foo/Derived.swizzle"));
+        CHECK(!second.at("foo/Derived.swizzle")->changed());
+        CHECK_EQUAL(2U, driver->cache().size());
+    }
+
+    TEST_FIXTURE(CachedDriverFixture, verifyImporterReusedWhenInterfaceUnchanged)
+    {
+        write("foo/Base.swizzle", "namespace foo;\n// the base\nstruct Base {\n\tu8 a;\n}\n");
+        const auto second = driver->compile({ root / "foo/Derived.swizzle" });
+
+        CHECK(first.at("foo/Base.swizzle") != second.at("foo/Base.swizzle"));
+        CHECK(second.at("foo/Base.swizzle")->changed());
+        CHECK_EQUAL(first.at("foo/Derived.swizzle"), second.at("foo/Derived.swizzle"));
+    }
+
+    TEST_FIXTURE(CachedDriverFixture, verifyImporterReparsedWhenInterfaceChanged)
+    {
+        write("foo/Base.swizzle", "namespace foo;\nstruct Base {\n\tu8 a;\n\tu8 b;\n}\n");
+
+        first.clear();
+        const auto second = driver->compile({ root / "foo/Derived.swizzle" });
+
+        const auto& derived = *second.at("foo/Derived.swizzle");
+        REQUIRE CHECK(!derived.failed());
+        CHECK(derived.changed());
+
+        const auto structs = second.at("foo/Base.swizzle")->ast().index().of<nodes::Struct>();
+        const auto fields = derived.ast().index().of<nodes::StructField>();
+        REQUIRE CHECK_EQUAL(1U, fields.size());
+
+        CHECK_EQUAL(structs[0].get(), static_cast<const nodes::StructField&>(*fields[0]).typeDeclaration());
+    }
+
+    // Outer <- Mid <- Inner, an edit to Inner moves the fields of Outer
+    struct TransitiveFixture : public DriverFixture
+    {
+        TransitiveFixture()
+        {
+            write("foo/Inner.swizzle", "namespace foo;\nstruct Inner {\n\tu32 a;\n}\n");
+            write("foo/Mid.swizzle", "import foo::Inner;\nnamespace foo;\nstruct Mid {\n\tfoo::Inner inner;\n}\n");
+            write("foo/Outer.swizzle", "import foo::Mid;\nnamespace foo;\nstruct Outer {\n\tfoo::Mid mid;\n\tu32 after;\n}\n");
+        }
+
+        void growInner()
+        {
+            write("foo/Inner.swizzle", "namespace foo;\nstruct Inner {\n\tu32 a;\n\tu32 b;\n}\n");
+        }
+
+        static std::size_t outerSize(const ModuleMap& modules)
+        {
+            const auto& outer = *modules.at("foo/Outer.swizzle");
+            REQUIRE CHECK(outer.parsed());
+
+            const auto structs = outer.ast().index().of<nodes::Struct>();
+            return static_cast<const nodes::Struct&>(*structs[0]).layout().MinSize;
+        }
+    };
+
+    TEST_FIXTURE(TransitiveFixture, verifyEditTwoImportsAwayReparsesImporters)
+    {
+        options.DependencyDatabase = root / "swizzle.deps";
+        CHECK_EQUAL(8U, outerSize(compile("foo/Outer.swizzle")));
+
+        growInner();
+        const auto modules = compile("foo/Outer.swizzle");
+
+        CHECK(modules.at("foo/Mid.swizzle")->interfaceChanged());
+        CHECK(modules.at("foo/Outer.swizzle")->changed());
+        CHECK_EQUAL(12U, outerSize(modules));
+    }
+
+    TEST_FIXTURE(TransitiveFixture, verifyEditTwoImportsAwayReparsesCachedImporters)
+    {
+        options.CacheSize = 16;
+        Driver driver(options);
+        CHECK_EQUAL(8U, outerSize(driver.compile({ root / "foo/Outer.swizzle" })));
+
+        growInner();
+        const auto modules = driver.compile({ root / "foo/Outer.swizzle" });
+
+        CHECK(modules.at("foo/Outer.swizzle")->changed());
+        CHECK_EQUAL(12U, outerSize(modules));
+    }
+
+    struct ScanImportsFixture
+    {
+        std::deque<TokenInfo> tokenize(const std::string& source)
+        {
+            std::deque<TokenInfo> tokens;
+            auto callback = [&tokens](const TokenInfo& token){ tokens.push_back(token); };
+
+            Tokenizer<decltype(callback)> tokenizer("test.swizzle", callback);
+
+            const boost::string_view sv(source);
+            for(std::size_t position = 0, end = sv.length(); position < end; ++position)
+            {
+                tokenizer.consume(sv, position);
+            }
+
+            tokenizer.flush();
+            return tokens;
+        }
+    };
+
+    TEST_FIXTURE(ScanImportsFixture, verifyScanImports)
+    {
+        const auto imports = scanImports(tokenize("import foo::bar::Baz;\nimport Top;\nnamespace foo;\nstruct S {\n\tu8 import_count;\n}\n"));
+
+        REQUIRE CHECK_EQUAL(2U, imports.size());
+        CHECK_EQUAL("foo/bar/Baz.swizzle", imports[0].string());
+        CHECK_EQUAL("Top.swizzle", imports[1].string());
+    }
+}
@@ -0,0 +1,145 @@
+#include "./ut_support/UnitTestSupport.hpp"
+#include "./ut_support/TemporaryDirectory.hpp"
+
+#include <swizzle/driver/FileWatcher.hpp>
+#include <swizzle/driver/Watch.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+
+#if defined(__linux__)
+
+namespace {
+
+    using namespace swizzle::driver;
+
+    struct FileWatcherFixture : public TemporaryDirectory
+    {
+        FileWatcherFixture()
+        {
+            boost::filesystem::create_directories(root / "foo");
+        }
+
+        std::ostringstream log;
+        const std::chrono::milliseconds timeout = std::chrono::milliseconds(2000);
+        const std::chrono::milliseconds settle = std::chrono::milliseconds(20);
+    };
+
+    TEST_FIXTURE(FileWatcherFixture, verifyTimeout)
+    {
+        FileWatcher watcher(root, log);
+        CHECK(watcher.wait(std::chrono::milliseconds(10), settle).empty());
+    }
+
+    TEST_FIXTURE(FileWatcherFixture, verifyBurstCoalesced)
+    {
+        FileWatcher watcher(root, log);
+
+        write("foo/Base.swizzle", "namespace foo;\n");
+        write("foo/Base.swizzle", "namespace foo;\n\n");
+        write("foo/notes.txt", "not a schema");
+        write("foo/Base.swizzle", "namespace foo;\n\n\n");
+
+        const auto changed = watcher.wait(timeout, settle);
+        REQUIRE CHECK_EQUAL(1U, changed.size());
+        CHECK_EQUAL(root / "foo/Base.swizzle", changed[0]);
+    }
+
+    TEST_FIXTURE(FileWatcherFixture, verifyNewDirectoryWatched)
+    {
+        FileWatcher watcher(root, log);
+
+        boost::filesystem::create_directories(root / "bar");
+        watcher.wait(std::chrono::milliseconds(50), settle);
+
+        write("bar/Top.swizzle", "namespace bar;\n");
+
+        const auto changed = watcher.wait(timeout, settle);
+        REQUIRE CHECK_EQUAL(1U, changed.size());
+        CHECK_EQUAL(root / "bar/Top.swizzle", changed[0]);
+    }
+
+    TEST_FIXTURE(FileWatcherFixture, verifyUnwatchableDirectorySkipped)
+    {
+        FileWatcher watcher(root, log);
+
+        // gone before its creation is read, so it can't be watched
+        boost::filesystem::create_directories(root / "gone");
+        boost::filesystem::remove(root / "gone");
+        write("foo/Base.swizzle", "namespace foo;\n");
+
+        const auto changed = watcher.wait(timeout, settle);
+        REQUIRE CHECK_EQUAL(1U, changed.size());
+        CHECK_EQUAL(root / "foo/Base.swizzle", changed[0]);
+        CHECK(log.str().find("Not watching " + (root / "gone").string()) != std::string::npos);
+    }
+
+    TEST_FIXTURE(FileWatcherFixture, verifyQueueOverflowRescans)
+    {
+        write("foo/Base.swizzle", "namespace foo;\n");
+        FileWatcher watcher(root, log);
+
+        std::size_t queued = 16384;
+        boost::filesystem::ifstream("/proc/sys/fs/inotify/max_queued_events") >> queued;
+
+        // two events per file overflow the queue, the edit after them is dropped
+        for(std::size_t i = 0; i < queued / 2 + 64; ++i)
+        {
+            write("foo/" + std::to_string(i) + ".txt", "");
+        }
+
+        write("foo/Base.swizzle", "namespace foo;\n\n");
+
+        const auto changed = watcher.wait(timeout, settle);
+        REQUIRE CHECK_EQUAL(1U, changed.size());
+        CHECK_EQUAL(root / "foo/Base.swizzle", changed[0]);
+    }
+
+    TEST_FIXTURE(FileWatcherFixture, verifyRemovedDirectoryRescans)
+    {
+        write("foo/Base.swizzle", "namespace foo;\n");
+        write("bar/Top.swizzle", "namespace bar;\n");
+        FileWatcher watcher(root, log);
+
+        boost::filesystem::remove_all(root / "bar");
+
+        // the removed file, and everything still there
+        const auto changed = watcher.wait(timeout, settle);
+        REQUIRE CHECK_EQUAL(2U, changed.size());
+        CHECK_EQUAL(root / "bar/Top.swizzle", changed[0]);
+        CHECK_EQUAL(root / "foo/Base.swizzle", changed[1]);
+    }
+
+    TEST_FIXTURE(FileWatcherFixture, verifyWatchRecompiles)
+    {
+        write("foo/Base.swizzle", "namespace foo;\nstruct Base {\n\tu8 a;\n}\n");
+
+        DriverOptions options;
+        options.ImportRoot = root;
+        options.CacheSize = 16;
+        Driver driver(options);
+
+        std::size_t rounds = 0;
+
+        // between the first and second round, edit the schema
+        const auto stop = [&]{
+            if(rounds++ == 0)
+            {
+                write("foo/Base.swizzle", "namespace foo;\nstruct Base {\n\tu8 a;\n\tu8 b;\n}\n");
+                return false;
+            }
+
+            return (log.str().find("Changed:") != std::string::npos) || (rounds > 20);
+        };
+
+        watch(driver, Command(), root, log, stop);
+
+        CHECK(log.str().find("Changed: " + (root / "foo/Base.swizzle").string()) != std::string::npos);
+        CHECK_EQUAL(1U, driver.cache().size());
+    }
+}
+
+#endif
@@ -0,0 +1,342 @@
+#include "./ut_support/UnitTestSupport.hpp"
+
+#include "./generated/fixture/Trading.hpp"           // generated from schemas/fixture/Trading.swizzle
+
+#include <swizzle/ast/Layout.hpp>
+#include <swizzle/codegen/Cpp.hpp>
+#include <swizzle/driver/AllocationCount.hpp>
+
+#include <swizzle/lexer/Tokenizer.hpp>
+#include <swizzle/parser/Parser.hpp>
+
+#include <boost/filesystem/path.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using namespace swizzle::lexer;
+    using namespace swizzle::parser;
+
+    std::string readFile(const boost::filesystem::path& path)
+    {
+        std::ifstream file(path.string(), std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    struct CreateTokenCallback
+    {
+        CreateTokenCallback(std::deque<TokenInfo>& tokens)
+            : tokens_(tokens)
+        {
+        }
+
+        void operator()(const TokenInfo& token)
+        {
+            tokens_.push_back(token);
+        }
+
+    private:
+        std::deque<TokenInfo>& tokens_;
+    };
+
+    std::string generate(const std::string& source)
+    {
+        std::deque<TokenInfo> tokens;
+        CreateTokenCallback callback(tokens);
+        Tokenizer<CreateTokenCallback> tokenizer("fixture/Trading.swizzle", callback);
+
+        for(std::size_t position = 0, end = source.length(); position < end; ++position)
+        {
+            tokenizer.consume(source, position);
+        }
+
+        tokenizer.flush();
+
+        Parser parser;
+        for(const auto& token : tokens)
+        {
+            parser.consume(token);
+        }
+
+        parser.finalize();
+        swizzle::ast::computeLayout(parser.ast());
+
+        return swizzle::codegen::generateCpp(parser.ast());
+    }
+
+    // an order and a snapshot, as a feed would carry them
+    fixture::Message order()
+    {
+        fixture::Message message;
+        message.header.type = 'O';
+        message.header.sequence = 7;
+        message.tags = { 3, 0xdeadbeef };
+        message.orderCase.id = 0x0102030405060708ULL;
+        message.orderCase.side = fixture::Side::sell;
+        message.orderCase.flags.venue(9);
+        message.orderCase.symbol = {{ 'A', 'B', 'C', 'D' }};
+        message.orderCase.price = -125;
+
+        return message;
+    }
+
+    fixture::Message snapshot()
+    {
+        fixture::Message message;
+        message.header.type = 'S';
+        message.header.sequence = 8;
+        message.snapshotCase.symbol = {{ 'W', 'X', 'Y', 'Z' }};
+        message.snapshotCase.levels = { { 100, 5 }, { 99, 12 }, { 98, 40 } };
+        message.snapshotCase.sizes = { 1, 2, 3 };
+
+        return message;
+    }
+
+    std::string encode(const fixture::Message& message)
+    {
+        std::string wire(size(message), '\0');
+        const auto end = fixture::encode(message, &wire[0]);
+
+        CHECK(end == wire.data() + wire.size());
+        return wire;
+    }
+
+    TEST(verifyFixtureIsCurrent)
+    {
+        const auto directory = boost::filesystem::path(__FILE__).parent_path();
+        const auto expected = readFile(directory / "generated/fixture/Trading.hpp");
+
+        // regenerate it as schemas/fixture/Trading.swizzle describes if this fails
+        CHECK(!expected.empty());
+        CHECK(generate(readFile(directory / "schemas/fixture/Trading.swizzle")) == expected);
+    }
+
+    TEST(verifyOrderRoundTrip)
+    {
+        const auto wire = encode(order());
+
+        fixture::Message decoded;
+        CHECK(fixture::decode(wire.data(), wire.data() + wire.size(), decoded) == wire.data() + wire.size());
+
+        CHECK_EQUAL(7U, decoded.header.sequence);
+        CHECK_EQUAL(2U, decoded.tagCount);
+        CHECK_EQUAL(0xdeadbeefU, decoded.tags[1]);
+        CHECK_EQUAL(0x0102030405060708ULL, decoded.orderCase.id);
+        CHECK(decoded.orderCase.side == fixture::Side::sell);
+        CHECK_EQUAL(9U, decoded.orderCase.flags.venue());
+        CHECK_EQUAL('C', decoded.orderCase.symbol[2]);
+        CHECK_EQUAL(-125, decoded.orderCase.price);
+
+        // the tags are little endian, the order that follows them big endian
+        CHECK_EQUAL(static_cast<char>(0xef), wire[13]);
+        CHECK_EQUAL(1, wire[17]);
+
+        const fixture::MessageView view(wire.data(), wire.size());
+        CHECK(view.isValid());
+        CHECK_EQUAL(wire.size(), view.wireSize());
+        CHECK_EQUAL(7U, view.header().sequence());
+        CHECK(view.isOrder());
+        CHECK_EQUAL(-125, view.asOrder().price());
+        CHECK(view.asOrder().side() == fixture::Side::sell);
+        CHECK_EQUAL("sell", to_string(view.asOrder().side()).str());
+    }
+
+    TEST(verifySnapshotRoundTrip)
+    {
+        const auto wire = encode(snapshot());
+
+        fixture::Message decoded;
+        CHECK(fixture::decode(wire.data(), wire.data() + wire.size(), decoded) == wire.data() + wire.size());
+
+        CHECK_EQUAL(3U, decoded.snapshotCase.count);
+        CHECK_EQUAL(3U, decoded.snapshotCase.levels.size());
+        CHECK_EQUAL(99, decoded.snapshotCase.levels[1].price);
+        CHECK_EQUAL(40U, decoded.snapshotCase.levels[2].quantity);
+        CHECK_EQUAL(3U, decoded.snapshotCase.sizes[2]);
+
+        const fixture::MessageView view(wire.data(), wire.size());
+        CHECK(view.isValid());
+        CHECK(view.isSnapshot());
+
+        std::int64_t prices = 0;
+        for(const auto level : view.asSnapshot().levels())
+        {
+            prices += level.price();
+        }
+
+        CHECK_EQUAL(297, prices);
+
+        // a truncated message is neither valid nor decoded
+        CHECK(!fixture::MessageView(wire.data(), wire.size() - 1).isValid());
+        CHECK(fixture::decode(wire.data(), wire.data() + wire.size() - 1, decoded) == nullptr);
+    }
+
+    TEST(verifyEncodeRejectsSizesItCantWrite)
+    {
+        std::string wire(4096, '\0');
+
+        // two vectors sized by Snapshot::count
+        auto mismatched = snapshot();
+        mismatched.snapshotCase.sizes.pop_back();
+        CHECK(fixture::encode(mismatched, &wire[0]) == nullptr);
+
+        // more levels than a u8 count holds
+        auto oversized = snapshot();
+        oversized.snapshotCase.levels.resize(256);
+        oversized.snapshotCase.sizes.resize(256);
+        wire.resize(size(oversized));
+        CHECK(fixture::encode(oversized, &wire[0]) == nullptr);
+    }
+
+    TEST(verifyEncodeRejectsUnknownCase)
+    {
+        auto unknown = order();
+        unknown.header.type = 'X';
+
+        // nothing to write for the block, but decode() would refuse the message
+        std::string wire(size(unknown), '\0');
+        CHECK(fixture::encode(unknown, &wire[0]) == nullptr);
+        CHECK(fixture::decode(wire.data(), wire.data() + wire.size(), unknown) == nullptr);
+    }
+
+    TEST(verifyArenaReplay)
+    {
+        // orders and snapshots of 0 to 4 levels and 0 to 2 tags, 16 a batch
+        std::vector<std::string> feed;
+        for(std::size_t i = 0; i < 64; ++i)
+        {
+            auto message = (i % 5) ? snapshot() : order();
+            message.tags.resize(i % 3, static_cast<std::uint32_t>(i));
+            message.snapshotCase.levels.resize(i % 5, { static_cast<std::int64_t>(i), 1 });
+            message.snapshotCase.sizes.resize(i % 5, static_cast<std::uint16_t>(i));
+
+            feed.push_back(encode(message));
+        }
+
+        char buffer[256];
+        swizzle::runtime::Arena arena(buffer, sizeof(buffer));
+        std::vector<fixture::Message> batch(16);
+
+        std::int64_t sum = 0;
+        std::size_t steady = 0;
+
+        for(std::size_t replay = 0; replay < 4; ++replay)
+        {
+            // the first replay grows the arena past the buffer
+            const auto allocations = swizzle::driver::threadAllocations();
+
+            for(std::size_t first = 0; first < feed.size(); first += batch.size())
+            {
+                arena.reset();
+
+                for(std::size_t i = 0; i < batch.size(); ++i)
+                {
+                    const auto& wire = feed[first + i];
+                    CHECK(fixture::decode(wire.data(), wire.data() + wire.size(), batch[i], &arena) != nullptr);
+                }
+
+                // an order empties the snapshot a reused message held
+                for(const auto& message : batch)
+                {
+                    for(const auto& level : message.snapshotCase.levels)
+                    {
+                        sum += level.price + message.tags.size();
+                    }
+                }
+            }
+
+            steady = swizzle::driver::threadAllocations() - allocations;
+        }
+
+        CHECK_EQUAL(0U, steady);
+        CHECK(arena.capacity() > sizeof(buffer));
+
+        for(const auto& message : batch)
+        {
+            if(message.header.type == 'O')
+            {
+                CHECK(message.snapshotCase.levels.empty());
+                CHECK(message.snapshotCase.levels.get_allocator().arena() == nullptr);
+            }
+        }
+
+        // the same values decoded onto the heap, and copies leave the arena
+        std::int64_t heapSum = 0;
+        const auto allocations = swizzle::driver::threadAllocations();
+
+        for(const auto& wire : feed)
+        {
+            fixture::Message message;
+            fixture::decode(wire.data(), wire.data() + wire.size(), message);
+
+            for(const auto& level : message.snapshotCase.levels)
+            {
+                heapSum += level.price + message.tags.size();
+            }
+        }
+
+        CHECK_EQUAL(sum, 4 * heapSum);
+        CHECK(swizzle::driver::threadAllocations() > allocations);
+
+        const auto copy = batch[3];
+        CHECK(copy.snapshotCase.levels.get_allocator().arena() == nullptr);
+        CHECK(batch[3].snapshotCase.levels.get_allocator().arena() == &arena);
+    }
+
+    TEST(verifyColumnsMatchDecode)
+    {
+        std::vector<std::string> wires;
+        for(std::size_t i = 0; i < 300; ++i)
+        {
+            auto message = (i % 3) ? order() : snapshot();
+            message.header.sequence = static_cast<std::uint32_t>(i);
+            wires.push_back(encode(message));
+        }
+
+        std::vector<const char*> messages;
+        std::vector<std::size_t> lengths;
+        for(const auto& wire : wires)
+        {
+            messages.push_back(wire.data());
+            lengths.push_back(wire.size());
+        }
+
+        fixture::MessageColumns columns;
+        CHECK_EQUAL(wires.size(), decodeColumns(messages.data(), lengths.data(), messages.size(), columns));
+        CHECK_EQUAL(wires.size(), columns.count_);
+        CHECK_EQUAL(200U, columns.orderCase.size());
+        CHECK_EQUAL(100U, columns.snapshotCase.size());
+
+        for(std::size_t i = 0; i < wires.size(); ++i)
+        {
+            fixture::Message decoded;
+            fixture::decode(wires[i].data(), wires[i].data() + wires[i].size(), decoded);
+
+            CHECK_EQUAL(decoded.header.sequence, columns.header_sequence[i]);
+            CHECK_EQUAL(decoded.tags.size(), columns.tagCount[i]);
+
+            if(decoded.header.type == 'S')
+            {
+                const auto& levels = columns.snapshotCase[columns.variableBlock_index[i]].levels;
+                CHECK_EQUAL(decoded.snapshotCase.levels.back().price, levels.back().price);
+            }
+            else
+            {
+                CHECK_EQUAL(decoded.orderCase.price, columns.orderCase[columns.variableBlock_index[i]].price);
+            }
+        }
+
+        // an invalid message ends the batch
+        lengths[5] = 3;
+        clear(columns);
+        CHECK_EQUAL(5U, decodeColumns(messages.data(), lengths.data(), messages.size(), columns));
+        CHECK_EQUAL(5U, columns.header_sequence.size());
+    }
+}
@@ -0,0 +1,197 @@
+#include "./ut_support/UnitTestSupport.hpp"
+
+#include <swizzle/Exceptions.hpp>
+#include <swizzle/ast/Layout.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/VariableBlock.hpp>
+
+#include <swizzle/lexer/Tokenizer.hpp>
+#include <swizzle/parser/Parser.hpp>
+
+#include <boost/utility/string_view.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+    using namespace swizzle::ast;
+    using namespace swizzle::lexer;
+    using namespace swizzle::parser;
+
+    struct CreateTokenCallback
+    {
+        CreateTokenCallback(std::deque<TokenInfo>& tokens)
+            : tokens_(tokens)
+        {
+        }
+
+        void operator()(const TokenInfo& token)
+        {
+            tokens_.push_back(token);
+        }
+
+    private:
+        std::deque<TokenInfo>& tokens_;
+    };
+
+    struct LayoutFixture
+    {
+        void parse(const boost::string_view& source)
+        {
+            std::deque<TokenInfo> tokens;
+            CreateTokenCallback callback(tokens);
+            Tokenizer<CreateTokenCallback> tokenizer("test.swizzle", callback);
+
+            for(std::size_t position = 0, end = source.length(); position < end; ++position)
+            {
+                tokenizer.consume(source, position);
+            }
+
+            tokenizer.flush();
+
+            for(const auto& token : tokens)
+            {
+                parser.consume(token);
+            }
+
+            parser.finalize();
+        }
+
+        nodes::Struct& structNamed(const std::string& name)
+        {
+            for(const auto& node : parser.ast().index().of<nodes::Struct>())
+            {
+                if(static_cast<nodes::Struct&>(*node).name() == name)
+                {
+                    return static_cast<nodes::Struct&>(*node);
+                }
+            }
+
+            throw std::runtime_error("no struct " + name);
+        }
+
+        const FieldLayout& field(const std::string& structure, const std::string& name)
+        {
+            for(const auto& child : structNamed(structure).children())
+            {
+                if((child->kind() == NodeKind::StructField) && (static_cast<const nodes::StructField&>(*child).name().token().value() == name))
+                {
+                    return static_cast<const nodes::StructField&>(*child).layout();
+                }
+            }
+
+            throw std::runtime_error("no field " + name);
+        }
+
+        Parser parser;
+    };
+
+    TEST_FIXTURE(LayoutFixture, verifyFixedSizeStruct)
+    {
+        parse(
+            "namespace foo;\n"
+            "enum Side : u8 { buy, sell, }\n"
+            "bitfield Flags : u16 { a : 0, b : 1..3, }\n"
+            "struct Header {\n"
+            "\tu8 type;\n"
+            "\tu16 length;\n"
+            "\tSide side;\n"
+            "\tFlags flags;\n"
+            "\tf64 price;\n"
+            "}\n"
+            "struct Message {\n"
+            "\tHeader header;\n"
+            "\tu32[4] ids;\n"
+            "}\n");
+
+        computeLayout(parser.ast());
+
+        const auto& header = structNamed("foo::Header");
+        CHECK(header.hasLayout());
+        CHECK(header.layout().fixed());
+        CHECK_EQUAL(14U, header.layout().FixedPrefix);
+        CHECK_EQUAL(14U, header.layout().MinSize);
+
+        CHECK_EQUAL(0U, field("foo::Header", "type").Offset);
+        CHECK_EQUAL(1U, field("foo::Header", "length").Offset);
+        CHECK_EQUAL(3U, field("foo::Header", "side").Offset);
+        CHECK_EQUAL(4U, field("foo::Header", "flags").Offset);
+        CHECK_EQUAL(6U, field("foo::Header", "price").Offset);
+
+        const auto& ids = field("foo::Message", "ids");
+        CHECK(ids.FixedOffset);
+        CHECK_EQUAL(14U, ids.Offset);
+        CHECK_EQUAL(4U, ids.ElementSize);
+        CHECK_EQUAL(16U, ids.MinSize);
+
+        CHECK_EQUAL(30U, structNamed("foo::Message").layout().MaxSize);
+    }
+
+    TEST_FIXTURE(LayoutFixture, verifyVariableRegion)
+    {
+        parse(
+            "namespace foo;\n"
+            "struct Small { u8 a; }\n"
+            "struct Large { u64 a; u64 b; }\n"
+            "struct Message {\n"
+            "\tu8 count;\n"
+            "\tu16[count] values;\n"
+            "\tu32 after;\n"
+            "\tvariable_block : count {\n"
+            "\t\tcase 0 : Small,\n"
+            "\t\tcase 1 : Large,\n"
+            "\t}\n"
+            "}\n");
+
+        computeLayout(parser.ast());
+
+        const auto& values = field("foo::Message", "values");
+        CHECK(values.FixedOffset);
+        CHECK_EQUAL(1U, values.Offset);
+        CHECK_EQUAL(2U, values.ElementSize);
+        CHECK_EQUAL(0U, values.MinSize);
+        CHECK_EQUAL(510U, values.MaxSize);
+
+        CHECK(!field("foo::Message", "after").FixedOffset);
+
+        const auto& message = structNamed("foo::Message");
+        CHECK(!message.layout().fixed());
+        CHECK_EQUAL(1U, message.layout().FixedPrefix);
+        CHECK_EQUAL(1U + 4U + 1U, message.layout().MinSize);
+        CHECK_EQUAL(1U + 510U + 4U + 16U, message.layout().MaxSize);
+
+        for(const auto& child : message.children())
+        {
+            if(child->kind() == NodeKind::VariableBlock)
+            {
+                const auto& block = static_cast<const nodes::VariableBlock&>(*child).layout();
+                CHECK_EQUAL(1U, block.MinSize);
+                CHECK_EQUAL(16U, block.MaxSize);
+            }
+        }
+    }
+
+    TEST_FIXTURE(LayoutFixture, verifyStructContainingItselfThrows)
+    {
+        parse(
+            "namespace foo;\n"
+            "struct Node { u8 a; Node next; }\n");
+
+        CHECK_THROW(computeLayout(parser.ast()), swizzle::SyntaxError);
+    }
+
+    TEST_FIXTURE(LayoutFixture, verifyRecursiveVectorIsUnbounded)
+    {
+        parse(
+            "namespace foo;\n"
+            "struct Node { u8 count; Node[count] children; }\n");
+
+        const auto& node = layout(structNamed("foo::Node"));
+        CHECK_EQUAL(1U, node.MinSize);
+        CHECK_EQUAL(SizeRange::Unbounded, node.MaxSize);
+    }
+}
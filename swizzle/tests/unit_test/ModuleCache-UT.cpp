@@ -0,0 +1,59 @@
+#include "./ut_support/UnitTestSupport.hpp"
+
+#include <swizzle/driver/ModuleCache.hpp>
+
+#include <memory>
+
+namespace {
+
+    using namespace swizzle::driver;
+
+    struct ModuleCacheFixture
+    {
+        std::shared_ptr<Module> module(const char* path)
+        {
+            return std::make_shared<Module>(path, "/");
+        }
+
+        ModuleCache cache = ModuleCache(2);
+    };
+
+    TEST_FIXTURE(ModuleCacheFixture, verifyFind)
+    {
+        const auto a = module("a.swizzle");
+        cache.insert("a.swizzle", a);
+
+        CHECK_EQUAL(a, cache.find("a.swizzle"));
+        CHECK(cache.find("b.swizzle") == nullptr);
+    }
+
+    TEST_FIXTURE(ModuleCacheFixture, verifyLeastRecentlyUsedEvicted)
+    {
+        cache.insert("a.swizzle", module("a.swizzle"));
+        cache.insert("b.swizzle", module("b.swizzle"));
+        cache.insert("a.swizzle", module("a.swizzle"));     // a is now the most recent
+        cache.insert("c.swizzle", module("c.swizzle"));
+
+        CHECK_EQUAL(2U, cache.size());
+        CHECK(cache.find("a.swizzle") != nullptr);
+        CHECK(cache.find("b.swizzle") == nullptr);
+        CHECK(cache.find("c.swizzle") != nullptr);
+    }
+
+    TEST_FIXTURE(ModuleCacheFixture, verifyErase)
+    {
+        cache.insert("a.swizzle", module("a.swizzle"));
+        cache.erase("a.swizzle");
+
+        CHECK_EQUAL(0U, cache.size());
+        CHECK(cache.find("a.swizzle") == nullptr);
+    }
+
+    TEST(verifyZeroCapacityCachesNothing)
+    {
+        ModuleCache cache(0);
+        cache.insert("a.swizzle", std::make_shared<Module>("a.swizzle", "/"));
+
+        CHECK_EQUAL(0U, cache.size());
+    }
+}
@@ -0,0 +1,152 @@
+#include "./ut_support/UnitTestSupport.hpp"
+#include "./ut_support/TemporaryDirectory.hpp"
+
+#include <swizzle/driver/BuildReport.hpp>
+#include <swizzle/driver/Command.hpp>
+#include <swizzle/driver/Driver.hpp>
+#include <swizzle/driver/OutputCache.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <ctime>
+#include <sstream>
+#include <string>
+
+namespace {
+
+    using namespace swizzle::driver;
+
+    struct OutputCacheFixture : public TemporaryDirectory
+    {
+        OutputCacheFixture()
+        {
+            options.ImportRoot = root / "src";
+            options.OutputCache = root / "cache";
+            options.Threads = 2;
+
+            command.Files = { root / "src" / "foo" / "Top.swizzle" };
+            command.EmitAst = root / "out";
+
+            write("foo/Base.swizzle", "namespace foo;\nstruct Base {\n\tu8 a;\n}\n");
+            write("foo/Top.swizzle", "import foo::Base;\nnamespace foo;\nstruct Top {\n\tfoo::Base b;\n}\n");
+        }
+
+        void write(const boost::filesystem::path& path, const std::string& contents)
+        {
+            TemporaryDirectory::write("src" / path, contents);
+        }
+
+        // @return the number of modules compiled
+        std::uint64_t build()
+        {
+            Driver driver(options);
+            BuildReport report;
+            std::ostringstream errors;
+
+            CHECK(runCommand(driver, command, errors, &report));
+            CHECK_EQUAL("", errors.str());
+
+            return report.files();
+        }
+
+        DriverOptions options;
+        Command command;
+    };
+
+    TEST_FIXTURE(OutputCacheFixture, verifyManifestRoundTrip)
+    {
+        OutputCache cache(root / "cache", 1 << 20);
+
+        DependencyRecord manifest;
+        manifest.ContentHash = 0x1234;
+        manifest.InterfaceHash = 0xabcd;
+        manifest.Imports = { "foo/Base.swizzle" };
+        cache.insert(42, manifest);
+
+        DependencyRecord found;
+        CHECK(cache.find(42, found));
+        CHECK_EQUAL(0x1234U, found.ContentHash);
+        CHECK_EQUAL(0xabcdU, found.InterfaceHash);
+        CHECK_EQUAL(1U, found.Imports.size());
+
+        CHECK(!cache.find(43, found));
+    }
+
+    TEST_FIXTURE(OutputCacheFixture, verifyArtifactsRoundTrip)
+    {
+        OutputCache cache(root / "cache", 1 << 20);
+
+        // binary contents, including newlines
+        const std::string bytes("a\nb\0c\n", 6);
+        cache.insert(7, OutputCache::Artifacts { { "foo/Top.swzast", bytes }, { "foo/Top.hpp", "" } });
+
+        OutputCache::Artifacts found;
+        CHECK(cache.find(7, found));
+        CHECK_EQUAL(2U, found.size());
+        CHECK_EQUAL("foo/Top.swzast", found[0].first);
+        CHECK(bytes == found[0].second);
+        CHECK_EQUAL("", found[1].second);
+    }
+
+    TEST_FIXTURE(OutputCacheFixture, verifyTrimRemovesLeastRecentlyUsed)
+    {
+        OutputCache cache(root / "cache", 3000);
+
+        const std::string kilobyte(1000, 'x');
+        for(std::uint64_t key = 0; key < 4; ++key)
+        {
+            cache.insert(key, OutputCache::Artifacts { { "a", kilobyte } });
+        }
+
+        // key 0 is the oldest, but was just used
+        for(boost::filesystem::recursive_directory_iterator iter(root / "cache"), end; iter != end; ++iter)
+        {
+            if(boost::filesystem::is_regular_file(iter->status()))
+            {
+                boost::filesystem::last_write_time(iter->path(), std::time(nullptr) - 100);
+            }
+        }
+
+        OutputCache::Artifacts found;
+        CHECK(cache.find(0, found));
+
+        cache.trim();
+        CHECK(cache.size() <= 2700U);
+        CHECK(cache.find(0, found));
+    }
+
+    TEST_FIXTURE(OutputCacheFixture, verifyHitSkipsCompile)
+    {
+        CHECK_EQUAL(2U, build());
+
+        boost::filesystem::remove_all(root / "out");
+        CHECK_EQUAL(0U, build());
+
+        CHECK(boost::filesystem::exists(root / "out" / "foo" / "Top.swzast"));
+        CHECK(boost::filesystem::exists(root / "out" / "foo" / "Base.swzast"));
+    }
+
+    TEST_FIXTURE(OutputCacheFixture, verifyChangedImportMisses)
+    {
+        CHECK_EQUAL(2U, build());
+
+        write("foo/Base.swizzle", "namespace foo;\nstruct Base {\n\tu16 a;\n}\n");
+        CHECK_EQUAL(2U, build());
+
+        // and the new outputs were cached in turn
+        CHECK_EQUAL(0U, build());
+    }
+
+    TEST_FIXTURE(OutputCacheFixture, verifyDepfileFromCache)
+    {
+        command.Depfile = root / "out" / "deps.d";
+        build();
+
+        boost::filesystem::remove(command.Depfile);
+        CHECK_EQUAL(0U, build());
+
+        boost::filesystem::ifstream is(command.Depfile);
+        const std::string depfile((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+        CHECK(depfile.find("Base.swizzle") != std::string::npos);
+    }
+}
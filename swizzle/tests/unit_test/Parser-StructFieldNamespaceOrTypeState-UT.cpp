@@ -41,6 +41,8 @@ namespace {
         NodeStack attributeStack;
         TokenStack tokenStack;
         ParserStateContext context;
+
+        const Node::smartptr userType = new Node();   // the TypeCache doesn't own its entries
     };
 
     TEST_FIXTURE(StructFieldNamespaceOrTypeStateFixture, verifyConstruction)
@@ -190,8 +192,6 @@ namespace {
             auto node = detail::appendNode<nodes::StructField>(nodeStack);
             nodeStack.push(node);
 
-            const std::string s = "foo::bar::MyType";
-
             const Token t1 = Token(s, 0, 3, TokenType::string);
             const FileInfo f1 = FileInfo("test.swizzle", LineInfo(1U, 1U), LineInfo(1U, 4U));
             tokenStack.push(TokenInfo(t1, f1));
@@ -204,9 +204,11 @@ namespace {
             const FileInfo f3 = FileInfo("test.swizzle", LineInfo(1U, 11U), LineInfo(1U, 17U));
             tokenStack.push(TokenInfo(t3, f3));
 
-            context.TypeCache["foo::bar::MyType"] = new Node();
+            context.TypeCache["foo::bar::MyType"] = userType.get();
         }
 
+        const std::string s = "foo::bar::MyType";
+
         const Token token = Token("field1", 0, 6, TokenType::string);
         const FileInfo fileInfo = FileInfo("test.swizzle");
 
@@ -261,7 +263,7 @@ namespace {
             const FileInfo f3 = FileInfo("test.swizzle", LineInfo(1U, 11U), LineInfo(1U, 17U));
             tokenStack.push(TokenInfo(t3, f3));
 
-            context.TypeCache["foo::bar::MyType"] = new Node();
+            context.TypeCache["foo::bar::MyType"] = userType.get();
         }
 
         const std::string s = "foo::bar::MyType";
@@ -317,7 +319,7 @@ namespace {
             tokenStack.push(TokenInfo(t3, f3));
 
             context.CurrentNamespace = "foo::bar";
-            context.TypeCache["foo::bar::MyType"] = new Node();
+            context.TypeCache["foo::bar::MyType"] = userType.get();
         }
 
         const Token token = Token("field1", 0, 6, TokenType::string);
@@ -366,7 +368,7 @@ namespace {
             tokenStack.push(TokenInfo(t3, f3));
 
             context.CurrentNamespace = "foo::bar";
-            context.TypeCache["foo::bar::MyType"] = new Node();
+            context.TypeCache["foo::bar::MyType"] = userType.get();
         }
 
         const Token token = Token("field1", 0, 6, TokenType::string);
@@ -7,6 +7,7 @@
 #include <swizzle/ast/nodes/AttributeBlock.hpp>
 #include <swizzle/ast/nodes/CharLiteral.hpp>
 #include <swizzle/ast/nodes/Comment.hpp>
+#include <swizzle/ast/nodes/FieldLabel.hpp>
 #include <swizzle/ast/nodes/HexLiteral.hpp>
 #include <swizzle/ast/nodes/MultilineComment.hpp>
 #include <swizzle/ast/nodes/NumericLiteral.hpp>
@@ -545,6 +546,45 @@ namespace {
         CHECK(detail::nodeStackTopIs<nodes::StructField>(nodeStack));
     }
 
+    struct WhenNextTokenIsU8AfterFieldLabel : public StructStartScopeStateFixture
+    {
+        WhenNextTokenIsU8AfterFieldLabel()
+        {
+            const auto label = TokenInfo(Token("1", 0, 1, TokenType::numeric_literal), FileInfo("test.swizzle"));
+            state.consume(label, nodeStack, attributeStack, tokenStack, context);
+        }
+
+        const Token token = Token("u8", 0, 2, TokenType::type);
+        const FileInfo fileInfo = FileInfo("test.swizzle");
+
+        const TokenInfo info = TokenInfo(token, fileInfo);
+    };
+
+    TEST_FIXTURE(WhenNextTokenIsU8AfterFieldLabel, verifyConsume)
+    {
+        auto matcher = Matcher().hasChildOf<nodes::StructField>();
+
+        CHECK_EQUAL(3U, nodeStack.size());
+        CHECK(detail::nodeStackTopIs<nodes::FieldLabel>(nodeStack));
+
+        const auto parserState = state.consume(info, nodeStack, attributeStack, tokenStack, context);
+
+        CHECK_EQUAL(ParserState::StructFieldNamespaceOrType, parserState);
+
+        REQUIRE CHECK_EQUAL(4U, nodeStack.size());
+        CHECK(detail::nodeStackTopIs<nodes::StructField>(nodeStack));
+        CHECK(!matcher(nodeStack.top()));
+
+        // the field is the struct's, the label waits beneath it to be attached
+        nodeStack.pop();
+        CHECK(detail::nodeStackTopIs<nodes::FieldLabel>(nodeStack));
+        CHECK(!matcher(nodeStack.top()));
+
+        nodeStack.pop();
+        CHECK(detail::nodeStackTopIs<nodes::Struct>(nodeStack));
+        CHECK(matcher(nodeStack.top()));
+    }
+
     struct WhenNextTokenIsI8 : public StructStartScopeStateFixture
     {
         const Token token = Token("i8", 0, 2, TokenType::type);
@@ -34,6 +34,8 @@ namespace {
         NodeStack attributeStack;
         TokenStack tokenStack;
         ParserStateContext context;
+
+        Node::smartptr caseType;    // the TypeCache doesn't own its entries
     };
 
     TEST_FIXTURE(StructVariableBlockCaseBlockNameReadStateFixture, verifyConstruction)
@@ -71,7 +73,8 @@ namespace {
             tokenStack.push(TokenInfo(Token(s, 14, 5, TokenType::string), FileInfo("test.swizzle", LineInfo(0, 14), LineInfo(0, 19))));
             tokenStack.push(TokenInfo(Token(s, 21, 8, TokenType::string), FileInfo("test.swizzle", LineInfo(0, 21), LineInfo(0, 29))));
 
-            context.TypeCache[s] = new nodes::Struct(info, name, "my_namespace::other");
+            caseType = new nodes::Struct(info, name, "my_namespace::other");
+            context.TypeCache[s] = caseType.get();
         }
 
         const std::string s = "my_namespace::other::MyStruct";
@@ -112,7 +115,8 @@ namespace {
             tokenStack.push(TokenInfo(Token(s, 14, 5, TokenType::string), FileInfo("test.swizzle", LineInfo(0, 14), LineInfo(0, 19))));
             tokenStack.push(TokenInfo(Token(s, 21, 8, TokenType::string), FileInfo("test.swizzle", LineInfo(0, 21), LineInfo(0, 29))));
 
-            context.TypeCache[s] = new nodes::Struct(info, name, "my_namespace::other");
+            caseType = new nodes::Struct(info, name, "my_namespace::other");
+            context.TypeCache[s] = caseType.get();
         }
 
         const std::string s = "my_namespace::other::MyStruct";
@@ -33,6 +33,8 @@ namespace {
         NodeStack attributeStack;
         TokenStack tokenStack;
         ParserStateContext context;
+
+        Node::smartptr variableOnField;     // the context doesn't own the field
     };
 
     TEST_FIXTURE(StructVariableBlockCaseValueStateFixture, verifyConstruction)
@@ -51,7 +53,8 @@ namespace {
             node = detail::appendNode<nodes::VariableBlockCase>(nodeStack);
             nodeStack.push(node);
 
-            context.CurrentVariableOnFieldType = new nodes::StructField();
+            variableOnField = new nodes::StructField();
+            context.CurrentVariableOnFieldType = variableOnField.get();
             auto& structField = static_cast<nodes::StructField&>(*context.CurrentVariableOnFieldType);
             structField.name(fieldName);
             structField.type("u8");
@@ -153,7 +156,8 @@ namespace {
             node = detail::appendNode<nodes::VariableBlockCase>(nodeStack);
             nodeStack.push(node);
 
-            context.CurrentVariableOnFieldType = new nodes::StructField();
+            variableOnField = new nodes::StructField();
+            context.CurrentVariableOnFieldType = variableOnField.get();
             auto& field = static_cast<nodes::StructField&>(*context.CurrentVariableOnFieldType);
             field.type("u8");
             field.makeArray(arraySize);
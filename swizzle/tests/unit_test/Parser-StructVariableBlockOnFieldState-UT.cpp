@@ -29,7 +29,7 @@ namespace{
             const auto node = detail::appendNode<nodes::Struct>(nodeStack, info, name, "my_namespace");
             nodeStack.push(node);
 
-            context.TypeCache["my_namespace::MyStruct"] = node;
+            context.TypeCache["my_namespace::MyStruct"] = node.get();
         }
 
         states::StructVariableBlockOnFieldState state;
@@ -27,7 +27,7 @@ namespace {
 
             auto node = detail::appendNode<nodes::Struct>(nodeStack, structKeyword, name, "my_namespace");
 
-            context.TypeCache["my_namespace::MyStruct"] = node;
+            context.TypeCache["my_namespace::MyStruct"] = node.get();
             nodeStack.push(node);
         }
 
@@ -2256,4 +2256,79 @@ namespace {
         tokenize(sv);
         CHECK_THROW(parse(), swizzle::SyntaxError);
     }
+
+    struct WhenInputHasMultipleTypes : public ParserFixture
+    {
+        const boost::string_view sv = boost::string_view(
+            "namespace foo;" "\n"
+            "enum Metal : u8 {" "\n"
+            "\t" "iron," "\n"
+            "\t" "copper," "\n"
+            "}" "\n"
+            "struct First {" "\n"
+            "\t" "u8 field1;" "\n"
+            "}" "\n"
+            "@packed" "\n"
+            "struct Second {" "\n"
+            "\t" "Metal metal;" "\n"
+            "\t" "u16 field2;" "\n"
+            "}"
+        );
+    };
+
+    TEST_FIXTURE(WhenInputHasMultipleTypes, verifyIndex)
+    {
+        tokenize(sv);
+        parse();
+
+        const auto& index = parser.ast().index();
+
+        const auto& structs = index.of<nodes::Struct>();
+        REQUIRE CHECK_EQUAL(2U, structs.size());
+        CHECK_EQUAL("foo::First", static_cast<nodes::Struct&>(*structs[0]).name());
+        CHECK_EQUAL("foo::Second", static_cast<nodes::Struct&>(*structs[1]).name());
+
+        CHECK_EQUAL(3U, index.of<nodes::StructField>().size());
+        CHECK_EQUAL(1U, index.of<nodes::Enum>().size());
+        CHECK_EQUAL(2U, index.of<nodes::EnumField>().size());
+        CHECK_EQUAL(1U, index.of<nodes::Attribute>().size());
+        CHECK_EQUAL(1U, index.of<nodes::Namespace>().size());
+        CHECK_EQUAL(0U, index.of<nodes::Bitfield>().size());
+    }
+
+    TEST_FIXTURE(WhenInputHasMultipleTypes, verifyFindAll)
+    {
+        tokenize(sv);
+        parse();
+
+        auto ast = parser.ast();
+
+        const auto structs = Matcher().isTypeOf<nodes::Struct>().findAll(ast);
+        CHECK_EQUAL(2U, structs.size());
+
+        const auto attributed = Matcher().isTypeOf<nodes::Struct, nodes::Enum>().hasChildOf<nodes::Attribute>().findAll(ast);
+        REQUIRE CHECK_EQUAL(1U, attributed.size());
+        CHECK_EQUAL("foo::Second", static_cast<nodes::Struct&>(*attributed[0]).name());
+    }
+
+    TEST_FIXTURE(WhenInputHasMultipleTypes, verifyFieldTypesResolveToDeclarations)
+    {
+        tokenize(sv);
+        parse();
+
+        const auto& index = parser.ast().index();
+
+        const auto& enums = index.of<nodes::Enum>();
+        const auto& fields = index.of<nodes::StructField>();
+        REQUIRE CHECK_EQUAL(3U, fields.size());
+
+        const auto& field1 = static_cast<nodes::StructField&>(*fields[0]);
+        CHECK_EQUAL("u8", field1.type());
+        CHECK(field1.typeDeclaration() == nullptr);
+
+        const auto& metal = static_cast<nodes::StructField&>(*fields[1]);
+        CHECK_EQUAL("foo::Metal", metal.type());
+        CHECK_EQUAL(enums[0].get(), metal.typeDeclaration());
+        CHECK(metal.typeSymbol() == static_cast<nodes::Enum&>(*enums[0]).symbol());
+    }
 }
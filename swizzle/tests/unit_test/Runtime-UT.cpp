@@ -0,0 +1,197 @@
+#include "./ut_support/UnitTestSupport.hpp"
+
+#include <swizzle/driver/AllocationCount.hpp>
+#include <swizzle/runtime/Arena.hpp>
+#include <swizzle/runtime/Bits.hpp>
+#include <swizzle/runtime/ByteOrder.hpp>
+#include <swizzle/runtime/ByteSwap.hpp>
+#include <swizzle/runtime/Columns.hpp>
+#include <swizzle/runtime/Range.hpp>
+#include <swizzle/runtime/Reflection.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using namespace swizzle::runtime;
+
+    TEST(verifyLoadAndStore)
+    {
+        char data[8] = {};
+
+        store<std::uint32_t, ByteOrder::Big>(data, 0x01020304);
+        CHECK_EQUAL(1, data[0]);
+        CHECK_EQUAL(4, data[3]);
+        CHECK_EQUAL(0x01020304U, (load<std::uint32_t, ByteOrder::Big>(data)));
+        CHECK_EQUAL(0x04030201U, (load<std::uint32_t, ByteOrder::Little>(data)));
+
+        store<std::int16_t, ByteOrder::Little>(data, -2);
+        CHECK_EQUAL(-2, (load<std::int16_t, ByteOrder::Little>(data)));
+
+        store<double, ByteOrder::Big>(data, 12.5);
+        CHECK_EQUAL(12.5, (load<double, ByteOrder::Big>(data)));
+    }
+
+    TEST(verifyFits)
+    {
+        CHECK(fits<std::uint8_t>(255));
+        CHECK(!fits<std::uint8_t>(256));
+        CHECK(!fits<std::int16_t>(32768));
+        CHECK(fits<std::uint64_t>(~std::size_t(0)));
+    }
+
+    TEST(verifyFixedRange)
+    {
+        const char data[] = { 0, 1, 0, 2, 0, 3 };
+        const FixedRange<Scalar<std::uint16_t, ByteOrder::Big>> range(data, 3);
+
+        CHECK_EQUAL(3U, range.size());
+        CHECK_EQUAL(6U, range.wireSize());
+        CHECK_EQUAL(2U, range[1]);
+
+        std::size_t sum = 0;
+        for(const auto value : range)
+        {
+            sum += value;
+        }
+
+        CHECK_EQUAL(6U, sum);
+    }
+
+    TEST(verifyLoadRunAndStoreRun)
+    {
+        // 19 elements: a 32 byte AVX2 block, a 16 byte SSSE3 one and a scalar tail
+        std::string data(19 * 2, '\0');
+        for(std::size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<char>(i);
+        }
+
+        std::vector<std::uint16_t> values(19);
+        loadRun<std::uint16_t, ByteOrder::Big>(data.data(), 19, values.data());
+
+        CHECK_EQUAL(0x0001U, values[0]);
+        CHECK_EQUAL(0x2021U, values[16]);
+        CHECK_EQUAL(0x2425U, values[18]);
+
+        std::string out(data.size(), '\0');
+        storeRun<std::uint16_t, ByteOrder::Big>(&out[0], values.data(), 19);
+        CHECK(out == data);
+    }
+
+    TEST(verifyGatherStrided)
+    {
+        // 13 records of 6 bytes, past one AVX2 block and into the scalar tail
+        std::string records(13 * 6, '\0');
+        for(std::size_t i = 0; i < 13; ++i)
+        {
+            store<std::uint32_t, ByteOrder::Big>(&records[i * 6 + 1], static_cast<std::uint32_t>(0x01020300 + i));
+        }
+
+        std::vector<std::uint32_t> out(13);
+        gatherStrided<std::uint32_t, ByteOrder::Big>(records.data() + 1, 6, 13, out.data());
+
+        CHECK_EQUAL(0x01020300U, out[0]);
+        CHECK_EQUAL(0x01020308U, out[8]);
+        CHECK_EQUAL(0x0102030cU, out[12]);
+    }
+
+    TEST(verifyGatherIndirect)
+    {
+        std::vector<std::string> messages;
+        std::vector<const char*> starts;
+        for(std::size_t i = 0; i < 6; ++i)
+        {
+            messages.push_back(std::string(3 + i, '\0'));
+        }
+
+        for(std::size_t i = 0; i < messages.size(); ++i)
+        {
+            messages[i].append(8, '\0');
+            store<std::uint64_t, ByteOrder::Little>(&messages[i][2], 0x1122334455667700ULL + i);
+            starts.push_back(messages[i].data());
+        }
+
+        std::vector<std::uint64_t> out(6);
+        gatherIndirect<std::uint64_t, ByteOrder::Little>(starts.data(), 2, 6, out.data());
+
+        CHECK_EQUAL(0x1122334455667700ULL, out[0]);
+        CHECK_EQUAL(0x1122334455667705ULL, out[5]);
+    }
+
+    TEST(verifyArenaAllocations)
+    {
+        Arena arena(64);
+
+        // a block, and the list of blocks
+        auto allocations = swizzle::driver::threadAllocations();
+        arena.allocate(8, 8);
+        CHECK_EQUAL(2U, swizzle::driver::threadAllocations() - allocations);
+
+        // none once the arena has a block, one without an arena
+        allocations = swizzle::driver::threadAllocations();
+        ArenaVector<std::uint32_t> arenaVector(4, 0, ArenaAllocator<std::uint32_t>(&arena));
+        CHECK_EQUAL(0U, swizzle::driver::threadAllocations() - allocations);
+
+        ArenaVector<std::uint32_t> heap(4);
+        CHECK_EQUAL(1U, swizzle::driver::threadAllocations() - allocations);
+
+        // a reset keeps the blocks
+        arena.reset();
+        allocations = swizzle::driver::threadAllocations();
+        arena.allocate(64, 8);
+        CHECK_EQUAL(0U, swizzle::driver::threadAllocations() - allocations);
+    }
+
+    TEST(verifyNames)
+    {
+        const std::string text = "sell";
+        const Name sell("sell");
+
+        CHECK(Name(text.data(), text.size()) == sell);
+        CHECK(Name("buy") != sell);
+        CHECK(Name("buy") < sell);
+        CHECK(Name("sel") < sell);
+        CHECK(!(sell < Name("sel")));
+        CHECK_EQUAL("sell", sell.str());
+
+        // FNV-1a
+        CHECK_EQUAL(0xcbf29ce484222325ULL, hashName("", 0));
+        CHECK_EQUAL(0xaf63dc4c8601ec8cULL, hashName("a", 1));
+    }
+
+#if defined(SWIZZLE_X86_SIMD)
+    struct Bits16
+    {
+        std::uint16_t value;
+    };
+
+    struct Lanes
+    {
+        std::uint8_t low;
+        std::uint8_t high;
+    };
+
+    TEST(verifySpreadBitsBmi2)
+    {
+        if(!hasBmi2())
+        {
+            return;
+        }
+
+        // bits 0..2 and 8..13 into a lane each
+        const Bits16 values[] = { { 0x2d05 }, { 0xffff } };
+        Lanes lanes[2];
+
+        spreadBitsBmi2(values, 2, 0x3f07, 0x3f07, lanes);
+
+        CHECK_EQUAL(5U, lanes[0].low);
+        CHECK_EQUAL(0x2dU, lanes[0].high);
+        CHECK_EQUAL(7U, lanes[1].low);
+        CHECK_EQUAL(0x3fU, lanes[1].high);
+    }
+#endif
+}
@@ -0,0 +1,98 @@
+#include "./ut_support/UnitTestSupport.hpp"
+#include "./ut_support/TemporaryDirectory.hpp"
+
+#include <swizzle/ast/NodeKind.hpp>
+#include <swizzle/bench/SchemaGenerator.hpp>
+#include <swizzle/bench/Statistics.hpp>
+#include <swizzle/driver/BuildReport.hpp>
+#include <swizzle/driver/Driver.hpp>
+
+#include <boost/filesystem.hpp>
+
+namespace {
+
+    using namespace swizzle;
+    using namespace swizzle::bench;
+
+    struct SchemaGeneratorFixture : public TemporaryDirectory
+    {
+        SchemaGeneratorFixture()
+        {
+            options.Files = 6;
+            options.ImportFanOut = 2;
+            options.NamespaceDepth = 3;
+            options.Attributes = 2;
+            options.VariableBlocks = 2;
+        }
+
+        driver::BuildReport compile(const SchemaGenerator& generator)
+        {
+            std::vector<boost::filesystem::path> files;
+            for(const auto& path : generator.write(root))
+            {
+                files.push_back(root / path);
+            }
+
+            driver::DriverOptions driverOptions;
+            driverOptions.ImportRoot = root;
+            driverOptions.Threads = 2;
+
+            driver::BuildReport report;
+            for(const auto& module : driver::Driver(driverOptions).compile(files))
+            {
+                CHECK_EQUAL("", module.second->error());
+                report.add(*module.second);
+            }
+
+            return report;
+        }
+
+        SchemaOptions options;
+    };
+
+    TEST_FIXTURE(SchemaGeneratorFixture, verifyDeterministic)
+    {
+        CHECK_EQUAL(SchemaGenerator(options).source(3), SchemaGenerator(options).source(3));
+
+        auto other = options;
+        other.Seed = 2;
+        CHECK(SchemaGenerator(options).source(3) != SchemaGenerator(other).source(3));
+    }
+
+    TEST_FIXTURE(SchemaGeneratorFixture, verifyPath)
+    {
+        CHECK_EQUAL("bench/level1/level2/Schema4.swizzle", SchemaGenerator(options).path(4).generic_string());
+    }
+
+    TEST_FIXTURE(SchemaGeneratorFixture, verifyGeneratedSchemasCompile)
+    {
+        const auto report = compile(SchemaGenerator(options));
+
+        CHECK_EQUAL(options.Files, report.files());
+        CHECK_EQUAL(options.Files * options.Structs, report.nodes(ast::NodeKind::Struct));
+        CHECK_EQUAL(options.Files * options.Enums, report.nodes(ast::NodeKind::Enum));
+        CHECK_EQUAL(options.Files * options.Enums * options.EnumValues, report.nodes(ast::NodeKind::EnumField));
+        CHECK_EQUAL(options.Files * options.Bitfields, report.nodes(ast::NodeKind::Bitfield));
+        CHECK_EQUAL(options.Files * options.VariableBlocks, report.nodes(ast::NodeKind::VariableBlock));
+        CHECK_EQUAL(9U, report.nodes(ast::NodeKind::Import));             // 0 + 1 + 2 + 2 + 2 + 2, by file
+    }
+
+    TEST_FIXTURE(SchemaGeneratorFixture, verifyWideSchemasCompile)
+    {
+        options.Files = 2;
+        options.EnumValues = 300;
+        options.BitfieldFields = 16;
+        options.Attributes = 0;
+        options.NamespaceDepth = 1;
+
+        const auto report = compile(SchemaGenerator(options));
+        CHECK_EQUAL(0U, report.nodes(ast::NodeKind::Attribute) + report.nodes(ast::NodeKind::AttributeBlock));
+    }
+
+    TEST(verifyMedian)
+    {
+        CHECK_EQUAL(0, median({}));
+        CHECK_EQUAL(2, median({ 3, 1, 2 }));
+        CHECK_EQUAL(2.5, median({ 4, 1, 3, 2 }));
+    }
+}
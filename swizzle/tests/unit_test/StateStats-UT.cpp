@@ -0,0 +1,73 @@
+#include "./ut_support/UnitTestSupport.hpp"
+
+#include <swizzle/lexer/TokenInfo.hpp>
+#include <swizzle/parser/Parser.hpp>
+#include <swizzle/profile/StateStats.hpp>
+
+#include <sstream>
+
+namespace {
+
+    using namespace swizzle;
+    using namespace swizzle::parser;
+
+    using Stats = profile::StateStats<ParserState, ParserStateCount>;
+
+    TEST(verifyTransitionsCounted)
+    {
+        Stats stats;
+        stats.transition(ParserState::Init, 10);
+        stats.transition(ParserState::Init, 5);
+        stats.exception(ParserState::StructName, 3);
+
+        CHECK_EQUAL(2U, stats[ParserState::Init].Transitions);
+        CHECK_EQUAL(15U, stats[ParserState::Init].Cycles);
+        CHECK_EQUAL(0U, stats[ParserState::Init].Exceptions);
+
+        CHECK_EQUAL(1U, stats[ParserState::StructName].Transitions);
+        CHECK_EQUAL(1U, stats[ParserState::StructName].Exceptions);
+        CHECK_EQUAL(3U, stats.transitions());
+    }
+
+    TEST(verifyAccumulate)
+    {
+        Stats a;
+        a.transition(ParserState::Init, 1);
+
+        Stats b;
+        b.transition(ParserState::Init, 2);
+        b.transition(ParserState::StartNamespace, 4);
+
+        a += b;
+
+        CHECK_EQUAL(2U, a[ParserState::Init].Transitions);
+        CHECK_EQUAL(3U, a[ParserState::Init].Cycles);
+        CHECK_EQUAL(1U, a[ParserState::StartNamespace].Transitions);
+
+        a.clear();
+        CHECK_EQUAL(0U, a.transitions());
+    }
+
+    TEST(verifyPrintMostCyclesFirst)
+    {
+        Stats stats;
+        stats.transition(ParserState::Init, 1);
+        stats.transition(ParserState::StartNamespace, 100);
+
+        std::ostringstream os;
+        stats.print(os);
+
+        const auto s = os.str();
+        CHECK(s.find("ParserState::StartNamespace") < s.find("ParserState::Init"));
+        CHECK(s.find("ParserState::StructName") == std::string::npos);
+    }
+
+    TEST(verifyParserStats)
+    {
+        Parser parser;
+        parser.consume(lexer::TokenInfo(lexer::Token("namespace", 0, 9, lexer::TokenType::keyword), lexer::FileInfo("test.swizzle")));
+
+        const auto expected = Stats::Enabled ? 1U : 0U;
+        CHECK_EQUAL(expected, parser.stats()[ParserState::Init].Transitions);
+    }
+}
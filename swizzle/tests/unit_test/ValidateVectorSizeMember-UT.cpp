@@ -54,7 +54,7 @@ namespace {
             nodeStack.push(ast.root());
 
             auto node = make_struct("my_namespace", "MyStruct");
-            context.TypeCache["my_namespace::MyStruct"] = node;
+            context.TypeCache["my_namespace::MyStruct"] = node.get();
             nodeStack.push(node);
 
             node = make_field("u8", field1);
@@ -83,7 +83,7 @@ namespace {
 
             // my_namespace::struct1
             auto node = make_struct("my_namespace", "struct1");
-            context.TypeCache["my_namespace::struct1"] = node;
+            context.TypeCache["my_namespace::struct1"] = node.get();
             nodeStack.push(node);
 
             node = make_field("other_namespace::struct2", field1);
@@ -92,7 +92,7 @@ namespace {
 
             // other_namespace::struct2
             node = make_struct("other_namespace", "struct2");
-            context.TypeCache["other_namespace::struct2"] = node;
+            context.TypeCache["other_namespace::struct2"] = node.get();
 
             nodeStack.push(node);
             node = make_field("other2::struct3", f1);
@@ -100,7 +100,7 @@ namespace {
 
             // other2::struct3
             node = make_struct("other2", "struct3");
-            context.TypeCache["other2::struct3"] = node;
+            context.TypeCache["other2::struct3"] = node.get();
 
             nodeStack.push(node);
             node = make_field("u8", field2);
@@ -132,7 +132,7 @@ namespace {
 
             // my_namespace::struct1
             auto node = make_struct("", "struct1");
-            context.TypeCache["my_namespace::struct1"] = node;
+            context.TypeCache["my_namespace::struct1"] = node.get();
             nodeStack.push(node);
 
             node = make_field("other_namespace::struct2", field1);
@@ -141,7 +141,7 @@ namespace {
 
             // other_namespace::struct2
             node = make_struct("other_namespace", "struct2");
-            context.TypeCache["other_namespace::struct2"] = node;
+            context.TypeCache["other_namespace::struct2"] = node.get();
 
             nodeStack.push(node);
             node = make_field("my_namespace::struct3", f1);
@@ -149,7 +149,7 @@ namespace {
 
             // other2::struct3
             node = make_struct("", "struct3");
-            context.TypeCache["my_namespace::struct3"] = node;
+            context.TypeCache["my_namespace::struct3"] = node.get();
 
             nodeStack.push(node);
             node = make_field("u8", field2);
@@ -179,7 +179,7 @@ namespace {
             nodeStack.push(ast.root());
 
             auto node = make_struct("my_namespace", "MyStruct");
-            context.TypeCache["my_namespace::MyStruct"] = node;
+            context.TypeCache["my_namespace::MyStruct"] = node.get();
             nodeStack.push(node);
 
             node = make_field("f32", field1);
@@ -203,7 +203,7 @@ namespace {
             nodeStack.push(ast.root());
 
             auto node = make_struct("my_namespace", "MyStruct");
-            context.TypeCache["my_namespace::MyStruct"] = node;
+            context.TypeCache["my_namespace::MyStruct"] = node.get();
             nodeStack.push(node);
 
             node = make_field("u8", field2);
@@ -229,10 +229,10 @@ namespace {
 
             // create ThatStruct
             auto node = make_struct("my_namespace", "ThatStruct");
-            context.TypeCache["my_namespace::ThatStruct"] = node;
+            context.TypeCache["my_namespace::ThatStruct"] = node.get();
 
             node = make_struct("my_namespace", "MyStruct");
-            context.TypeCache["my_namespace::MyStruct"] = node;
+            context.TypeCache["my_namespace::MyStruct"] = node.get();
             nodeStack.push(node);
 
             node = make_field("my_namespace::ThatStruct", field1);
@@ -0,0 +1,71 @@
+#include "./ut_support/UnitTestSupport.hpp"
+#include "./ut_support/TemporaryDirectory.hpp"
+
+#include <swizzle/driver/WriteIfChanged.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <iterator>
+#include <string>
+
+namespace {
+
+    using namespace swizzle::driver;
+
+    struct WriteIfChangedFixture : public TemporaryDirectory
+    {
+        WriteIfChangedFixture()
+            : file(root / "out" / "Generated.hpp")
+        {
+        }
+
+        std::string read()
+        {
+            boost::filesystem::ifstream is(file);
+            return std::string(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+        }
+
+        const boost::filesystem::path file;
+    };
+
+    TEST_FIXTURE(WriteIfChangedFixture, verifyCreatesFileAndDirectories)
+    {
+        CHECK(writeIfChanged(file, "struct A {};\n"));
+        CHECK_EQUAL("struct A {};\n", read());
+    }
+
+    TEST_FIXTURE(WriteIfChangedFixture, verifySameContentsNotWritten)
+    {
+        REQUIRE CHECK(writeIfChanged(file, "struct A {};\n"));
+
+        const std::time_t old = 1000;
+        boost::filesystem::last_write_time(file, old);
+
+        CHECK(!writeIfChanged(file, "struct A {};\n"));
+        CHECK_EQUAL(old, boost::filesystem::last_write_time(file));
+    }
+
+    TEST_FIXTURE(WriteIfChangedFixture, verifyChangedContentsWritten)
+    {
+        REQUIRE CHECK(writeIfChanged(file, "struct A {};\n"));
+
+        CHECK(writeIfChanged(file, "struct B {};\n"));
+        CHECK_EQUAL("struct B {};\n", read());
+
+        CHECK(writeIfChanged(file, "struct B { int x; };\n"));
+        CHECK_EQUAL("struct B { int x; };\n", read());
+
+        // no temporaries left behind
+        CHECK_EQUAL(1, std::distance(boost::filesystem::directory_iterator(file.parent_path()), boost::filesystem::directory_iterator()));
+    }
+
+    TEST_FIXTURE(WriteIfChangedFixture, verifyFailedRenameRemovesTemporary)
+    {
+        // a directory where the file should go can't be renamed over
+        boost::filesystem::create_directories(file / "taken");
+
+        CHECK_THROW(writeIfChanged(file, "struct A {};\n"), boost::filesystem::filesystem_error);
+        CHECK_EQUAL(1, std::distance(boost::filesystem::directory_iterator(file.parent_path()), boost::filesystem::directory_iterator()));
+        CHECK(boost::filesystem::is_directory(file));
+    }
+}
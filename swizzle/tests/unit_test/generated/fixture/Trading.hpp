@@ -0,0 +1,1125 @@
+// generated by swizzle, do not edit
+#pragma once
+#include <swizzle/runtime/Arena.hpp>
+#include <swizzle/runtime/Bits.hpp>
+#include <swizzle/runtime/ByteOrder.hpp>
+#include <swizzle/runtime/ByteSwap.hpp>
+#include <swizzle/runtime/Columns.hpp>
+#include <swizzle/runtime/Range.hpp>
+#include <swizzle/runtime/Reflection.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace fixture {
+
+    enum class Side : std::uint8_t
+    {
+        buy = 0,
+        sell = 1,
+    };
+
+    // the name of @value, empty for a value no enumerator has
+    inline ::swizzle::runtime::Name to_string(const Side value)
+    {
+        static constexpr ::swizzle::runtime::Name Names[2] = {
+            "buy", "sell",
+        };
+
+        const auto slot = static_cast<std::uint64_t>(static_cast<std::uint8_t>(value)) - 0ULL;
+        return (slot < 2) ? Names[slot] : ::swizzle::runtime::Name();
+    }
+
+    // the enumerator named by the @size characters at @name, false for none
+    inline bool from_string(const char* name, const std::size_t size, Side& out)
+    {
+        static constexpr ::swizzle::runtime::Name Names[4] = {
+            "", "", "buy", "sell",
+        };
+        static constexpr Side Values[4] = {
+            Side(), Side(), Side::buy, Side::sell,
+        };
+
+        const auto slot = (::swizzle::runtime::hashName(name, size) * 7960286522194355701ULL) >> 62;
+        if((size == 0) || (Names[slot].size() != size) || (std::memcmp(Names[slot].data(), name, size) != 0))
+        {
+            return false;
+        }
+
+        out = Values[slot];
+        return true;
+    }
+
+    inline bool from_string(const std::string& name, Side& out)
+    {
+        return from_string(name.data(), name.size(), out);
+    }
+
+    // compile time description of Side, swizzle::runtime::Metadata<Side>
+    struct SideMetadata
+    {
+        using Type = Side;
+
+        static constexpr ::swizzle::runtime::Name name() { return "fixture::Side"; }
+
+        using Underlying = std::uint8_t;
+
+        static constexpr std::size_t ValueCount = 2;
+        static constexpr std::size_t AttributeCount = 0;
+
+        static constexpr ::swizzle::runtime::EnumeratorInfo<::fixture::Side> value(const std::size_t i)
+        {
+            const ::swizzle::runtime::EnumeratorInfo<::fixture::Side> table[] = {
+                { "buy", ::fixture::Side::buy },
+                { "sell", ::fixture::Side::sell },
+            };
+
+            return table[i];
+        }
+
+        static constexpr ::swizzle::runtime::AttributeInfo attribute(const std::size_t) { return {}; }
+    };
+
+    SideMetadata metadata(const Side&);
+
+    struct OrderFlags
+    {
+        std::uint16_t value;
+
+        // bits 0..0
+        static constexpr std::uint16_t hiddenMask() { return 0x1; }
+        static constexpr unsigned hiddenShift() { return 0; }
+        constexpr std::uint16_t hidden() const { return static_cast<std::uint16_t>((value & hiddenMask()) >> hiddenShift()); }
+        void hidden(const std::uint16_t field_) { value = static_cast<std::uint16_t>((value & ~hiddenMask()) | ((field_ << hiddenShift()) & hiddenMask())); }
+
+        // bits 1..4
+        static constexpr std::uint16_t venueMask() { return 0x1e; }
+        static constexpr unsigned venueShift() { return 1; }
+        constexpr std::uint16_t venue() const { return static_cast<std::uint16_t>((value & venueMask()) >> venueShift()); }
+        void venue(const std::uint16_t field_) { value = static_cast<std::uint16_t>((value & ~venueMask()) | ((field_ << venueShift()) & venueMask())); }
+
+        // every field, each in a lane of its own, see unpack()
+        struct Fields
+        {
+            std::uint8_t hidden;
+            std::uint8_t venue;
+        };
+
+        constexpr Fields fields() const
+        {
+            return Fields { static_cast<std::uint8_t>(hidden()), static_cast<std::uint8_t>(venue()) };
+        }
+    };
+
+    // fields() of @count bitfields at once, through BMI2 when the CPU has it
+    inline void unpack(const OrderFlags* values, const std::size_t count, OrderFlags::Fields* out)
+    {
+#if defined(SWIZZLE_X86_SIMD)
+        if(::swizzle::runtime::hasBmi2())
+        {
+            ::swizzle::runtime::spreadBitsBmi2(values, count, 0x1fULL, 0xf01ULL, out);
+            return;
+        }
+#endif
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            out[i] = values[i].fields();
+        }
+    }
+
+    // compile time description of OrderFlags, swizzle::runtime::Metadata<OrderFlags>
+    struct OrderFlagsMetadata
+    {
+        using Type = OrderFlags;
+
+        static constexpr ::swizzle::runtime::Name name() { return "fixture::OrderFlags"; }
+
+        using Underlying = std::uint16_t;
+
+        static constexpr std::size_t FieldCount = 2;
+        static constexpr std::size_t AttributeCount = 0;
+
+        static constexpr ::swizzle::runtime::BitfieldFieldInfo field(const std::size_t i)
+        {
+            const ::swizzle::runtime::BitfieldFieldInfo table[] = {
+                { "hidden", 0, 0, 0x1ULL },
+                { "venue", 1, 4, 0x1eULL },
+            };
+
+            return table[i];
+        }
+
+        static constexpr ::swizzle::runtime::AttributeInfo attribute(const std::size_t) { return {}; }
+    };
+
+    OrderFlagsMetadata metadata(const OrderFlags&);
+
+    struct Header
+    {
+        std::uint16_t length {};
+        std::uint8_t type {};
+        std::uint32_t sequence {};
+    };
+
+    // decode the Header at @data into @out, its vectors into @arena if not null.
+    // @return one past its end, nullptr if it runs past @end or selects an unknown
+    // variable_block case
+    inline const char* decode(const char* data, const char* end, Header& out, ::swizzle::runtime::Arena* arena)
+    {
+        static_cast<void>(arena);
+        if(end - data < 7) return nullptr;
+        out.length = ::swizzle::runtime::load<std::uint16_t, ::swizzle::runtime::ByteOrder::Big>(data + 0);
+        out.type = ::swizzle::runtime::load<std::uint8_t, ::swizzle::runtime::ByteOrder::Big>(data + 2);
+        out.sequence = ::swizzle::runtime::load<std::uint32_t, ::swizzle::runtime::ByteOrder::Big>(data + 3);
+        data += 7;
+        return data;
+    }
+
+    inline const char* decode(const char* data, const char* end, Header& out)
+    {
+        return decode(data, end, out, nullptr);
+    }
+
+    // bytes encode() writes for @value
+    inline std::size_t size(const Header&)
+    {
+        return 7;
+    }
+
+    // write @value to @out, which holds at least size(value) bytes. Vector
+    // sizes are taken from the vectors. @return one past the last byte written,
+    // nullptr for a vector too long for its size member, or vectors sharing
+    // one that differ in size
+    inline char* encode(const Header& value, char* out)
+    {
+        ::swizzle::runtime::store<std::uint16_t, ::swizzle::runtime::ByteOrder::Big>(out + 0, value.length);
+        ::swizzle::runtime::store<std::uint8_t, ::swizzle::runtime::ByteOrder::Big>(out + 2, value.type);
+        ::swizzle::runtime::store<std::uint32_t, ::swizzle::runtime::ByteOrder::Big>(out + 3, value.sequence);
+        out += 7;
+        return out;
+    }
+
+    class HeaderView
+    {
+    public:
+        static constexpr std::size_t FixedPrefix = 7;     // bytes at constant offsets
+        static constexpr std::size_t MinSize = 7;
+        static constexpr std::size_t Size = 7;
+
+        HeaderView(const char* data, const std::size_t length)
+            : data_(data)
+            , length_(length)
+        {
+        }
+
+        // element codec of a FixedRange
+        static HeaderView read(const char* data) { return HeaderView(data, Size); }
+
+        // @length holds the whole message and every variable_block case is known,
+        // the accessors assume both
+        bool isValid() const
+        {
+            return length_ >= Size;
+        }
+
+        // bytes the message takes on the wire
+        std::size_t wireSize() const
+        {
+            return Size;
+        }
+
+        std::uint16_t length() const
+        {
+            return ::swizzle::runtime::load<std::uint16_t, ::swizzle::runtime::ByteOrder::Big>(data_ + 0);
+        }
+
+        std::uint8_t type() const
+        {
+            return ::swizzle::runtime::load<std::uint8_t, ::swizzle::runtime::ByteOrder::Big>(data_ + 2);
+        }
+
+        std::uint32_t sequence() const
+        {
+            return ::swizzle::runtime::load<std::uint32_t, ::swizzle::runtime::ByteOrder::Big>(data_ + 3);
+        }
+
+    private:
+        const char* data_;
+        std::size_t length_;
+    };
+
+    // compile time description of Header, swizzle::runtime::Metadata<Header>
+    struct HeaderMetadata
+    {
+        using Type = Header;
+
+        static constexpr ::swizzle::runtime::Name name() { return "fixture::Header"; }
+
+        static constexpr std::size_t MinSize = 7;
+        static constexpr std::size_t MaxSize = 7;
+        static constexpr std::size_t FixedPrefix = 7;
+        static constexpr std::size_t FieldCount = 3;
+        static constexpr std::size_t VariableBlockCount = 0;
+        static constexpr std::size_t AttributeCount = 1;     // the struct's own, its fields' follow
+
+        static constexpr ::swizzle::runtime::FieldInfo field(const std::size_t i)
+        {
+            const ::swizzle::runtime::FieldInfo table[] = {
+                { "length", "u16", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Big, true, 0, 2, 2, 0, 0, ::swizzle::runtime::NoField, "", false, 0, false, 1, 0 },
+                { "type", "u8", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Big, true, 2, 1, 1, 0, 0, ::swizzle::runtime::NoField, "", false, 0, false, 1, 0 },
+                { "sequence", "u32", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Big, true, 3, 4, 4, 0, 0, ::swizzle::runtime::NoField, "", false, 0, false, 1, 0 },
+            };
+
+            return table[i];
+        }
+
+        static constexpr ::swizzle::runtime::VariableBlockInfo variableBlock(const std::size_t) { return {}; }
+
+        static constexpr ::swizzle::runtime::CaseInfo variableBlockCase(const std::size_t) { return {}; }
+
+        static constexpr ::swizzle::runtime::AttributeInfo attribute(const std::size_t i)
+        {
+            const ::swizzle::runtime::AttributeInfo table[] = {
+                { "@big_endian", "" },
+            };
+
+            return table[i];
+        }
+
+        // pointers to the value type's members, in field order
+        static constexpr auto members() { return std::make_tuple(&Header::length, &Header::type, &Header::sequence); }
+    };
+
+    HeaderMetadata metadata(const Header&);
+
+    struct Level
+    {
+        std::int64_t price {};
+        std::uint32_t quantity {};
+    };
+
+    // decode the Level at @data into @out, its vectors into @arena if not null.
+    // @return one past its end, nullptr if it runs past @end or selects an unknown
+    // variable_block case
+    inline const char* decode(const char* data, const char* end, Level& out, ::swizzle::runtime::Arena* arena)
+    {
+        static_cast<void>(arena);
+        if(end - data < 12) return nullptr;
+        out.price = ::swizzle::runtime::load<std::int64_t, ::swizzle::runtime::ByteOrder::Little>(data + 0);
+        out.quantity = ::swizzle::runtime::load<std::uint32_t, ::swizzle::runtime::ByteOrder::Little>(data + 8);
+        data += 12;
+        return data;
+    }
+
+    inline const char* decode(const char* data, const char* end, Level& out)
+    {
+        return decode(data, end, out, nullptr);
+    }
+
+    // bytes encode() writes for @value
+    inline std::size_t size(const Level&)
+    {
+        return 12;
+    }
+
+    // write @value to @out, which holds at least size(value) bytes. Vector
+    // sizes are taken from the vectors. @return one past the last byte written,
+    // nullptr for a vector too long for its size member, or vectors sharing
+    // one that differ in size
+    inline char* encode(const Level& value, char* out)
+    {
+        ::swizzle::runtime::store<std::int64_t, ::swizzle::runtime::ByteOrder::Little>(out + 0, value.price);
+        ::swizzle::runtime::store<std::uint32_t, ::swizzle::runtime::ByteOrder::Little>(out + 8, value.quantity);
+        out += 12;
+        return out;
+    }
+
+    class LevelView
+    {
+    public:
+        static constexpr std::size_t FixedPrefix = 12;     // bytes at constant offsets
+        static constexpr std::size_t MinSize = 12;
+        static constexpr std::size_t Size = 12;
+
+        LevelView(const char* data, const std::size_t length)
+            : data_(data)
+            , length_(length)
+        {
+        }
+
+        // element codec of a FixedRange
+        static LevelView read(const char* data) { return LevelView(data, Size); }
+
+        // @length holds the whole message and every variable_block case is known,
+        // the accessors assume both
+        bool isValid() const
+        {
+            return length_ >= Size;
+        }
+
+        // bytes the message takes on the wire
+        std::size_t wireSize() const
+        {
+            return Size;
+        }
+
+        std::int64_t price() const
+        {
+            return ::swizzle::runtime::load<std::int64_t, ::swizzle::runtime::ByteOrder::Little>(data_ + 0);
+        }
+
+        std::uint32_t quantity() const
+        {
+            return ::swizzle::runtime::load<std::uint32_t, ::swizzle::runtime::ByteOrder::Little>(data_ + 8);
+        }
+
+    private:
+        const char* data_;
+        std::size_t length_;
+    };
+
+    // compile time description of Level, swizzle::runtime::Metadata<Level>
+    struct LevelMetadata
+    {
+        using Type = Level;
+
+        static constexpr ::swizzle::runtime::Name name() { return "fixture::Level"; }
+
+        static constexpr std::size_t MinSize = 12;
+        static constexpr std::size_t MaxSize = 12;
+        static constexpr std::size_t FixedPrefix = 12;
+        static constexpr std::size_t FieldCount = 2;
+        static constexpr std::size_t VariableBlockCount = 0;
+        static constexpr std::size_t AttributeCount = 0;     // the struct's own, its fields' follow
+
+        static constexpr ::swizzle::runtime::FieldInfo field(const std::size_t i)
+        {
+            const ::swizzle::runtime::FieldInfo table[] = {
+                { "price", "i64", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Little, true, 0, 8, 8, 0, 0, ::swizzle::runtime::NoField, "", false, 0, false, 0, 0 },
+                { "quantity", "u32", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Little, true, 8, 4, 4, 0, 0, ::swizzle::runtime::NoField, "", false, 0, false, 0, 0 },
+            };
+
+            return table[i];
+        }
+
+        static constexpr ::swizzle::runtime::VariableBlockInfo variableBlock(const std::size_t) { return {}; }
+
+        static constexpr ::swizzle::runtime::CaseInfo variableBlockCase(const std::size_t) { return {}; }
+
+        static constexpr ::swizzle::runtime::AttributeInfo attribute(const std::size_t) { return {}; }
+
+        // pointers to the value type's members, in field order
+        static constexpr auto members() { return std::make_tuple(&Level::price, &Level::quantity); }
+    };
+
+    LevelMetadata metadata(const Level&);
+
+    struct Order
+    {
+        std::uint64_t id {};
+        ::fixture::Side side {};
+        ::fixture::OrderFlags flags {};
+        std::array<std::uint8_t, 4> symbol {};
+        std::int64_t price {};
+    };
+
+    // decode the Order at @data into @out, its vectors into @arena if not null.
+    // @return one past its end, nullptr if it runs past @end or selects an unknown
+    // variable_block case
+    inline const char* decode(const char* data, const char* end, Order& out, ::swizzle::runtime::Arena* arena)
+    {
+        static_cast<void>(arena);
+        if(end - data < 23) return nullptr;
+        out.id = ::swizzle::runtime::load<std::uint64_t, ::swizzle::runtime::ByteOrder::Big>(data + 0);
+        out.side = ::swizzle::runtime::load<::fixture::Side, ::swizzle::runtime::ByteOrder::Big>(data + 8);
+        out.flags = ::swizzle::runtime::load<::fixture::OrderFlags, ::swizzle::runtime::ByteOrder::Big>(data + 9);
+        for(std::size_t i = 0; i < 4; ++i)
+            out.symbol[i] = ::swizzle::runtime::load<std::uint8_t, ::swizzle::runtime::ByteOrder::Big>(data + 11 + i * 1);
+        out.price = ::swizzle::runtime::load<std::int64_t, ::swizzle::runtime::ByteOrder::Big>(data + 15);
+        data += 23;
+        return data;
+    }
+
+    inline const char* decode(const char* data, const char* end, Order& out)
+    {
+        return decode(data, end, out, nullptr);
+    }
+
+    // bytes encode() writes for @value
+    inline std::size_t size(const Order&)
+    {
+        return 23;
+    }
+
+    // write @value to @out, which holds at least size(value) bytes. Vector
+    // sizes are taken from the vectors. @return one past the last byte written,
+    // nullptr for a vector too long for its size member, or vectors sharing
+    // one that differ in size
+    inline char* encode(const Order& value, char* out)
+    {
+        ::swizzle::runtime::store<std::uint64_t, ::swizzle::runtime::ByteOrder::Big>(out + 0, value.id);
+        ::swizzle::runtime::store<::fixture::Side, ::swizzle::runtime::ByteOrder::Big>(out + 8, value.side);
+        ::swizzle::runtime::store<::fixture::OrderFlags, ::swizzle::runtime::ByteOrder::Big>(out + 9, value.flags);
+        std::memcpy(out + 11, value.symbol.data(), 4);
+        ::swizzle::runtime::store<std::int64_t, ::swizzle::runtime::ByteOrder::Big>(out + 15, value.price);
+        out += 23;
+        return out;
+    }
+
+    class OrderView
+    {
+    public:
+        static constexpr std::size_t FixedPrefix = 23;     // bytes at constant offsets
+        static constexpr std::size_t MinSize = 23;
+        static constexpr std::size_t Size = 23;
+
+        OrderView(const char* data, const std::size_t length)
+            : data_(data)
+            , length_(length)
+        {
+        }
+
+        // element codec of a FixedRange
+        static OrderView read(const char* data) { return OrderView(data, Size); }
+
+        // @length holds the whole message and every variable_block case is known,
+        // the accessors assume both
+        bool isValid() const
+        {
+            return length_ >= Size;
+        }
+
+        // bytes the message takes on the wire
+        std::size_t wireSize() const
+        {
+            return Size;
+        }
+
+        std::uint64_t id() const
+        {
+            return ::swizzle::runtime::load<std::uint64_t, ::swizzle::runtime::ByteOrder::Big>(data_ + 0);
+        }
+
+        ::fixture::Side side() const
+        {
+            return ::swizzle::runtime::load<::fixture::Side, ::swizzle::runtime::ByteOrder::Big>(data_ + 8);
+        }
+
+        ::fixture::OrderFlags flags() const
+        {
+            return ::swizzle::runtime::load<::fixture::OrderFlags, ::swizzle::runtime::ByteOrder::Big>(data_ + 9);
+        }
+
+        ::swizzle::runtime::FixedRange<::swizzle::runtime::Scalar<std::uint8_t, ::swizzle::runtime::ByteOrder::Big>> symbol() const
+        {
+            return ::swizzle::runtime::FixedRange<::swizzle::runtime::Scalar<std::uint8_t, ::swizzle::runtime::ByteOrder::Big>>(data_ + 11, 4);
+        }
+
+        std::int64_t price() const
+        {
+            return ::swizzle::runtime::load<std::int64_t, ::swizzle::runtime::ByteOrder::Big>(data_ + 15);
+        }
+
+    private:
+        const char* data_;
+        std::size_t length_;
+    };
+
+    // compile time description of Order, swizzle::runtime::Metadata<Order>
+    struct OrderMetadata
+    {
+        using Type = Order;
+
+        static constexpr ::swizzle::runtime::Name name() { return "fixture::Order"; }
+
+        static constexpr std::size_t MinSize = 23;
+        static constexpr std::size_t MaxSize = 23;
+        static constexpr std::size_t FixedPrefix = 23;
+        static constexpr std::size_t FieldCount = 5;
+        static constexpr std::size_t VariableBlockCount = 0;
+        static constexpr std::size_t AttributeCount = 1;     // the struct's own, its fields' follow
+
+        static constexpr ::swizzle::runtime::FieldInfo field(const std::size_t i)
+        {
+            const ::swizzle::runtime::FieldInfo table[] = {
+                { "id", "u64", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Big, true, 0, 8, 8, 0, 0, ::swizzle::runtime::NoField, "", false, 0, false, 1, 0 },
+                { "side", "fixture::Side", ::swizzle::runtime::TypeKind::Enum, ::swizzle::runtime::ByteOrder::Big, true, 8, 1, 1, 0, 0, ::swizzle::runtime::NoField, "", false, 0, false, 1, 0 },
+                { "flags", "fixture::OrderFlags", ::swizzle::runtime::TypeKind::Bitfield, ::swizzle::runtime::ByteOrder::Big, true, 9, 2, 2, 0, 0, ::swizzle::runtime::NoField, "", false, 0, false, 1, 0 },
+                { "symbol", "u8", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Big, true, 11, 4, 4, 1, 4, ::swizzle::runtime::NoField, "", false, 0, false, 1, 0 },
+                { "price", "i64", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Big, true, 15, 8, 8, 0, 0, ::swizzle::runtime::NoField, "", false, 0, false, 1, 0 },
+            };
+
+            return table[i];
+        }
+
+        static constexpr ::swizzle::runtime::VariableBlockInfo variableBlock(const std::size_t) { return {}; }
+
+        static constexpr ::swizzle::runtime::CaseInfo variableBlockCase(const std::size_t) { return {}; }
+
+        static constexpr ::swizzle::runtime::AttributeInfo attribute(const std::size_t i)
+        {
+            const ::swizzle::runtime::AttributeInfo table[] = {
+                { "@big_endian", "" },
+            };
+
+            return table[i];
+        }
+
+        // pointers to the value type's members, in field order
+        static constexpr auto members() { return std::make_tuple(&Order::id, &Order::side, &Order::flags, &Order::symbol, &Order::price); }
+    };
+
+    OrderMetadata metadata(const Order&);
+
+    struct Snapshot
+    {
+        std::array<std::uint8_t, 4> symbol {};
+        std::uint8_t count {};
+        ::swizzle::runtime::ArenaVector<::fixture::Level> levels;
+        ::swizzle::runtime::ArenaVector<std::uint16_t> sizes;
+    };
+
+    // decode the Snapshot at @data into @out, its vectors into @arena if not null.
+    // @return one past its end, nullptr if it runs past @end or selects an unknown
+    // variable_block case
+    inline const char* decode(const char* data, const char* end, Snapshot& out, ::swizzle::runtime::Arena* arena)
+    {
+        if(end - data < 5) return nullptr;
+        for(std::size_t i = 0; i < 4; ++i)
+            out.symbol[i] = ::swizzle::runtime::load<std::uint8_t, ::swizzle::runtime::ByteOrder::Little>(data + 0 + i * 1);
+        out.count = ::swizzle::runtime::load<std::uint8_t, ::swizzle::runtime::ByteOrder::Little>(data + 4);
+        data += 5;
+        {
+            const auto count = static_cast<std::size_t>(out.count);
+            if(static_cast<std::size_t>(end - data) / 12 < count) return nullptr;
+            ::swizzle::runtime::resize(out.levels, count, arena);
+            for(auto& element : out.levels)
+            {
+                data = decode(data, end, element, arena);
+                if(!data) return nullptr;
+            }
+        }
+        {
+            const auto count = static_cast<std::size_t>(out.count);
+            if(static_cast<std::size_t>(end - data) / 2 < count) return nullptr;
+            ::swizzle::runtime::resize(out.sizes, count, arena);
+            ::swizzle::runtime::loadRun<std::uint16_t, ::swizzle::runtime::ByteOrder::Little>(data, count, out.sizes.data());
+            data += count * 2;
+        }
+        return data;
+    }
+
+    inline const char* decode(const char* data, const char* end, Snapshot& out)
+    {
+        return decode(data, end, out, nullptr);
+    }
+
+    // bytes encode() writes for @value
+    inline std::size_t size(const Snapshot& value)
+    {
+        std::size_t size_ = 5;
+        size_ += value.levels.size() * 12;
+        size_ += value.sizes.size() * 2;
+        return size_;
+    }
+
+    // write @value to @out, which holds at least size(value) bytes. Vector
+    // sizes are taken from the vectors. @return one past the last byte written,
+    // nullptr for a vector too long for its size member, or vectors sharing
+    // one that differ in size
+    inline char* encode(const Snapshot& value, char* out)
+    {
+        if(!::swizzle::runtime::fits<std::uint8_t>(value.levels.size())) return nullptr;
+        if(value.sizes.size() != value.levels.size()) return nullptr;
+        std::memcpy(out + 0, value.symbol.data(), 4);
+        ::swizzle::runtime::store<std::uint8_t, ::swizzle::runtime::ByteOrder::Little>(out + 4, static_cast<std::uint8_t>(value.levels.size()));
+        out += 5;
+        for(const auto& element : value.levels)
+            out = encode(element, out);
+        ::swizzle::runtime::storeRun<std::uint16_t, ::swizzle::runtime::ByteOrder::Little>(out, value.sizes.data(), value.sizes.size());
+        out += value.sizes.size() * 2;
+        return out;
+    }
+
+    class SnapshotView
+    {
+    public:
+        static constexpr std::size_t FixedPrefix = 5;     // bytes at constant offsets
+        static constexpr std::size_t MinSize = 5;
+
+        SnapshotView(const char* data, const std::size_t length)
+            : data_(data)
+            , length_(length)
+        {
+        }
+
+        // @length holds the whole message and every variable_block case is known,
+        // the accessors assume both
+        bool isValid() const
+        {
+            std::size_t offset_ = 0;
+            offset_ += 5;
+            if(length_ < offset_) return false;
+            offset_ += static_cast<std::size_t>(count()) * 12;
+            if(length_ < offset_) return false;
+            offset_ += static_cast<std::size_t>(count()) * 2;
+            return length_ >= offset_;
+        }
+
+        // bytes the message takes on the wire
+        std::size_t wireSize() const
+        {
+            return offset_sizes() + size_sizes();
+        }
+
+        ::swizzle::runtime::FixedRange<::swizzle::runtime::Scalar<std::uint8_t, ::swizzle::runtime::ByteOrder::Little>> symbol() const
+        {
+            return ::swizzle::runtime::FixedRange<::swizzle::runtime::Scalar<std::uint8_t, ::swizzle::runtime::ByteOrder::Little>>(data_ + 0, 4);
+        }
+
+        std::uint8_t count() const
+        {
+            return ::swizzle::runtime::load<std::uint8_t, ::swizzle::runtime::ByteOrder::Little>(data_ + 4);
+        }
+
+        ::swizzle::runtime::FixedRange<::fixture::LevelView> levels() const
+        {
+            return ::swizzle::runtime::FixedRange<::fixture::LevelView>(data_ + 5, static_cast<std::size_t>(count()));
+        }
+
+        ::swizzle::runtime::FixedRange<::swizzle::runtime::Scalar<std::uint16_t, ::swizzle::runtime::ByteOrder::Little>> sizes() const
+        {
+            const auto offset_ = offset_sizes();
+            return ::swizzle::runtime::FixedRange<::swizzle::runtime::Scalar<std::uint16_t, ::swizzle::runtime::ByteOrder::Little>>(data_ + offset_, static_cast<std::size_t>(count()));
+        }
+
+    private:
+        std::size_t size_levels() const
+        {
+            return levels().wireSize();
+        }
+
+        std::size_t offset_sizes() const
+        {
+            return 5 + size_levels();
+        }
+
+        std::size_t size_sizes() const
+        {
+            return sizes().wireSize();
+        }
+
+        const char* data_;
+        std::size_t length_;
+    };
+
+    // compile time description of Snapshot, swizzle::runtime::Metadata<Snapshot>
+    struct SnapshotMetadata
+    {
+        using Type = Snapshot;
+
+        static constexpr ::swizzle::runtime::Name name() { return "fixture::Snapshot"; }
+
+        static constexpr std::size_t MinSize = 5;
+        static constexpr std::size_t MaxSize = 3575;
+        static constexpr std::size_t FixedPrefix = 5;
+        static constexpr std::size_t FieldCount = 4;
+        static constexpr std::size_t VariableBlockCount = 0;
+        static constexpr std::size_t AttributeCount = 0;     // the struct's own, its fields' follow
+
+        static constexpr ::swizzle::runtime::FieldInfo field(const std::size_t i)
+        {
+            const ::swizzle::runtime::FieldInfo table[] = {
+                { "symbol", "u8", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Little, true, 0, 4, 4, 1, 4, ::swizzle::runtime::NoField, "", false, 0, false, 0, 0 },
+                { "count", "u8", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Little, true, 4, 1, 1, 0, 0, ::swizzle::runtime::NoField, "", false, 0, false, 0, 0 },
+                { "levels", "fixture::Level", ::swizzle::runtime::TypeKind::Struct, ::swizzle::runtime::ByteOrder::Little, true, 5, 0, 3060, 12, 0, 1, "count", false, 0, false, 0, 0 },
+                { "sizes", "u16", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Little, false, 0, 0, 510, 2, 0, 1, "count", false, 0, false, 0, 0 },
+            };
+
+            return table[i];
+        }
+
+        static constexpr ::swizzle::runtime::VariableBlockInfo variableBlock(const std::size_t) { return {}; }
+
+        static constexpr ::swizzle::runtime::CaseInfo variableBlockCase(const std::size_t) { return {}; }
+
+        static constexpr ::swizzle::runtime::AttributeInfo attribute(const std::size_t) { return {}; }
+
+        // pointers to the value type's members, in field order
+        static constexpr auto members() { return std::make_tuple(&Snapshot::symbol, &Snapshot::count, &Snapshot::levels, &Snapshot::sizes); }
+    };
+
+    SnapshotMetadata metadata(const Snapshot&);
+
+    struct Message
+    {
+        ::fixture::Header header {};
+        std::uint16_t tagCount {};
+        ::swizzle::runtime::ArenaVector<std::uint32_t> tags;
+        ::fixture::Order orderCase;
+        ::fixture::Snapshot snapshotCase;
+    };
+
+    // decode the Message at @data into @out, its vectors into @arena if not null.
+    // The variable_block cases it does not select that hold vectors are emptied.
+    // @return one past its end, nullptr if it runs past @end or selects an unknown
+    // variable_block case
+    inline const char* decode(const char* data, const char* end, Message& out, ::swizzle::runtime::Arena* arena)
+    {
+        if(end - data < 9) return nullptr;
+        decode(data + 0, end, out.header);
+        out.tagCount = ::swizzle::runtime::load<std::uint16_t, ::swizzle::runtime::ByteOrder::Little>(data + 7);
+        data += 9;
+        {
+            const auto count = static_cast<std::size_t>(out.tagCount);
+            if(static_cast<std::size_t>(end - data) / 4 < count) return nullptr;
+            ::swizzle::runtime::resize(out.tags, count, arena);
+            ::swizzle::runtime::loadRun<std::uint32_t, ::swizzle::runtime::ByteOrder::Little>(data, count, out.tags.data());
+            data += count * 4;
+        }
+        switch(out.header.type)
+        {
+            case 'O':
+                out.snapshotCase = ::fixture::Snapshot();
+                data = decode(data, end, out.orderCase, arena);
+                break;
+            case 'S': data = decode(data, end, out.snapshotCase, arena); break;
+            default: return nullptr;
+        }
+        if(!data) return nullptr;
+        return data;
+    }
+
+    inline const char* decode(const char* data, const char* end, Message& out)
+    {
+        return decode(data, end, out, nullptr);
+    }
+
+    // bytes encode() writes for @value
+    inline std::size_t size(const Message& value)
+    {
+        std::size_t size_ = 9;
+        size_ += value.tags.size() * 4;
+        switch(value.header.type)
+        {
+            case 'O': size_ += size(value.orderCase); break;
+            case 'S': size_ += size(value.snapshotCase); break;
+            default: break;
+        }
+        return size_;
+    }
+
+    // write @value to @out, which holds at least size(value) bytes. Vector
+    // sizes are taken from the vectors. @return one past the last byte written,
+    // nullptr for a vector too long for its size member, or vectors sharing
+    // one that differ in size, or a discriminator that selects no case, out
+    // may then hold a partly written message
+    inline char* encode(const Message& value, char* out)
+    {
+        if(!::swizzle::runtime::fits<std::uint16_t>(value.tags.size())) return nullptr;
+        encode(value.header, out + 0);
+        ::swizzle::runtime::store<std::uint16_t, ::swizzle::runtime::ByteOrder::Little>(out + 7, static_cast<std::uint16_t>(value.tags.size()));
+        out += 9;
+        ::swizzle::runtime::storeRun<std::uint32_t, ::swizzle::runtime::ByteOrder::Little>(out, value.tags.data(), value.tags.size());
+        out += value.tags.size() * 4;
+        switch(value.header.type)
+        {
+            case 'O': out = encode(value.orderCase, out); break;
+            case 'S': out = encode(value.snapshotCase, out); break;
+            default: return nullptr;
+        }
+        if(!out) return nullptr;
+        return out;
+    }
+
+    class MessageView
+    {
+    public:
+        static constexpr std::size_t FixedPrefix = 9;     // bytes at constant offsets
+        static constexpr std::size_t MinSize = 14;
+
+        MessageView(const char* data, const std::size_t length)
+            : data_(data)
+            , length_(length)
+        {
+        }
+
+        // @length holds the whole message and every variable_block case is known,
+        // the accessors assume both
+        bool isValid() const
+        {
+            std::size_t offset_ = 0;
+            offset_ += 9;
+            if(length_ < offset_) return false;
+            offset_ += static_cast<std::size_t>(tagCount()) * 4;
+            if(length_ < offset_) return false;
+            switch(header().type())
+            {
+            case 'O':
+            {
+                ::fixture::OrderView view_(data_ + offset_, length_ - offset_);
+                if(!view_.isValid()) return false;
+                offset_ += view_.wireSize();
+                break;
+            }
+            case 'S':
+            {
+                ::fixture::SnapshotView view_(data_ + offset_, length_ - offset_);
+                if(!view_.isValid()) return false;
+                offset_ += view_.wireSize();
+                break;
+            }
+            default:
+                return false;
+            }
+            return length_ >= offset_;
+        }
+
+        // bytes the message takes on the wire
+        std::size_t wireSize() const
+        {
+            return offset_variableBlock() + size_variableBlock();
+        }
+
+        ::fixture::HeaderView header() const
+        {
+            return ::fixture::HeaderView(data_ + 0, length_ - 0);
+        }
+
+        std::uint16_t tagCount() const
+        {
+            return ::swizzle::runtime::load<std::uint16_t, ::swizzle::runtime::ByteOrder::Little>(data_ + 7);
+        }
+
+        ::swizzle::runtime::FixedRange<::swizzle::runtime::Scalar<std::uint32_t, ::swizzle::runtime::ByteOrder::Little>> tags() const
+        {
+            return ::swizzle::runtime::FixedRange<::swizzle::runtime::Scalar<std::uint32_t, ::swizzle::runtime::ByteOrder::Little>>(data_ + 9, static_cast<std::size_t>(tagCount()));
+        }
+
+        bool isOrder() const
+        {
+            const auto value_ = header().type();
+            return (value_ == 'O');
+        }
+
+        ::fixture::OrderView asOrder() const
+        {
+            const auto offset_ = offset_variableBlock();
+            return ::fixture::OrderView(data_ + offset_, length_ - offset_);
+        }
+
+        bool isSnapshot() const
+        {
+            const auto value_ = header().type();
+            return (value_ == 'S');
+        }
+
+        ::fixture::SnapshotView asSnapshot() const
+        {
+            const auto offset_ = offset_variableBlock();
+            return ::fixture::SnapshotView(data_ + offset_, length_ - offset_);
+        }
+
+    private:
+        std::size_t size_tags() const
+        {
+            return tags().wireSize();
+        }
+
+        std::size_t offset_variableBlock() const
+        {
+            return 9 + size_tags();
+        }
+
+        std::size_t size_variableBlock() const
+        {
+            const auto offset_ = offset_variableBlock();
+            switch(header().type())
+            {
+            case 'O': return ::fixture::OrderView(data_ + offset_, length_ - offset_).wireSize();
+            case 'S': return ::fixture::SnapshotView(data_ + offset_, length_ - offset_).wireSize();
+            default: return 0;
+            }
+        }
+
+        const char* data_;
+        std::size_t length_;
+    };
+
+    // Message decoded a column at a time by decodeColumns(), message i's fields at
+    // [i]. Vector elements go back to back, message i's from foo_begin[i] on, and
+    // variable_block cases into a column per case type, at variableBlock_index[i]
+    // The vectors of structs decoded whole are in arena_, until clear()
+    struct MessageColumns
+    {
+        std::size_t count_ = 0;
+        std::vector<std::uint16_t> header_length;
+        std::vector<std::uint8_t> header_type;
+        std::vector<std::uint32_t> header_sequence;
+        std::vector<std::uint16_t> tagCount;
+        std::vector<std::uint32_t> tags;
+        std::vector<std::size_t> tags_begin;
+        std::vector<::fixture::Order> orderCase;
+        std::vector<::fixture::Snapshot> snapshotCase;
+        std::vector<std::size_t> variableBlock_index;
+        ::swizzle::runtime::Arena arena_;
+    };
+
+    // empty every column of @out, keeping their memory for the next batch
+    inline void clear(MessageColumns& out)
+    {
+        out.count_ = 0;
+        out.header_length.clear();
+        out.header_type.clear();
+        out.header_sequence.clear();
+        out.tagCount.clear();
+        out.tags.clear();
+        out.tags_begin.clear();
+        out.orderCase.clear();
+        out.snapshotCase.clear();
+        out.variableBlock_index.clear();
+        out.arena_.reset();
+    }
+
+    // append the @count messages at @messages[i], @lengths[i] bytes each, to @out.
+    // @return the messages appended, up to the first that isn't valid
+    inline std::size_t decodeColumns(const char* const* messages, const std::size_t* lengths, const std::size_t count, MessageColumns& out)
+    {
+        const auto base_ = out.count_;
+        out.header_length.resize(base_ + count);
+        out.header_type.resize(base_ + count);
+        out.header_sequence.resize(base_ + count);
+        out.tagCount.resize(base_ + count);
+        out.tags_begin.resize(base_ + count);
+        out.variableBlock_index.resize(base_ + count);
+        out.orderCase.reserve(out.orderCase.size() + count);
+        out.snapshotCase.reserve(out.snapshotCase.size() + count);
+
+        std::size_t valid_ = 0;
+        while(valid_ < count)
+        {
+            const auto begin_ = valid_;
+            const auto last_ = std::min(count, begin_ + ::swizzle::runtime::ColumnBlock);
+            while((valid_ < last_) && MessageView(messages[valid_], lengths[valid_]).isValid()) ++valid_;
+
+            const auto rows_ = valid_ - begin_;
+            ::swizzle::runtime::gatherIndirect<std::uint16_t, ::swizzle::runtime::ByteOrder::Big>(messages + begin_, 0, rows_, out.header_length.data() + base_ + begin_);
+            ::swizzle::runtime::gatherIndirect<std::uint8_t, ::swizzle::runtime::ByteOrder::Big>(messages + begin_, 2, rows_, out.header_type.data() + base_ + begin_);
+            ::swizzle::runtime::gatherIndirect<std::uint32_t, ::swizzle::runtime::ByteOrder::Big>(messages + begin_, 3, rows_, out.header_sequence.data() + base_ + begin_);
+            ::swizzle::runtime::gatherIndirect<std::uint16_t, ::swizzle::runtime::ByteOrder::Little>(messages + begin_, 7, rows_, out.tagCount.data() + base_ + begin_);
+
+            for(std::size_t i_ = begin_; i_ < valid_; ++i_)
+            {
+                const auto row_ = base_ + i_;
+                const char* const data_ = messages[i_];
+                const char* const end_ = data_ + lengths[i_];
+                const char* at_ = data_ + 9;
+
+                {
+                    const auto count_ = static_cast<std::size_t>(out.tagCount[row_]);
+                    const auto first_ = out.tags.size();
+                    out.tags_begin[row_] = first_;
+                    out.tags.resize(first_ + count_);
+                    ::swizzle::runtime::loadRun<std::uint32_t, ::swizzle::runtime::ByteOrder::Little>(at_, count_, out.tags.data() + first_);
+                    at_ += count_ * 4;
+                }
+                switch(out.header_type[row_])
+                {
+                case 'O':
+                    out.variableBlock_index[row_] = out.orderCase.size();
+                    out.orderCase.emplace_back();
+                    at_ = decode(at_, end_, out.orderCase.back(), &out.arena_);
+                    break;
+                case 'S':
+                    out.variableBlock_index[row_] = out.snapshotCase.size();
+                    out.snapshotCase.emplace_back();
+                    at_ = decode(at_, end_, out.snapshotCase.back(), &out.arena_);
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            if(valid_ != last_)
+            {
+                break;
+            }
+        }
+
+        out.count_ = base_ + valid_;
+        out.header_length.resize(out.count_);
+        out.header_type.resize(out.count_);
+        out.header_sequence.resize(out.count_);
+        out.tagCount.resize(out.count_);
+        out.tags_begin.resize(out.count_);
+        out.variableBlock_index.resize(out.count_);
+
+        return valid_;
+    }
+
+    // compile time description of Message, swizzle::runtime::Metadata<Message>
+    struct MessageMetadata
+    {
+        using Type = Message;
+
+        static constexpr ::swizzle::runtime::Name name() { return "fixture::Message"; }
+
+        static constexpr std::size_t MinSize = 14;
+        static constexpr std::size_t MaxSize = 265724;
+        static constexpr std::size_t FixedPrefix = 9;
+        static constexpr std::size_t FieldCount = 3;
+        static constexpr std::size_t VariableBlockCount = 1;
+        static constexpr std::size_t AttributeCount = 1;     // the struct's own, its fields' follow
+
+        static constexpr ::swizzle::runtime::FieldInfo field(const std::size_t i)
+        {
+            const ::swizzle::runtime::FieldInfo table[] = {
+                { "header", "fixture::Header", ::swizzle::runtime::TypeKind::Struct, ::swizzle::runtime::ByteOrder::Little, true, 0, 7, 7, 0, 0, ::swizzle::runtime::NoField, "", false, 0, false, 1, 0 },
+                { "tagCount", "u16", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Little, true, 7, 2, 2, 0, 0, ::swizzle::runtime::NoField, "", false, 0, false, 1, 0 },
+                { "tags", "u32", ::swizzle::runtime::TypeKind::Builtin, ::swizzle::runtime::ByteOrder::Little, true, 9, 0, 262140, 4, 0, 1, "tagCount", false, 0, false, 1, 0 },
+            };
+
+            return table[i];
+        }
+
+        static constexpr ::swizzle::runtime::VariableBlockInfo variableBlock(const std::size_t i)
+        {
+            const ::swizzle::runtime::VariableBlockInfo table[] = {
+                { "header.type", 3, 0, 2 },
+            };
+
+            return table[i];
+        }
+
+        static constexpr ::swizzle::runtime::CaseInfo variableBlockCase(const std::size_t i)
+        {
+            const ::swizzle::runtime::CaseInfo table[] = {
+                { "'O'", "fixture::Order" },
+                { "'S'", "fixture::Snapshot" },
+            };
+
+            return table[i];
+        }
+
+        static constexpr ::swizzle::runtime::AttributeInfo attribute(const std::size_t i)
+        {
+            const ::swizzle::runtime::AttributeInfo table[] = {
+                { "@columns", "" },
+            };
+
+            return table[i];
+        }
+
+        // pointers to the value type's members, in field order
+        static constexpr auto members() { return std::make_tuple(&Message::header, &Message::tagCount, &Message::tags); }
+    };
+
+    MessageMetadata metadata(const Message&);
+
+}
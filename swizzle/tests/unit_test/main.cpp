@@ -1,7 +1,37 @@
-#include "./ut_support/MemoryLeakDetection.hpp"
-#include "./ut_support/UnitTestSupport.hpp"
-
-int main()
-{
-    return UnitTest::RunAllTests();
-}
+#include "./ut_support/MemoryLeakDetection.hpp"
+#include "./ut_support/UnitTestSupport.hpp"
+
+#include <swizzle/driver/AllocationCount.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// count allocations so tests can check for heap traffic with
+// driver::threadAllocations(), see driver/AllocationCount.hpp
+void* operator new(std::size_t size)
+{
+    swizzle::driver::countAllocation(size);
+
+    if(void* p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+int main()
+{
+    return UnitTest::RunAllTests();
+}
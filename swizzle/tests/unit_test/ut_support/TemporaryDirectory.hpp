@@ -0,0 +1,37 @@
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <string>
+
+// a fresh directory under the system temp directory, removed with everything
+// in it on destruction. Fixtures derive from it for root and write().
+struct TemporaryDirectory
+{
+    TemporaryDirectory()
+        : root(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("swizzle-%%%%-%%%%"))
+    {
+        boost::filesystem::create_directories(root);
+    }
+
+    ~TemporaryDirectory()
+    {
+        boost::system::error_code ec;
+        boost::filesystem::remove_all(root, ec);
+    }
+
+    TemporaryDirectory(const TemporaryDirectory&) = delete;
+    TemporaryDirectory& operator=(const TemporaryDirectory&) = delete;
+
+    // write @contents to @path under root, creating its directories
+    void write(const boost::filesystem::path& path, const std::string& contents) const
+    {
+        boost::filesystem::create_directories((root / path).parent_path());
+
+        boost::filesystem::ofstream os(root / path);
+        os << contents;
+    }
+
+    const boost::filesystem::path root;
+};
@@ -0,0 +1,13 @@
+#pragma once
+#include <boost/utility/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace swizzle { namespace types {
+
+    // wire size in bytes of the built in @type, 0 if it isn't one
+    std::size_t SizeOf(const boost::string_view& type);
+
+    // largest value of the built in integer @type, 0 if it isn't one
+    std::uint64_t MaxValueOf(const boost::string_view& type);
+}}
@@ -0,0 +1,306 @@
+#include <swizzle/ast/Matcher.hpp>
+#include <swizzle/ast/NodeKind.hpp>
+#include <swizzle/ast/nodes/Struct.hpp>
+#include <swizzle/ast/nodes/StructField.hpp>
+#include <swizzle/ast/nodes/VariableBlock.hpp>
+#include <swizzle/bench/Compare.hpp>
+#include <swizzle/bench/Results.hpp>
+#include <swizzle/bench/SchemaGenerator.hpp>
+#include <swizzle/bench/SchemaOptions.hpp>
+#include <swizzle/driver/BuildReport.hpp>
+#include <swizzle/driver/Command.hpp>
+#include <swizzle/driver/Driver.hpp>
+#include <swizzle/lexer/TokenInfo.hpp>
+#include <swizzle/lexer/Tokenizer.hpp>
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/utility/string_view.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct Arguments
+    {
+        swizzle::bench::SchemaOptions Schema;
+        std::size_t Iterations = 5;
+        std::size_t Threads = 1;                // driver threads, 1 keeps the parse numbers comparable
+        boost::filesystem::path Output;         // JSON results, empty for none
+        boost::filesystem::path SchemaDir;      // keep the generated schemas here, empty for a temporary directory
+
+        boost::filesystem::path Baseline;       // fail when throughput drops against these results
+        boost::filesystem::path Results;        // compare these results instead of running the benchmarks
+        double Threshold = 0.10;
+    };
+
+    void usage(const char* program)
+    {
+        std::cerr
+            << "usage: " << program << " [--iterations N] [--jobs N] [--output FILE] [--schema-dir DIR]"
+                " [--baseline FILE [--threshold FRACTION] [--results FILE]]\n"
+            << "       [--files N] [--structs N] [--fields N] [--enums N] [--enum-values N] [--bitfields N] [--bitfield-fields N]\n"
+            << "       [--variable-blocks N] [--namespace-depth N] [--attributes N] [--import-fan-out N] [--seed N]" << std::endl;
+    }
+
+    bool parseArguments(int argc, char* argv[], Arguments& arguments)
+    {
+        auto& schema = arguments.Schema;
+
+        for(int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if((i + 1) >= argc)
+            {
+                return false;
+            }
+
+            const std::string value = argv[++i];
+
+            if(arg == "--iterations") arguments.Iterations = std::stoul(value);
+            else if(arg == "--jobs" || arg == "-j") arguments.Threads = std::stoul(value);
+            else if(arg == "--output") arguments.Output = value;
+            else if(arg == "--schema-dir") arguments.SchemaDir = value;
+            else if(arg == "--baseline") arguments.Baseline = value;
+            else if(arg == "--results") arguments.Results = value;
+            else if(arg == "--threshold") arguments.Threshold = std::stod(value);
+            else if(arg == "--files") schema.Files = std::stoul(value);
+            else if(arg == "--structs") schema.Structs = std::stoul(value);
+            else if(arg == "--fields") schema.Fields = std::stoul(value);
+            else if(arg == "--enums") schema.Enums = std::stoul(value);
+            else if(arg == "--enum-values") schema.EnumValues = std::stoul(value);
+            else if(arg == "--bitfields") schema.Bitfields = std::stoul(value);
+            else if(arg == "--bitfield-fields") schema.BitfieldFields = std::stoul(value);
+            else if(arg == "--variable-blocks") schema.VariableBlocks = std::stoul(value);
+            else if(arg == "--namespace-depth") schema.NamespaceDepth = std::stoul(value);
+            else if(arg == "--attributes") schema.Attributes = std::stoul(value);
+            else if(arg == "--import-fan-out") schema.ImportFanOut = std::stoul(value);
+            else if(arg == "--seed") schema.Seed = std::stoull(value);
+            else return false;
+        }
+
+        return arguments.Iterations != 0 && arguments.Schema.Files != 0 && (arguments.Results.empty() || !arguments.Baseline.empty());
+    }
+
+    double seconds(std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration<double>(duration).count();
+    }
+
+    struct CountToken
+    {
+        CountToken(std::size_t& count)
+            : count_(count)
+        {
+        }
+
+        void operator()(const swizzle::lexer::TokenInfo&)
+        {
+            ++count_;
+        }
+
+    private:
+        std::size_t& count_;
+    };
+
+    // tokenize in memory, nothing but the lexer is timed
+    double lexerMegabytesPerSecond(const std::vector<std::string>& sources)
+    {
+        std::size_t bytes = 0;
+        std::size_t tokens = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for(const auto& source : sources)
+        {
+            swizzle::lexer::Tokenizer<CountToken> tokenizer("bench.swizzle", CountToken(tokens));
+
+            const boost::string_view sv(source);
+            for(std::size_t position = 0, end = sv.length(); position < end; ++position)
+            {
+                tokenizer.consume(sv, position);
+            }
+
+            tokenizer.flush();
+            bytes += source.size();
+        }
+
+        const auto elapsed = seconds(std::chrono::steady_clock::now() - start);
+        return elapsed > 0 ? (bytes / (1024.0 * 1024.0)) / elapsed : 0;
+    }
+
+    // every node of every module against a few typical backend queries
+    double matcherNodesPerSecond(const swizzle::driver::ModuleMap& modules)
+    {
+        using namespace swizzle::ast;
+
+        std::vector<Node::smartptr> nodes;
+        for(const auto& module : modules)
+        {
+            const auto& index = module.second->ast().index();
+            for(std::size_t kind = 0; kind < NodeKindCount; ++kind)
+            {
+                const auto& of = index.of(static_cast<NodeKind>(kind));
+                nodes.insert(nodes.end(), of.begin(), of.end());
+            }
+        }
+
+        auto messages = Matcher().isTypeOf<nodes::Struct>().hasChildOf<nodes::VariableBlock>();
+        auto named = Matcher().isTypeOf<nodes::Struct>().hasFieldNamed("field4");
+        auto fields = Matcher().isTypeOf<nodes::StructField>();
+
+        std::size_t matches = 0;
+        const auto start = std::chrono::steady_clock::now();
+
+        for(const auto& node : nodes)
+        {
+            matches += messages(node) + named(node) + fields(node);
+        }
+
+        const auto elapsed = seconds(std::chrono::steady_clock::now() - start);
+        return (elapsed > 0 && matches != 0) ? nodes.size() / elapsed : 0;
+    }
+
+    void run(const Arguments& arguments, const boost::filesystem::path& root, swizzle::bench::Results& results)
+    {
+        const swizzle::bench::SchemaGenerator generator(arguments.Schema);
+
+        swizzle::driver::Command command;
+        for(const auto& path : generator.write(root))
+        {
+            command.Files.push_back(root / path);
+        }
+
+        std::vector<std::string> sources;
+        for(std::size_t file = 0; file < generator.files(); ++file)
+        {
+            sources.push_back(generator.source(file));
+        }
+
+        swizzle::driver::DriverOptions options;
+        options.ImportRoot = root;
+        options.Threads = arguments.Threads;
+
+        // ASTs the matcher benchmark runs over
+        const auto modules = swizzle::driver::Driver(options).compile(command.Files);
+
+        for(std::size_t iteration = 0; iteration < arguments.Iterations; ++iteration)
+        {
+            results.add("lexer_mb_per_second", lexerMegabytesPerSecond(sources));
+            results.add("matcher_nodes_per_second", matcherNodesPerSecond(modules));
+
+            // a fresh driver every time, nothing is cached between iterations
+            swizzle::driver::Driver driver(options);
+            swizzle::driver::BuildReport report;
+
+            std::ostringstream errors;
+            if(!swizzle::driver::runCommand(driver, command, errors, &report))
+            {
+                throw std::runtime_error("generated schemas failed to compile: " + errors.str());
+            }
+
+            const auto parse = report.phase(swizzle::driver::Phase::Parse).WallSeconds;
+            results.add("parser_tokens_per_second", parse > 0 ? report.tokens() / parse : 0);
+            results.add("ast_bytes_per_node", report.nodes() ? static_cast<double>(report.nodeBytes()) / report.nodes() : 0);
+            results.add("files_per_second", report.elapsed() > 0 ? report.files() / report.elapsed() : 0);
+        }
+    }
+
+    void runBenchmarks(const Arguments& arguments, swizzle::bench::Results& results)
+    {
+        const bool temporary = arguments.SchemaDir.empty();
+        const auto root = boost::filesystem::absolute(temporary
+            ? boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("swizzle-bench-%%%%-%%%%")
+            : arguments.SchemaDir);
+
+        try
+        {
+            run(arguments, root, results);
+        }
+        catch(...)
+        {
+            if(temporary)
+            {
+                boost::filesystem::remove_all(root);
+            }
+
+            throw;
+        }
+
+        if(temporary)
+        {
+            boost::filesystem::remove_all(root);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Arguments arguments;
+
+    try
+    {
+        if(!parseArguments(argc, argv, arguments))
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        swizzle::bench::Results results(swizzle::bench::buildDescription(), arguments.Schema);
+
+        if(!arguments.Results.empty())
+        {
+            boost::filesystem::ifstream is(arguments.Results);
+            results = swizzle::bench::readResults(is);
+        }
+        else
+        {
+            runBenchmarks(arguments, results);
+        }
+
+        results.print(std::cout);
+
+        if(!arguments.Output.empty())
+        {
+            boost::filesystem::ofstream json(arguments.Output);
+            results.printJson(json);
+
+            if(!json)
+            {
+                throw std::runtime_error("unable to write " + arguments.Output.string());
+            }
+        }
+
+        if(!arguments.Baseline.empty())
+        {
+            boost::filesystem::ifstream is(arguments.Baseline);
+            if(!is)
+            {
+                throw std::runtime_error("unable to read " + arguments.Baseline.string());
+            }
+
+            const auto comparisons = swizzle::bench::compare(swizzle::bench::readResults(is), results, arguments.Threshold);
+
+            std::cout << "Compared with " << arguments.Baseline.string() << ", threshold " << (arguments.Threshold * 100) << "%\n";
+            swizzle::bench::print(std::cout, comparisons);
+
+            if(comparisons.empty() || swizzle::bench::regressed(comparisons))
+            {
+                return EXIT_FAILURE;
+            }
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
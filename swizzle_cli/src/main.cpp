@@ -0,0 +1,262 @@
+#include <swizzle/driver/AllocationCount.hpp>
+#include <swizzle/driver/BuildReport.hpp>
+#include <swizzle/driver/Command.hpp>
+#include <swizzle/driver/CompileServer.hpp>
+#include <swizzle/driver/Driver.hpp>
+#include <swizzle/driver/Watch.hpp>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+// count allocations for --mem-report, see driver/AllocationCount.hpp
+void* operator new(std::size_t size)
+{
+    swizzle::driver::countAllocation(size);
+
+    if(void* p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace {
+
+    struct Arguments
+    {
+        swizzle::driver::DriverOptions Options;
+        swizzle::driver::Command Command;
+
+        boost::filesystem::path Server;         // run as a compile server on this socket
+        boost::filesystem::path Connect;        // send the command to the compile server on this socket
+        boost::filesystem::path StopServer;
+        boost::filesystem::path Watch;          // recompile when schemas below this directory change
+        std::size_t CacheSize = 4096;           // modules the server (or watch mode) keeps parsed
+
+        swizzle::driver::BuildReport::Sections Report { false, false, false };
+        bool ReportJson = false;
+    };
+
+    void usage(const char* program)
+    {
+        std::cerr
+            << "usage: " << program << " [--jobs N] [--import-root DIR] [--dependency-database FILE]"
+                " [--output-cache DIR [--output-cache-size MB]] [--emit-ast DIR] [--emit-cpp DIR] [--depfile FILE] [--time-report] [--mem-report] [--state-report] [--report-json] file.swizzle...\n"
+            << "       " << program << " --server SOCKET [--cache-size N] [--jobs N] [--import-root DIR] [--dependency-database FILE] [--output-cache DIR [--output-cache-size MB]]\n"
+            << "       " << program << " --connect SOCKET [--emit-ast DIR] [--emit-cpp DIR] [--depfile FILE] file.swizzle...\n"
+            << "       " << program << " --stop-server SOCKET\n"
+            << "       " << program << " --watch DIR [--cache-size N] [--jobs N] [--import-root DIR] [--emit-ast DIR] [--emit-cpp DIR] [--depfile FILE] [file.swizzle...]" << std::endl;
+    }
+
+    bool parseArguments(int argc, char* argv[], Arguments& arguments)
+    {
+        for(int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const bool hasValue = (i + 1) < argc;
+
+            if((arg == "--jobs" || arg == "-j") && hasValue)
+            {
+                arguments.Options.Threads = std::stoul(argv[++i]);
+            }
+            else if(arg == "--import-root" && hasValue)
+            {
+                arguments.Options.ImportRoot = argv[++i];
+            }
+            else if(arg == "--dependency-database" && hasValue)
+            {
+                arguments.Options.DependencyDatabase = argv[++i];
+            }
+            else if(arg == "--output-cache" && hasValue)
+            {
+                arguments.Options.OutputCache = argv[++i];
+            }
+            else if(arg == "--output-cache-size" && hasValue)
+            {
+                arguments.Options.OutputCacheSize = std::stoull(argv[++i]) * 1024 * 1024;
+            }
+            else if(arg == "--cache-size" && hasValue)
+            {
+                arguments.CacheSize = std::stoul(argv[++i]);
+            }
+            else if(arg == "--emit-ast" && hasValue)
+            {
+                arguments.Command.EmitAst = argv[++i];
+            }
+            else if(arg == "--emit-cpp" && hasValue)
+            {
+                arguments.Command.EmitCpp = argv[++i];
+            }
+            else if(arg == "--depfile" && hasValue)
+            {
+                arguments.Command.Depfile = argv[++i];
+            }
+            else if(arg == "--server" && hasValue)
+            {
+                arguments.Server = argv[++i];
+            }
+            else if(arg == "--connect" && hasValue)
+            {
+                arguments.Connect = argv[++i];
+            }
+            else if(arg == "--stop-server" && hasValue)
+            {
+                arguments.StopServer = argv[++i];
+            }
+            else if(arg == "--watch" && hasValue)
+            {
+                arguments.Watch = argv[++i];
+            }
+            else if(arg == "--time-report")
+            {
+                arguments.Report.Time = true;
+            }
+            else if(arg == "--mem-report")
+            {
+                arguments.Report.Memory = true;
+            }
+            else if(arg == "--state-report")
+            {
+                arguments.Report.States = true;
+            }
+            else if(arg == "--report-json")
+            {
+                arguments.ReportJson = true;
+            }
+            else if(!arg.empty() && arg[0] == '-')
+            {
+                return false;
+            }
+            else
+            {
+                arguments.Command.Files.emplace_back(arg);
+            }
+        }
+
+        return !arguments.Server.empty() || !arguments.StopServer.empty() || !arguments.Watch.empty() || !arguments.Command.Files.empty();
+    }
+
+    // the server does not share our working directory
+    swizzle::driver::Command absolute(const swizzle::driver::Command& command)
+    {
+        auto result = command;
+
+        for(auto& file : result.Files)
+        {
+            file = boost::filesystem::absolute(file);
+        }
+
+        if(!result.EmitAst.empty())
+        {
+            result.EmitAst = boost::filesystem::absolute(result.EmitAst);
+        }
+
+        if(!result.EmitCpp.empty())
+        {
+            result.EmitCpp = boost::filesystem::absolute(result.EmitCpp);
+        }
+
+        if(!result.Depfile.empty())
+        {
+            result.Depfile = boost::filesystem::absolute(result.Depfile);
+        }
+
+        return result;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Arguments arguments;
+
+    try
+    {
+        if(!parseArguments(argc, argv, arguments))
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        if(!arguments.StopServer.empty())
+        {
+            swizzle::driver::sendShutdown(arguments.StopServer);
+            return EXIT_SUCCESS;
+        }
+
+        if(!arguments.Server.empty())
+        {
+            auto options = arguments.Options;
+            options.CacheSize = arguments.CacheSize;
+
+            swizzle::driver::CompileServer server(options, arguments.Server);
+            server.run();
+
+            return EXIT_SUCCESS;
+        }
+
+        if(!arguments.Watch.empty())
+        {
+            auto options = arguments.Options;
+            options.CacheSize = arguments.CacheSize;
+
+            if(options.ImportRoot.empty())
+            {
+                options.ImportRoot = arguments.Watch;
+            }
+
+            swizzle::driver::Driver driver(options);
+            swizzle::driver::watch(driver, arguments.Command, arguments.Watch, std::cerr, []{ return false; });
+
+            return EXIT_SUCCESS;
+        }
+
+        if(!arguments.Connect.empty())
+        {
+            return swizzle::driver::sendCommand(arguments.Connect, absolute(arguments.Command), std::cerr) ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+
+        swizzle::driver::Driver driver(arguments.Options);
+        swizzle::driver::BuildReport report;
+
+        if(!swizzle::driver::runCommand(driver, arguments.Command, std::cerr, &report))
+        {
+            return EXIT_FAILURE;
+        }
+
+        if(arguments.Report.Time || arguments.Report.Memory || arguments.Report.States)
+        {
+            if(arguments.ReportJson)
+            {
+                report.printJson(std::cerr, arguments.Report);
+            }
+            else
+            {
+                report.print(std::cerr, arguments.Report);
+            }
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,613 @@
+#include <bench/Feed.hpp>                 // generated from schemas/bench/Feed.swizzle
+
+#include <swizzle/bench/Results.hpp>
+#include <swizzle/runtime/Arena.hpp>
+#include <swizzle/runtime/Bits.hpp>
+#include <swizzle/runtime/ByteOrder.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+    using swizzle::runtime::ByteOrder;
+
+    struct Arguments
+    {
+        std::size_t Iterations = 5;
+        std::size_t Messages = 1000000;
+    };
+
+    void usage(const char* program)
+    {
+        std::cerr << "usage: " << program << " [--iterations N] [--messages N]" << std::endl;
+    }
+
+    bool parseArguments(int argc, char* argv[], Arguments& arguments)
+    {
+        for(int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            if((i + 1) >= argc)
+            {
+                return false;
+            }
+
+            const std::string value = argv[++i];
+
+            if(arg == "--iterations") arguments.Iterations = std::stoul(value);
+            else if(arg == "--messages") arguments.Messages = std::stoul(value);
+            else return false;
+        }
+
+        return arguments.Iterations != 0 && arguments.Messages != 0;
+    }
+
+    double seconds(std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration<double>(duration).count();
+    }
+
+    class Writer
+    {
+    public:
+        template<class T>
+        void put(const T value)
+        {
+            char bytes[sizeof(T)];
+            swizzle::runtime::store<T, ByteOrder::Big>(bytes, value);
+            buffer_.append(bytes, sizeof(T));
+        }
+
+        void symbol(const std::size_t i)
+        {
+            char bytes[8] = { 'S', 'Y', 'M', static_cast<char>('A' + i % 26), ' ', ' ', ' ', ' ' };
+            buffer_.append(bytes, sizeof(bytes));
+        }
+
+        std::string& buffer() { return buffer_; }
+
+    private:
+        std::string buffer_;
+    };
+
+    // @count messages laid end to end: mostly orders, some trades, an
+    // occasional book snapshot of a few levels
+    std::string makeFeed(const std::size_t count)
+    {
+        Writer writer;
+
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            const auto kind = i % 16;
+            const auto type = (kind == 15) ? 'S' : (kind >= 12) ? 'T' : 'A';
+            const auto start = writer.buffer().size();
+
+            writer.put<std::uint16_t>(0);
+            writer.put<std::uint8_t>(type);
+            writer.put<std::uint32_t>(static_cast<std::uint32_t>(i));
+            writer.put<std::uint64_t>(1500000000000000000ULL + i);
+
+            if(type == 'A')
+            {
+                writer.put<std::uint64_t>(i);
+                writer.put<std::uint8_t>(i % 2);
+                writer.put<std::uint32_t>(static_cast<std::uint32_t>(i * 2654435761U));
+                writer.put<std::uint32_t>(100 + i % 900);
+                writer.symbol(i);
+                writer.put<std::int64_t>(1000000 + static_cast<std::int64_t>(i % 5000));
+            }
+            else if(type == 'T')
+            {
+                writer.put<std::uint64_t>(i - 1);
+                writer.put<std::uint32_t>(10 + i % 90);
+                writer.put<std::int64_t>(1000000 + static_cast<std::int64_t>(i % 5000));
+                writer.put<std::uint64_t>(i * 7);
+            }
+            else
+            {
+                const auto levels = static_cast<std::uint16_t>(1 + i % 10);
+
+                writer.symbol(i);
+                writer.put<std::uint16_t>(levels);
+                for(std::uint16_t level = 0; level < levels; ++level)
+                {
+                    writer.put<std::int64_t>(1000000 - level);
+                    writer.put<std::uint32_t>(100u * level);
+                }
+            }
+
+            // back fill the header's length
+            swizzle::runtime::store<std::uint16_t, ByteOrder::Big>(&writer.buffer()[start], static_cast<std::uint16_t>(writer.buffer().size() - start));
+        }
+
+        return writer.buffer();
+    }
+
+    // the fields a feed handler typically looks at, read in place
+    std::int64_t viewFeed(const std::string& feed)
+    {
+        std::int64_t checksum = 0;
+
+        for(const char* data = feed.data(), *end = data + feed.size(); data != end;)
+        {
+            const bench::MessageView message(data, end - data);
+
+            checksum += message.header().sequence();
+            if(message.isAddOrder())
+            {
+                checksum += message.asAddOrder().price();
+            }
+            else if(message.isTrade())
+            {
+                checksum += message.asTrade().quantity();
+            }
+            else
+            {
+                checksum += message.asSnapshot().count();
+            }
+
+            data += message.wireSize();
+        }
+
+        return checksum;
+    }
+
+    // the same fields, with every message validated first
+    std::int64_t validatedViewFeed(const std::string& feed)
+    {
+        std::int64_t checksum = 0;
+
+        for(const char* data = feed.data(), *end = data + feed.size(); data != end;)
+        {
+            const bench::MessageView message(data, end - data);
+            if(!message.isValid())
+            {
+                throw std::runtime_error("invalid message in the feed");
+            }
+
+            checksum += message.header().sequence();
+            if(message.isAddOrder())
+            {
+                checksum += message.asAddOrder().price();
+            }
+            else if(message.isTrade())
+            {
+                checksum += message.asTrade().quantity();
+            }
+            else
+            {
+                checksum += message.asSnapshot().count();
+            }
+
+            data += message.wireSize();
+        }
+
+        return checksum;
+    }
+
+    // the same fields, every message decoded into one reused value
+    std::int64_t decodeFeed(const std::string& feed)
+    {
+        std::int64_t checksum = 0;
+        bench::Message message;
+
+        for(const char* data = feed.data(), *end = data + feed.size(); data != end;)
+        {
+            data = bench::decode(data, end, message);
+            if(!data)
+            {
+                throw std::runtime_error("invalid message in the feed");
+            }
+
+            checksum += message.header.sequence;
+            switch(message.header.type)
+            {
+                case 'A': checksum += message.addOrderCase.price; break;
+                case 'T': checksum += message.tradeCase.quantity; break;
+                default: checksum += message.snapshotCase.count; break;
+            }
+        }
+
+        return checksum;
+    }
+
+    std::vector<bench::Message> decodeAll(const std::string& feed)
+    {
+        std::vector<bench::Message> messages;
+
+        for(const char* data = feed.data(), *end = data + feed.size(); data != end;)
+        {
+            messages.emplace_back();
+            data = bench::decode(data, end, messages.back());
+        }
+
+        return messages;
+    }
+
+    // every message written back to a buffer sized up front
+    double encodeNanosecondsPerMessage(const std::string& feed, const std::vector<bench::Message>& messages)
+    {
+        std::string buffer(feed.size(), '\0');
+
+        const auto start = std::chrono::steady_clock::now();
+
+        std::size_t size = 0;
+        for(const auto& message : messages)
+        {
+            size += bench::size(message);
+        }
+
+        if(size != buffer.size())
+        {
+            throw std::runtime_error("size() disagrees with the feed");
+        }
+
+        char* out = &buffer[0];
+        for(const auto& message : messages)
+        {
+            out = bench::encode(message, out);
+        }
+
+        const auto elapsed = seconds(std::chrono::steady_clock::now() - start);
+
+        if(buffer != feed)
+        {
+            throw std::runtime_error("encode() disagrees with the feed");
+        }
+
+        return elapsed * 1e9 / messages.size();
+    }
+
+    // the start and length of every message of @feed, a batch for decodeColumns()
+    struct Batch
+    {
+        std::vector<const char*> Messages;
+        std::vector<std::size_t> Lengths;
+    };
+
+    Batch makeBatch(const std::string& feed)
+    {
+        Batch batch;
+
+        for(const char* data = feed.data(), *end = data + feed.size(); data != end;)
+        {
+            const auto length = bench::MessageView(data, end - data).wireSize();
+
+            batch.Messages.push_back(data);
+            batch.Lengths.push_back(length);
+            data += length;
+        }
+
+        return batch;
+    }
+
+    // the fields of decodeFeed(), every message of the batch decoded into a reused
+    // value, its vectors on the heap or in @arena, reset per batch
+    std::int64_t decodeBatch(const Batch& batch, std::vector<bench::Message>& messages, swizzle::runtime::Arena* arena)
+    {
+        messages.resize(batch.Messages.size());
+
+        if(arena)
+        {
+            arena->reset();
+        }
+
+        for(std::size_t i = 0; i < messages.size(); ++i)
+        {
+            if(!bench::decode(batch.Messages[i], batch.Messages[i] + batch.Lengths[i], messages[i], arena))
+            {
+                throw std::runtime_error("invalid message in the feed");
+            }
+        }
+
+        std::int64_t checksum = 0;
+        for(const auto& message : messages)
+        {
+            checksum += message.header.sequence;
+            switch(message.header.type)
+            {
+                case 'A': checksum += message.addOrderCase.price; break;
+                case 'T': checksum += message.tradeCase.quantity; break;
+                default: checksum += message.snapshotCase.count; break;
+            }
+        }
+
+        return checksum;
+    }
+
+    // the same fields, the batch decoded a column at a time
+    std::int64_t decodeBatchColumns(const Batch& batch, bench::MessageColumns& columns)
+    {
+        bench::clear(columns);
+
+        if(bench::decodeColumns(batch.Messages.data(), batch.Lengths.data(), batch.Messages.size(), columns) != batch.Messages.size())
+        {
+            throw std::runtime_error("invalid message in the feed");
+        }
+
+        std::int64_t checksum = 0;
+        for(const auto sequence : columns.header_sequence) checksum += sequence;
+        for(const auto& order : columns.addOrderCase) checksum += order.price;
+        for(const auto& trade : columns.tradeCase) checksum += trade.quantity;
+        for(const auto& snapshot : columns.snapshotCase) checksum += snapshot.count;
+
+        return checksum;
+    }
+
+    // @count Trade records packed back to back, as a file of executions keeps them
+    std::string makeTrades(const std::size_t count)
+    {
+        Writer writer;
+
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            writer.put<std::uint64_t>(i);
+            writer.put<std::uint32_t>(10 + i % 90);
+            writer.put<std::int64_t>(1000000 + static_cast<std::int64_t>(i % 5000));
+            writer.put<std::uint64_t>(i * 7);
+        }
+
+        return writer.buffer();
+    }
+
+    // quantity and price of every trade, decoded record by record
+    std::int64_t decodeTrades(const std::string& trades, std::vector<bench::Trade>& values)
+    {
+        values.resize(trades.size() / bench::TradeView::Size);
+
+        const char* data = trades.data();
+        for(auto& value : values)
+        {
+            data = bench::decode(data, data + bench::TradeView::Size, value);
+        }
+
+        std::int64_t checksum = 0;
+        for(const auto& value : values)
+        {
+            checksum += value.quantity + value.price;
+        }
+
+        return checksum;
+    }
+
+    // the same fields, decoded a column at a time
+    std::int64_t decodeTradeColumns(const std::string& trades, bench::TradeColumns& columns)
+    {
+        bench::clear(columns);
+        bench::decodeColumns(trades.data(), trades.size() / bench::TradeView::Size, columns);
+
+        std::int64_t checksum = 0;
+        for(std::size_t i = 0; i < columns.count_; ++i)
+        {
+            checksum += columns.quantity[i] + columns.price[i];
+        }
+
+        return checksum;
+    }
+
+    // @count Depth records packed back to back
+    std::string makeDepths(const std::size_t count)
+    {
+        Writer writer;
+
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            writer.put<std::uint64_t>(1500000000000000000ULL + i);
+            for(std::uint32_t level = 0; level < 64; ++level)
+            {
+                writer.put<std::uint32_t>(static_cast<std::uint32_t>(i) * 64 + level);
+            }
+        }
+
+        return writer.buffer();
+    }
+
+    std::int64_t sumDepth(const bench::Depth& depth)
+    {
+        return static_cast<std::int64_t>(depth.bids[0]) + depth.bids[31] + depth.asks[0] + depth.asks[31];
+    }
+
+    // every record through decode(), its arrays byte swapped a run at a time
+    std::int64_t decodeDepths(const std::string& depths)
+    {
+        std::int64_t checksum = 0;
+        bench::Depth depth;
+
+        for(const char* data = depths.data(), *end = data + depths.size(); data != end;)
+        {
+            data = bench::decode(data, end, depth);
+            checksum += sumDepth(depth);
+        }
+
+        return checksum;
+    }
+
+    // the same, the arrays read an element at a time
+    std::int64_t loadDepths(const std::string& depths)
+    {
+        std::int64_t checksum = 0;
+        bench::Depth depth;
+
+        for(const char* data = depths.data(), *end = data + depths.size(); data != end; data += bench::DepthView::Size)
+        {
+            depth.timestamp = swizzle::runtime::load<std::uint64_t, ByteOrder::Big>(data);
+            for(std::size_t i = 0; i < 32; ++i)
+            {
+                depth.bids[i] = swizzle::runtime::load<std::uint32_t, ByteOrder::Big>(data + 8 + i * 4);
+                depth.asks[i] = swizzle::runtime::load<std::uint32_t, ByteOrder::Big>(data + 136 + i * 4);
+            }
+
+            checksum += sumDepth(depth);
+        }
+
+        return checksum;
+    }
+
+    std::vector<bench::OrderFlags> makeFlags(const std::size_t count)
+    {
+        std::vector<bench::OrderFlags> flags(count);
+
+        std::uint32_t state = 1;
+        for(auto& f : flags)
+        {
+            state = state * 1664525U + 1013904223U;
+            f.value = state;
+        }
+
+        return flags;
+    }
+
+    // every field of every bitfield through its accessor
+    std::uint64_t perFieldSum(const std::vector<bench::OrderFlags>& flags)
+    {
+        std::uint64_t sum = 0;
+
+        for(const auto& f : flags)
+        {
+            sum += f.timeInForce() + f.hidden() + f.postOnly() + f.capacity() + f.venue() + f.session();
+        }
+
+        return sum;
+    }
+
+    // every field of every bitfield through unpack(), a block at a time
+    std::uint64_t unpackSum(const std::vector<bench::OrderFlags>& flags)
+    {
+        constexpr std::size_t Block = 256;
+        bench::OrderFlags::Fields fields[Block];
+
+        std::uint64_t sum = 0;
+
+        for(std::size_t begin = 0; begin < flags.size(); begin += Block)
+        {
+            const auto count = std::min(Block, flags.size() - begin);
+            bench::unpack(flags.data() + begin, count, fields);
+
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                const auto& f = fields[i];
+                sum += f.timeInForce + f.hidden + f.postOnly + f.capacity + f.venue + f.session;
+            }
+        }
+
+        return sum;
+    }
+
+    template<class Benchmark>
+    double nanosecondsPerBitfield(const std::vector<bench::OrderFlags>& flags, const std::uint64_t expected, Benchmark benchmark)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const auto sum = benchmark(flags);
+        const auto elapsed = seconds(std::chrono::steady_clock::now() - start);
+
+        if(sum != expected)
+        {
+            throw std::runtime_error("bitfield benchmarks disagree");
+        }
+
+        return elapsed * 1e9 / flags.size();
+    }
+
+    template<class Benchmark>
+    double nanosecondsPerRecord(const std::size_t count, const std::int64_t expected, Benchmark benchmark)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const auto checksum = benchmark();
+        const auto elapsed = seconds(std::chrono::steady_clock::now() - start);
+
+        if(checksum != expected)
+        {
+            throw std::runtime_error("batch decodes disagree");
+        }
+
+        return elapsed * 1e9 / count;
+    }
+
+    template<class Benchmark>
+    double nanosecondsPerMessage(const std::string& feed, const std::size_t count, const std::int64_t expected, Benchmark benchmark)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const auto checksum = benchmark(feed);
+        const auto elapsed = seconds(std::chrono::steady_clock::now() - start);
+
+        if(checksum != expected)
+        {
+            throw std::runtime_error("benchmarks disagree on the feed's contents");
+        }
+
+        return elapsed * 1e9 / count;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Arguments arguments;
+
+    try
+    {
+        if(!parseArguments(argc, argv, arguments))
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        const auto feed = makeFeed(arguments.Messages);
+        const auto expected = decodeFeed(feed);
+        const auto messages = decodeAll(feed);
+        const auto flags = makeFlags(arguments.Messages);
+        const auto flagsSum = perFieldSum(flags);
+        const auto batch = makeBatch(feed);
+        const auto trades = makeTrades(arguments.Messages);
+        const auto depths = makeDepths(arguments.Messages);
+        const auto depthsSum = loadDepths(depths);
+
+        // the outputs are reused, as a replay loop would
+        std::vector<bench::Message> batchValues;
+        bench::MessageColumns batchColumns;
+        std::vector<bench::Trade> tradeValues;
+        bench::TradeColumns tradeColumns;
+
+        swizzle::runtime::Arena arena;
+
+        const auto batchSum = decodeBatch(batch, batchValues, nullptr);
+        const auto tradesSum = decodeTrades(trades, tradeValues);
+
+        swizzle::bench::Results results;
+
+        for(std::size_t iteration = 0; iteration < arguments.Iterations; ++iteration)
+        {
+            results.add("view_ns_per_message", nanosecondsPerMessage(feed, arguments.Messages, expected, viewFeed));
+            results.add("validated_view_ns_per_message", nanosecondsPerMessage(feed, arguments.Messages, expected, validatedViewFeed));
+            results.add("decode_ns_per_message", nanosecondsPerMessage(feed, arguments.Messages, expected, decodeFeed));
+            results.add("size_and_encode_ns_per_message", encodeNanosecondsPerMessage(feed, messages));
+            results.add("batch_decode_ns_per_message", nanosecondsPerRecord(arguments.Messages, batchSum, [&] { return decodeBatch(batch, batchValues, nullptr); }));
+            results.add("batch_arena_ns_per_message", nanosecondsPerRecord(arguments.Messages, batchSum, [&] { return decodeBatch(batch, batchValues, &arena); }));
+            results.add("batch_columns_ns_per_message", nanosecondsPerRecord(arguments.Messages, batchSum, [&] { return decodeBatchColumns(batch, batchColumns); }));
+            results.add("packed_decode_ns_per_record", nanosecondsPerRecord(arguments.Messages, tradesSum, [&] { return decodeTrades(trades, tradeValues); }));
+            results.add("packed_columns_ns_per_record", nanosecondsPerRecord(arguments.Messages, tradesSum, [&] { return decodeTradeColumns(trades, tradeColumns); }));
+            results.add("array_run_ns_per_record", nanosecondsPerMessage(depths, arguments.Messages, depthsSum, decodeDepths));
+            results.add("array_element_ns_per_record", nanosecondsPerMessage(depths, arguments.Messages, depthsSum, loadDepths));
+            results.add("bitfield_per_field_ns", nanosecondsPerBitfield(flags, flagsSum, perFieldSum));
+            results.add("bitfield_unpack_ns", nanosecondsPerBitfield(flags, flagsSum, unpackSum));
+        }
+
+        std::cout << feed.size() / arguments.Messages << " bytes per message on average, unpack() "
+                  << (swizzle::runtime::hasBmi2() ? "uses BMI2" : "without BMI2") << "\n";
+        results.print(std::cout);
+
+        return EXIT_SUCCESS;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}